@@ -0,0 +1,19 @@
+#!/bin/bash
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+BUILD_DIR="$SCRIPT_DIR/build"
+
+mkdir -p "$BUILD_DIR"
+cd "$BUILD_DIR"
+
+cmake "$SCRIPT_DIR"
+
+make -j"$(sysctl -n hw.logicalcpu 2>/dev/null || nproc)"
+
+echo ""
+echo "Build complete:"
+echo "  $BUILD_DIR/dataref-benchmark [frames] [tiered|legacy]"
+echo "  $BUILD_DIR/command-benchmark [iterations]"
+echo "  $BUILD_DIR/write-queue-benchmark [milliseconds]"
+echo "  $BUILD_DIR/dataref-poll-rate-test (or ctest)"
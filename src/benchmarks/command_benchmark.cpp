@@ -0,0 +1,83 @@
+// Command benchmark — measures the two halves of a button press against the
+// desktop X-Plane SDK mock: resolving a command by name (what executeCommand
+// does on every press) and dispatching a command into the plugin's bound
+// callbacks (what X-Plane does through Dataref::_commandCallback).
+
+#include "dataref.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <XPLMUtilities.h>
+
+// Provided by desktop/xplane-sdk-mock.cpp
+void triggerMockCommand(XPLMCommandRef ref, int phase);
+
+namespace {
+    constexpr int kSimCommands = 2000;  // Commands the sim and aircraft register
+    constexpr int kBoundCommands = 150; // Commands the plugin binds handlers to
+    constexpr int kPressedCommands = 64; // Distinct commands a cockpit's buttons send
+
+    std::string commandName(const char *prefix, int index) {
+        return std::string("benchmark/") + prefix + "/" + std::to_string(index);
+    }
+
+    template<typename F>
+    double nanosecondsPerOp(int iterations, F &&body) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            body(i);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    if (iterations <= 0) {
+        iterations = 200000;
+    }
+
+    Dataref *datarefManager = Dataref::getInstance();
+
+    std::vector<std::string> pressedNames;
+    for (int i = 0; i < kSimCommands; ++i) {
+        std::string name = commandName("sim", i);
+        XPLMFindCommand(name.c_str());
+        if (i % (kSimCommands / kPressedCommands) == 0) {
+            pressedNames.push_back(name);
+        }
+    }
+
+    long long dispatched = 0;
+    std::vector<XPLMCommandRef> boundHandles;
+    for (int i = 0; i < kBoundCommands; ++i) {
+        std::string name = commandName("plugin", i);
+        datarefManager->bindExistingCommand(name.c_str(), [&dispatched](XPLMCommandPhase) {
+            dispatched++;
+        });
+        boundHandles.push_back(XPLMFindCommand(name.c_str()));
+    }
+
+    int pressedCount = static_cast<int>(pressedNames.size());
+    void *sink = nullptr;
+    double uncachedLookup = nanosecondsPerOp(iterations, [&](int i) {
+        sink = XPLMFindCommand(pressedNames[i % pressedCount].c_str());
+    });
+    double cachedLookup = nanosecondsPerOp(iterations, [&](int i) {
+        sink = datarefManager->findCommand(pressedNames[i % pressedCount].c_str());
+    });
+    double dispatch = nanosecondsPerOp(iterations, [&](int i) {
+        triggerMockCommand(boundHandles[(i * 37) % kBoundCommands], xplm_CommandBegin);
+    });
+
+    printf("Command benchmark over %d iterations (%d sim commands, %d bound)\n", iterations, kSimCommands, kBoundCommands);
+    printf("  XPLMFindCommand        %8.1f ns/op\n", uncachedLookup);
+    printf("  Dataref::findCommand   %8.1f ns/op\n", cachedLookup);
+    printf("  command dispatch       %8.1f ns/op (%lld callbacks run)\n", dispatch, dispatched);
+
+    return sink == nullptr ? 1 : 0;
+}
@@ -0,0 +1,290 @@
+// Dataref poll benchmark — measures the cost of Dataref::update() against the
+// desktop X-Plane SDK mock with a dataref mix resembling a busy cockpit
+// (FMC text lines, CDU symbol arrays, FCU/LED scalars, joystick assignments).
+//
+// Usage: dataref-benchmark [frames] [tiered|legacy]
+//   tiered  moves annunciator ints, float arrays and joystick assignments to
+//           the slower poll tiers
+//   legacy  times the per-frame loop update() ran before poll plans, for the
+//           "before" numbers: every ref visited through the variant, its type
+//           queried on every read, changes collected and then applied
+
+#include "dataref.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <XPLMDataAccess.h>
+#include <XPLMProcessing.h>
+
+// Provided by desktop/xplane-sdk-mock.cpp
+XPLMDataRef createMockDataRef(const char *name, XPLMDataTypeID type);
+
+namespace {
+    constexpr int kFloatRefs = 200;
+    constexpr int kIntRefs = 120;
+    constexpr int kDoubleRefs = 20;
+    constexpr int kStringRefs = 28;   // 2 CDUs x 14 lines
+    constexpr int kFloatArrayRefs = 8;
+    constexpr int kByteArrayRefs = 8; // FF777/FF767 style symbols/colors/sizes/effects
+    constexpr int kWarmupFrames = 200;
+
+    struct Workload {
+            std::vector<XPLMDataRef> floats;
+            std::vector<XPLMDataRef> ints;
+            std::vector<XPLMDataRef> doubles;
+            std::vector<XPLMDataRef> strings;
+            std::vector<XPLMDataRef> floatArrays;
+            std::vector<XPLMDataRef> byteArrays;
+            XPLMDataRef buttonAssignments = nullptr;
+    };
+
+    std::string refName(const char *prefix, int index) {
+        return std::string("benchmark/") + prefix + "/" + std::to_string(index);
+    }
+
+    // With tiered polling, annunciator style ints, the float arrays and the
+    // joystick assignments move to the slower poll tiers.
+    Workload createWorkload(bool tiered) {
+        DatarefPollRate slowRate = tiered ? DatarefPollRate::HZ_5 : DatarefPollRate::EVERY_FRAME;
+        DatarefPollRate slowestRate = tiered ? DatarefPollRate::HZ_1 : DatarefPollRate::EVERY_FRAME;
+        Workload workload;
+        Dataref *datarefManager = Dataref::getInstance();
+
+        for (int i = 0; i < kFloatRefs; ++i) {
+            std::string name = refName("float", i);
+            workload.floats.push_back(createMockDataRef(name.c_str(), xplmType_Float));
+            datarefManager->monitorExistingDataref<float>(name.c_str(), [](float) {});
+        }
+
+        for (int i = 0; i < kIntRefs; ++i) {
+            std::string name = refName("int", i);
+            workload.ints.push_back(createMockDataRef(name.c_str(), xplmType_Int));
+            datarefManager->monitorExistingDataref<bool>(name.c_str(), [](bool) {}, nullptr, slowRate);
+        }
+
+        for (int i = 0; i < kDoubleRefs; ++i) {
+            std::string name = refName("double", i);
+            workload.doubles.push_back(createMockDataRef(name.c_str(), xplmType_Double));
+            datarefManager->monitorExistingDataref<double>(name.c_str(), [](double) {});
+        }
+
+        for (int i = 0; i < kStringRefs; ++i) {
+            std::string name = refName("string", i);
+            XPLMDataRef handle = createMockDataRef(name.c_str(), xplmType_Data);
+            std::string line(24, 'A' + (i % 26));
+            XPLMSetDatab(handle, line.data(), 0, static_cast<int>(line.size()));
+            workload.strings.push_back(handle);
+            datarefManager->getCached<std::string>(name.c_str());
+        }
+
+        for (int i = 0; i < kFloatArrayRefs; ++i) {
+            std::string name = refName("floatarray", i);
+            XPLMDataRef handle = createMockDataRef(name.c_str(), xplmType_FloatArray);
+            std::vector<float> values(8, 0.5f);
+            XPLMSetDatavf(handle, values.data(), 0, static_cast<int>(values.size()));
+            workload.floatArrays.push_back(handle);
+            datarefManager->monitorExistingDataref<std::vector<float>>(name.c_str(), [](std::vector<float>) {}, nullptr, slowRate);
+        }
+
+        for (int i = 0; i < kByteArrayRefs; ++i) {
+            std::string name = refName("bytearray", i);
+            XPLMDataRef handle = createMockDataRef(name.c_str(), xplmType_Data);
+            std::vector<unsigned char> values(14 * 24, ' ');
+            XPLMSetDatab(handle, values.data(), 0, static_cast<int>(values.size()));
+            workload.byteArrays.push_back(handle);
+            datarefManager->getCached<std::vector<unsigned char>>(name.c_str());
+        }
+
+        workload.buttonAssignments = createMockDataRef("sim/joystick/joystick_button_assignments", xplmType_IntArray);
+        std::vector<int> assignments(3200, 0);
+        XPLMSetDatavi(workload.buttonAssignments, assignments.data(), 0, static_cast<int>(assignments.size()));
+        datarefManager->monitorExistingDataref<std::vector<int>>("sim/joystick/joystick_button_assignments", [](std::vector<int>) {}, nullptr, slowestRate);
+
+        return workload;
+    }
+
+    // Touch a small fraction of the refs each frame, like a real cockpit where
+    // most values sit still between frames.
+    void mutateWorkload(Workload &workload, int frame) {
+        XPLMSetDataf(workload.floats[frame % kFloatRefs], static_cast<float>(frame));
+        XPLMSetDataf(workload.floats[(frame * 7) % kFloatRefs], static_cast<float>(frame) * 0.5f);
+        XPLMSetDatai(workload.ints[frame % kIntRefs], frame & 1);
+
+        if (frame % 10 == 0) {
+            std::string line(24, 'a' + (frame % 26));
+            XPLMDataRef handle = workload.strings[(frame / 10) % kStringRefs];
+            XPLMSetDatab(handle, line.data(), 0, static_cast<int>(line.size()));
+        }
+    }
+
+    struct LegacyEntry {
+            XPLMDataRef handle;
+            CachedValue cache;
+    };
+
+    // The pre poll plan reader: the scalar branch asks for the ref's type on
+    // every read and the array branches size a fresh vector each time.
+    template<typename T>
+    T legacyRead(XPLMDataRef handle) {
+        if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>) {
+            XPLMDataTypeID refType = XPLMGetDataRefTypes(handle);
+            if ((refType & xplmType_Float) == xplmType_Float) {
+                float value = XPLMGetDataf(handle);
+                return std::is_same_v<T, bool> ? value > std::numeric_limits<float>::epsilon() : static_cast<T>(value);
+            } else if ((refType & xplmType_Double) == xplmType_Double) {
+                double value = XPLMGetDatad(handle);
+                return std::is_same_v<T, bool> ? value > std::numeric_limits<double>::epsilon() : static_cast<T>(value);
+            } else {
+                int value = XPLMGetDatai(handle);
+                return std::is_same_v<T, bool> ? value > 0 : static_cast<T>(value);
+            }
+        } else if constexpr (std::is_same_v<T, std::vector<int>>) {
+            int size = XPLMGetDatavi(handle, nullptr, 0, 0);
+            std::vector<int> outValues(size);
+            XPLMGetDatavi(handle, outValues.data(), 0, size);
+            return outValues;
+        } else if constexpr (std::is_same_v<T, std::vector<float>>) {
+            int size = XPLMGetDatavf(handle, nullptr, 0, 0);
+            std::vector<float> outValues(size);
+            XPLMGetDatavf(handle, outValues.data(), 0, size);
+            return outValues;
+        } else if constexpr (std::is_same_v<T, std::vector<unsigned char>>) {
+            int size = XPLMGetDatab(handle, nullptr, 0, 0);
+            std::vector<unsigned char> outValues(size);
+            XPLMGetDatab(handle, outValues.data(), 0, size);
+            return outValues;
+        } else {
+            int size = XPLMGetDatab(handle, nullptr, 0, 0);
+            std::vector<char> str(size);
+            XPLMGetDatab(handle, str.data(), 0, size);
+            auto it = std::find(str.begin(), str.end(), '\0');
+            return std::string(str.begin(), it);
+        }
+    }
+
+    // Same refs and cache types the workload registers with Dataref, read
+    // back once so the first timed frame starts from settled caches.
+    std::vector<LegacyEntry> createLegacyEntries(const Workload &workload) {
+        std::vector<LegacyEntry> entries;
+        auto add = [&entries](const std::vector<XPLMDataRef> &handles, DataRefValueType value) {
+            for (XPLMDataRef handle : handles) {
+                entries.push_back({.handle = handle, .cache = {.value = value, .lastUpdateCycleNumber = 0}});
+            }
+        };
+        add(workload.floats, 0.0f);
+        add(workload.ints, false);
+        add(workload.doubles, 0.0);
+        add(workload.strings, std::string());
+        add(workload.floatArrays, std::vector<float>());
+        add(workload.byteArrays, std::vector<unsigned char>());
+        add({workload.buttonAssignments}, std::vector<int>());
+        return entries;
+    }
+
+    void legacyUpdate(std::vector<LegacyEntry> &entries) {
+        std::vector<std::pair<size_t, DataRefValueType>> updates;
+
+        for (size_t index = 0; index < entries.size(); ++index) {
+            XPLMDataRef handle = entries[index].handle;
+            std::visit(
+                [&](auto &&value) {
+                    using T = std::decay_t<decltype(value)>;
+                    T newValue = legacyRead<T>(handle);
+                    bool didChange = false;
+                    if constexpr (std::is_floating_point_v<T>) {
+                        didChange = std::fabs(value - newValue) > std::numeric_limits<T>::epsilon();
+                    } else {
+                        didChange = value != newValue;
+                    }
+
+                    if (didChange) {
+                        updates.emplace_back(index, std::move(newValue));
+                    }
+                },
+                entries[index].cache.value);
+        }
+
+        int cycleNumber = XPLMGetCycleNumber();
+        for (auto &[index, newValue] : updates) {
+            entries[index].cache = {.value = std::move(newValue), .lastUpdateCycleNumber = cycleNumber};
+        }
+    }
+
+    double percentile(std::vector<double> samples, double p) {
+        std::sort(samples.begin(), samples.end());
+        size_t index = static_cast<size_t>(p * (samples.size() - 1));
+        return samples[index];
+    }
+}
+
+int main(int argc, char **argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 5000;
+    if (frames <= 0) {
+        frames = 5000;
+    }
+    std::string mode = argc > 2 ? argv[2] : "";
+    bool tiered = mode == "tiered";
+    bool legacy = mode == "legacy";
+
+    Workload workload = createWorkload(tiered);
+    Dataref *datarefManager = Dataref::getInstance();
+    std::vector<LegacyEntry> legacyEntries = legacy ? createLegacyEntries(workload) : std::vector<LegacyEntry>();
+    auto poll = [&]() {
+        if (legacy) {
+            legacyUpdate(legacyEntries);
+        } else {
+            datarefManager->update();
+        }
+    };
+
+    for (int frame = 0; frame < kWarmupFrames; ++frame) {
+        mutateWorkload(workload, frame);
+        poll();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(frames);
+    for (int frame = 0; frame < frames; ++frame) {
+        mutateWorkload(workload, frame);
+
+        auto start = std::chrono::steady_clock::now();
+        poll();
+        auto end = std::chrono::steady_clock::now();
+
+        // Pace the loop like a 200 fps sim so the slow tiers see real time pass
+        std::this_thread::sleep_until(start + std::chrono::milliseconds(5));
+
+        samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    double total = 0;
+    for (double sample : samples) {
+        total += sample;
+    }
+
+    int refCount = kFloatRefs + kIntRefs + kDoubleRefs + kStringRefs + kFloatArrayRefs + kByteArrayRefs + 1;
+    if (legacy) {
+        printf("Legacy update loop over %d frames, %d polled refs (every frame)\n", frames, refCount);
+    } else {
+        const DatarefPollStats &pollStats = datarefManager->getPollStats();
+        printf("Dataref::update() over %d frames, %d polled refs (%s)\n", frames, refCount, tiered ? "tiered" : "every frame");
+        printf("  last frame polled %d / %d / %d / %d refs (every frame / 20 Hz / 5 Hz / 1 Hz)\n",
+            pollStats.polledLastFrame[0], pollStats.polledLastFrame[1], pollStats.polledLastFrame[2], pollStats.polledLastFrame[3]);
+    }
+    printf("  mean %8.2f us\n", total / frames);
+    printf("  p50  %8.2f us\n", percentile(samples, 0.50));
+    printf("  p99  %8.2f us\n", percentile(samples, 0.99));
+    printf("  max  %8.2f us\n", percentile(samples, 1.0));
+
+    return 0;
+}
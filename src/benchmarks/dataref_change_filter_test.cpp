@@ -0,0 +1,79 @@
+// Change filter test — checks against the desktop X-Plane SDK mock that a
+// monitor's change filter follows a moving value step by step, holds a settled
+// one until it leaves the enter band, and leaves other readers of the ref alone.
+
+#include "dataref.h"
+
+#include <cstdio>
+#include <vector>
+#include <XPLMDataAccess.h>
+
+// Provided by desktop/xplane-sdk-mock.cpp
+XPLMDataRef createMockDataRef(const char *name, XPLMDataTypeID type);
+
+namespace {
+    int failures = 0;
+
+    void expect(bool condition, const char *what) {
+        if (!condition) {
+            printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+
+    void hysteresis() {
+        const char *name = "test/filtered";
+        XPLMDataRef handle = createMockDataRef(name, xplmType_Float);
+        Dataref *datarefManager = Dataref::getInstance();
+
+        std::vector<float> filtered;
+        std::vector<float> unfiltered;
+        XPLMSetDataf(handle, 10.0f);
+        datarefManager->monitorExistingDataref<float>(name, [&filtered](float value) {
+            filtered.push_back(value);
+        }, nullptr, DatarefPollRate::EVERY_FRAME, {.enter = 1.0, .exit = 0.5, .quantum = 1.0});
+        datarefManager->monitorExistingDataref<float>(name, [&unfiltered](float value) {
+            unfiltered.push_back(value);
+        });
+
+        auto step = [&](float value) {
+            XPLMSetDataf(handle, value);
+            datarefManager->update();
+        };
+
+        step(10.0f);
+        expect(filtered == std::vector<float>{10.0f}, "first value passes the filter");
+
+        step(10.9f);
+        expect(filtered.size() == 1, "settled value holds inside the enter band");
+        expect(datarefManager->getCached<float>(name) == 10.9f, "getCached reads the unfiltered value");
+
+        step(11.2f);
+        step(11.6f);
+        expect(filtered == std::vector<float>{10.0f, 11.0f, 12.0f}, "moving value follows every step past exit");
+
+        step(11.4f);
+        step(12.6f);
+        expect(filtered.size() == 3, "turning back settles the value again");
+
+        step(13.1f);
+        expect(!filtered.empty() && filtered.back() == 13.0f, "settled value moves once it leaves the enter band");
+        expect(unfiltered.size() == 7, "unfiltered monitor sees every change");
+
+        step(13.3f);
+        datarefManager->executeChangedCallbacksForDataref(name);
+        expect(filtered.size() == 5 && filtered.back() == 13.0f, "forced delivery bypasses the filter");
+    }
+}
+
+int main() {
+    hysteresis();
+
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("All change filter checks passed\n");
+    return 0;
+}
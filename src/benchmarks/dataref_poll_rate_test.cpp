@@ -0,0 +1,83 @@
+// Poll rate test — checks against the desktop X-Plane SDK mock that a ref
+// read by getCached() every frame and monitored at a slower tier keeps the
+// faster rate, whichever of the two registers first.
+
+#include "dataref.h"
+
+#include <cstdio>
+#include <vector>
+#include <XPLMDataAccess.h>
+
+// Provided by desktop/xplane-sdk-mock.cpp
+XPLMDataRef createMockDataRef(const char *name, XPLMDataTypeID type);
+
+namespace {
+    int failures = 0;
+
+    void expect(bool condition, const char *what) {
+        if (!condition) {
+            printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+
+    // The update() calls run back to back, far inside one 5 Hz or 1 Hz
+    // period, so only the every-frame tier sees the new values.
+    void monitorThenGetCached() {
+        const char *name = "test/monitor_first";
+        XPLMDataRef handle = createMockDataRef(name, xplmType_Int);
+        Dataref *datarefManager = Dataref::getInstance();
+
+        std::vector<int> delivered;
+        XPLMSetDatai(handle, 1);
+        datarefManager->monitorExistingDataref<int>(name, [&delivered](int value) {
+            delivered.push_back(value);
+        }, nullptr, DatarefPollRate::HZ_5);
+        datarefManager->update();
+        expect(delivered.size() == 1 && delivered.back() == 1, "monitor first: first value delivered on the next tick");
+
+        expect(datarefManager->getCached<int>(name) == 1, "monitor first: getCached reads the monitored value");
+
+        XPLMSetDatai(handle, 2);
+        datarefManager->update();
+        expect(datarefManager->getCached<int>(name) == 2, "monitor first: getCached raises the ref to every frame");
+        expect(!delivered.empty() && delivered.back() == 2, "monitor first: monitor sees the every-frame change");
+    }
+
+    void getCachedThenMonitor() {
+        const char *name = "test/getcached_first";
+        XPLMDataRef handle = createMockDataRef(name, xplmType_Int);
+        Dataref *datarefManager = Dataref::getInstance();
+
+        XPLMSetDatai(handle, 7);
+        expect(datarefManager->getCached<int>(name) == 7, "getCached first: live value");
+        datarefManager->update();
+
+        std::vector<int> delivered;
+        datarefManager->monitorExistingDataref<int>(name, [&delivered](int value) {
+            delivered.push_back(value);
+        }, nullptr, DatarefPollRate::HZ_1);
+        expect(datarefManager->getCached<int>(name) == 7, "getCached first: monitoring keeps the cached value");
+
+        datarefManager->update();
+        expect(delivered.size() == 1 && delivered.back() == 7, "getCached first: new monitor gets the current value once");
+
+        XPLMSetDatai(handle, 8);
+        datarefManager->update();
+        expect(datarefManager->getCached<int>(name) == 8, "getCached first: slower monitor does not lower the rate");
+        expect(!delivered.empty() && delivered.back() == 8, "getCached first: monitor sees the every-frame change");
+    }
+}
+
+int main() {
+    monitorThenGetCached();
+    getCachedThenMonitor();
+
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("All poll rate checks passed\n");
+    return 0;
+}
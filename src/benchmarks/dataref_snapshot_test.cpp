@@ -0,0 +1,81 @@
+// Snapshot test — checks against the desktop X-Plane SDK mock that a worker
+// thread reads every-frame refs from the published snapshot, and that a
+// publish shares the chunks in which nothing changed with the previous one.
+
+#include "dataref.h"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <XPLMDataAccess.h>
+
+// Provided by desktop/xplane-sdk-mock.cpp
+XPLMDataRef createMockDataRef(const char *name, XPLMDataTypeID type);
+
+namespace {
+    constexpr int kRefs = 3 * DatarefSnapshot::ChunkSize;
+
+    int failures = 0;
+
+    void expect(bool condition, const char *what) {
+        if (!condition) {
+            printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+
+    std::string refName(int index) {
+        return "test/snapshot/" + std::to_string(index);
+    }
+
+    void publish() {
+        Dataref *datarefManager = Dataref::getInstance();
+        std::vector<XPLMDataRef> handles;
+        for (int i = 0; i < kRefs; ++i) {
+            std::string name = refName(i);
+            handles.push_back(createMockDataRef(name.c_str(), xplmType_Int));
+            XPLMSetDatai(handles.back(), i);
+            datarefManager->monitorExistingDataref<int>(name.c_str(), [](int) {});
+        }
+
+        expect(datarefManager->getSnapshot() == nullptr, "nothing is published before a worker asks");
+        datarefManager->update();
+        std::shared_ptr<const DatarefSnapshot> first = datarefManager->getSnapshot();
+        expect(first && first->size >= kRefs, "first publish covers every ref");
+
+        datarefManager->update();
+        expect(datarefManager->getSnapshot() == first, "a frame without changes publishes nothing");
+
+        XPLMSetDatai(handles[1], 1000);
+        datarefManager->update();
+        std::shared_ptr<const DatarefSnapshot> second = datarefManager->getSnapshot();
+        expect(second && second != first, "a change publishes a new snapshot");
+
+        int worker = 0;
+        std::thread([&worker]() {
+            worker = Dataref::getInstance()->get<int>(refName(1).c_str());
+        }).join();
+        expect(worker == 1000, "worker get() reads the published value");
+
+        DatarefId changedId = second->ids->at(refName(1));
+        DatarefId otherId = second->ids->at(refName(kRefs - 1));
+        size_t changedChunk = changedId / DatarefSnapshot::ChunkSize;
+        size_t otherChunk = otherId / DatarefSnapshot::ChunkSize;
+        expect(first->chunks[changedChunk] != second->chunks[changedChunk], "the changed chunk is copied");
+        expect(otherChunk == changedChunk || first->chunks[otherChunk] == second->chunks[otherChunk], "unchanged chunks are shared");
+        expect(std::get<int>(*first->value(changedId)) == 1, "the previous snapshot keeps its value");
+    }
+}
+
+int main() {
+    publish();
+
+    if (failures > 0) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("All snapshot checks passed\n");
+    return 0;
+}
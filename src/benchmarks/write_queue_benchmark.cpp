@@ -0,0 +1,168 @@
+// Write queue benchmark — replays a busy FMC write stream (font upload, page
+// redraws and self-test LED flashing) through USBWriteQueue against a
+// simulated USB link: as a plain FIFO, with LED packets keyed by slot, and
+// with keyed LEDs plus priority lanes. Reports queue depth, what actually
+// reaches the wire and how long LED updates wait, then times a font-sized
+// burst through the reserve/commit/pop/release cycle.
+
+#include "usbwritequeue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    constexpr uint8_t kIdentifierByte = 0x32;
+    constexpr int kFontPackets = 400;          // One full glyph upload
+    constexpr int kPagePackets = 16;           // 0xf2 lines of one page redraw
+    constexpr int kPageIntervalMs = 67;        // FMC display update floor
+    constexpr int kFlashingLeds = 12;          // Annunciators toggled by a self-test
+    constexpr int kFlashIntervalMs = 25;
+    constexpr int kPacketsPerMs = 1;           // Interrupt OUT rate of the link
+
+    enum class Mode : unsigned char {
+        FIFO,
+        KEYED,
+        LANES
+    };
+
+    struct Result {
+            size_t maxDepth = 0;
+            double averageDepth = 0.0;
+            uint64_t packetsSent = 0;
+            uint64_t bytesSent = 0;
+            uint64_t superseded = 0;
+            int drainedAtMs = -1;
+            double averageLedLatencyMs = 0.0;
+            int worstLedLatencyMs = 0;
+    };
+
+    void queuePacket(USBWriteQueue &queue, uint8_t fill, WriteLane lane = WriteLane::DISPLAY) {
+        WritePacket *packet = queue.reserve(lane);
+        packet->bytes.fill(fill);
+        packet->length = kWritePacketSize;
+        queue.commit(packet);
+    }
+
+    // The queue time is stamped into the padding so the latency of the value
+    // that finally goes out can be measured.
+    void queueLedPacket(USBWriteQueue &queue, WriteLane lane, uint32_t slotKey, uint8_t led, uint8_t brightness, int ms) {
+        WritePacket *packet = queue.reserve(lane, slotKey);
+        packet->bytes = {0x02, kIdentifierByte, 0xbb, 0x00, 0x00, 0x03, 0x49, led, brightness, static_cast<uint8_t>(ms), static_cast<uint8_t>(ms >> 8), static_cast<uint8_t>(ms >> 16), 0x00, 0x00};
+        packet->length = 14;
+        queue.commit(packet);
+    }
+
+    Result run(int durationMs, Mode mode) {
+        USBWriteQueue queue;
+        Result result;
+        double depthSum = 0.0;
+        double ledLatencySum = 0.0;
+        uint64_t ledsSent = 0;
+        int ticks = 0;
+
+        WriteLane bulkLane = mode == Mode::LANES ? WriteLane::BULK : WriteLane::DISPLAY;
+        WriteLane ledLane = mode == Mode::LANES ? WriteLane::INTERACTIVE : WriteLane::DISPLAY;
+
+        for (int i = 0; i < kFontPackets; ++i) {
+            queuePacket(queue, 0xf0, bulkLane);
+        }
+
+        for (int ms = 0; ; ++ms) {
+            bool producing = ms < durationMs;
+            if (producing && ms % kPageIntervalMs == 0) {
+                for (int i = 0; i < kPagePackets; ++i) {
+                    queuePacket(queue, 0xf2);
+                }
+            }
+
+            if (producing && ms % kFlashIntervalMs == 0) {
+                uint8_t brightness = (ms / kFlashIntervalMs) % 2;
+                for (int led = 0; led < kFlashingLeds; ++led) {
+                    uint8_t index = static_cast<uint8_t>(8 + led);
+                    uint32_t slotKey = mode == Mode::FIFO ? USBWriteQueue::NoSlot : USBWriteQueue::SlotKey(kIdentifierByte, 0xbb, index);
+                    queueLedPacket(queue, ledLane, slotKey, index, brightness, ms);
+                }
+            }
+
+            for (int i = 0; i < kPacketsPerMs && !queue.empty(); ++i) {
+                WritePacket *packet = queue.pop();
+                const auto &bytes = packet->bytes;
+                result.packetsSent++;
+                result.bytesSent += packet->length;
+
+                if (bytes[0] == 0x02) {
+                    int latency = ms - (bytes[9] | (bytes[10] << 8) | (bytes[11] << 16));
+                    ledLatencySum += latency;
+                    result.worstLedLatencyMs = std::max(result.worstLedLatencyMs, latency);
+                    ledsSent++;
+                }
+                queue.release(packet);
+            }
+
+            result.maxDepth = std::max(result.maxDepth, queue.size());
+            depthSum += queue.size();
+            ticks++;
+
+            if (!producing && queue.empty()) {
+                result.drainedAtMs = ms;
+                break;
+            }
+        }
+
+        result.averageDepth = depthSum / ticks;
+        result.superseded = queue.supersededCount();
+        result.averageLedLatencyMs = ledsSent > 0 ? ledLatencySum / ledsSent : 0.0;
+        return result;
+    }
+
+    // Queues a font upload and drains it, as the main and write threads do
+    // under the queue lock. Returns nanoseconds per packet.
+    double burstNanosecondsPerPacket(int bursts) {
+        USBWriteQueue queue;
+        uint64_t checksum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int burst = 0; burst < bursts; ++burst) {
+            for (int i = 0; i < kFontPackets * 3; ++i) {
+                queuePacket(queue, static_cast<uint8_t>(i), WriteLane::BULK);
+            }
+            while (WritePacket *packet = queue.pop()) {
+                checksum += packet->bytes[0];
+                queue.release(packet);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        if (checksum == 0) {
+            printf("  (empty burst)\n");
+        }
+        return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(bursts) * kFontPackets * 3);
+    }
+
+    void print(const char *label, const Result &result) {
+        printf("  %-6s max depth %5zu  avg depth %8.1f  sent %6llu packets / %8llu bytes  superseded %6llu  drained at %d ms  LED latency %.1f ms avg / %d ms worst\n",
+            label, result.maxDepth, result.averageDepth,
+            (unsigned long long) result.packetsSent, (unsigned long long) result.bytesSent,
+            (unsigned long long) result.superseded, result.drainedAtMs,
+            result.averageLedLatencyMs, result.worstLedLatencyMs);
+    }
+}
+
+int main(int argc, char **argv) {
+    int durationMs = argc > 1 ? std::atoi(argv[1]) : 3000;
+    if (durationMs <= 0) {
+        durationMs = 3000;
+    }
+
+    printf("Write queue benchmark over %d ms (%d LEDs flashing every %d ms, page redraw every %d ms, %d packet/ms link)\n",
+        durationMs, kFlashingLeds, kFlashIntervalMs, kPageIntervalMs, kPacketsPerMs);
+    print("fifo", run(durationMs, Mode::FIFO));
+    print("keyed", run(durationMs, Mode::KEYED));
+    print("lanes", run(durationMs, Mode::LANES));
+    printf("  burst  %d-packet upload through reserve/commit/pop/release: %.1f ns/packet\n", kFontPackets * 3, burstNanosecondsPerPacket(200));
+
+    return 0;
+}
@@ -247,8 +247,7 @@ void fmc_setLedBrightness(void* fmcHandle, int ledId, uint8_t brightness) {
 bool fmc_writeData(void* fmcHandle, const uint8_t* data, int length) {
     if (!fmcHandle || !data || length <= 0) return false;
     auto fmc = static_cast<ProductFMC*>(fmcHandle);
-    std::vector<uint8_t> dataVector(data, data + length);
-    return fmc->writeData(dataVector);
+    return fmc->writeData(std::span<const uint8_t>(data, length));
 }
 
 static FontVariant fontVariantFromType(int fontType) {
@@ -271,7 +270,7 @@ static FontVariant fontVariantFromType(int fontType) {
 void fmc_setFont(void* fmcHandle, int fontType) {
     if (!fmcHandle) return;
     auto fmc = static_cast<ProductFMC*>(fmcHandle);
-    fmc->setFont(fontVariantFromType(fontType));
+    fmc->setFont(fontVariantFromType(fontType), true);
 }
 
 void fmc_setScreenLayout(void* fmcHandle, int fontType, int characterHeight, int characterWidth, int x, int y) {
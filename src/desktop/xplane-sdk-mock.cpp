@@ -57,12 +57,20 @@ size_t dataRefHandleToIndex(XPLMDataRef ref) {
 
 XPLMMenuID mainMenuId = 0;
 static std::vector<std::string> registeredCommands = {};
+
+struct MockCommandHandler {
+        XPLMCommandCallback_f handler;
+        void *refcon;
+};
+
+static std::unordered_map<XPLMCommandRef, std::vector<MockCommandHandler>> commandHandlers = {};
 static std::vector<MockDataRef> mockDataRefs = {};
 static std::unordered_map<std::string, size_t> dataRefNameToIndex = {};
 
 // Function to clear all mock dataref storage
 void clearAllMockDataRefs() {
     registeredCommands.clear();
+    commandHandlers.clear();
     mockDataRefs.clear();
     dataRefNameToIndex.clear();
 }
@@ -389,12 +397,28 @@ int XPLMGetDatavi(XPLMDataRef ref, int *values, int offset, int max) {
 }
 
 void XPLMRegisterCommandHandler(XPLMDataRef ref, XPLMCommandCallback_f handler, int before, void *refcon) {
+    commandHandlers[ref].push_back({handler, refcon});
+}
+
+// Utility function to deliver a command to its registered handlers, the way X-Plane would (for testing purposes)
+void triggerMockCommand(XPLMCommandRef ref, int phase) {
+    auto it = commandHandlers.find(ref);
+    if (it == commandHandlers.end()) {
+        return;
+    }
+
+    for (const auto &entry : it->second) {
+        entry.handler(ref, phase, entry.refcon);
+    }
 }
 
 // Mock implementations for missing XPLM functions
 
 void XPLMUnregisterCommandHandler(XPLMDataRef ref, XPLMCommandCallback_f handler, int before, void *refcon) {
     printf("Unregistering command handler\n");
+    std::erase_if(commandHandlers[ref], [&](const MockCommandHandler &entry) {
+        return entry.handler == handler && entry.refcon == refcon;
+    });
 }
 
 void XPLMUnregisterDataAccessor(XPLMDataRef ref) {
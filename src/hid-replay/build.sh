@@ -0,0 +1,16 @@
+#!/bin/bash
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+BUILD_DIR="$SCRIPT_DIR/build"
+
+mkdir -p "$BUILD_DIR"
+cd "$BUILD_DIR"
+
+cmake "$SCRIPT_DIR"
+
+make -j"$(nproc)"
+
+echo ""
+echo "Build complete:"
+echo "  $BUILD_DIR/hid-replay <capture.hidcap> [--speed <factor>] [--fps <rate>] [--dataref <name>]..."
@@ -0,0 +1,253 @@
+// HID replay — plays a capture recorded with the plugin's "Capture HID
+// traffic" menu item back into the product it was recorded from, against the
+// desktop X-Plane SDK mock. Captured input reports go through the device's
+// input filter and didReceiveData() exactly like reports read from hidraw;
+// the product's writes go out through the real Linux writer into one end of
+// a socket pair standing in for the hidraw node, and a null sink drains the
+// other end.
+//
+// Input is grouped into simulated sim frames by its capture timestamps, not
+// by when the replay gets to it, so the reports each frame hands to the
+// product are the same on every run and every machine. The writer and the
+// device tick still run on the host's clock, so output timing varies.
+
+#include "appstate.h"
+#include "usbcontroller.h"
+#include "usbdevice.h"
+#include "usbtrafficcapture.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <XPLMDataAccess.h>
+#include <XPLMUtilities.h>
+
+// Provided by desktop/xplane-sdk-mock.cpp
+XPLMDataRef createMockDataRefWithInference(const char *name, XPLMDataTypeID preferredType);
+
+// Not part of the mock; the desktop app defines it in bridge.mm.
+void XPLMGetVersions(int *outXPlaneVersion, int *outXPLMVersion, XPLMHostApplicationID *outHostID) {
+    if (outXPlaneVersion) {
+        *outXPlaneVersion = 12000;
+    }
+    if (outXPLMVersion) {
+        *outXPLMVersion = 400;
+    }
+    if (outHostID) {
+        *outHostID = 1;
+    }
+}
+
+namespace {
+    constexpr double kDefaultFramesPerSecond = 60.0;
+
+    // How long the writer gets to flush what the replay queued.
+    constexpr auto kDrainTimeout = std::chrono::seconds(5);
+
+    struct ReplayOptions {
+            std::string capturePath;
+            double speed = 1.0;
+            double framesPerSecond = kDefaultFramesPerSecond;
+            std::vector<std::string> datarefs;
+    };
+
+    struct NullSink {
+            int fd = -1;
+            std::atomic<uint64_t> packets{0};
+            std::atomic<uint64_t> bytes{0};
+            std::thread thread;
+
+            void run() {
+                uint8_t buffer[256];
+                while (true) {
+                    ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+                    if (length < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (length <= 0) {
+                        break;
+                    }
+                    packets.fetch_add(1, std::memory_order_relaxed);
+                    bytes.fetch_add(static_cast<uint64_t>(length), std::memory_order_relaxed);
+                }
+            }
+    };
+
+    void printUsage(const char *program) {
+        fprintf(stderr, "Usage: %s <capture.hidcap> [--speed <factor>] [--fps <rate>] [--dataref <name>]...\n", program);
+        fprintf(stderr, "  --speed    playback speed relative to the capture, 0 for as fast as possible (default 1)\n");
+        fprintf(stderr, "  --fps      simulated sim frame rate input is grouped by (default %.0f)\n", kDefaultFramesPerSecond);
+        fprintf(stderr, "  --dataref  creates a mock dataref before the profile is chosen, e.g. AirbusFBW/DUBrightness\n");
+    }
+
+    bool parseOptions(int argc, char **argv, ReplayOptions &options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string argument = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (argument == "--speed" && hasValue) {
+                options.speed = std::atof(argv[++i]);
+            } else if (argument == "--fps" && hasValue) {
+                options.framesPerSecond = std::atof(argv[++i]);
+            } else if (argument == "--dataref" && hasValue) {
+                options.datarefs.push_back(argv[++i]);
+            } else if (options.capturePath.empty() && !argument.starts_with("--")) {
+                options.capturePath = argument;
+            } else {
+                return false;
+            }
+        }
+
+        return !options.capturePath.empty() && options.speed >= 0.0 && options.framesPerSecond > 0.0;
+    }
+
+    double percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0.0;
+        }
+
+        size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+}
+
+int main(int argc, char **argv) {
+    ReplayOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    TrafficCapture capture;
+    if (!USBTrafficCapture::load(options.capturePath, capture)) {
+        return 1;
+    }
+
+    std::vector<const CapturedReport *> inputs;
+    size_t capturedOutputs = 0;
+    for (const CapturedReport &report : capture.reports) {
+        if (report.direction == CaptureDirection::INPUT) {
+            inputs.push_back(&report);
+        } else {
+            capturedOutputs++;
+        }
+    }
+
+    // SOCK_SEQPACKET keeps report boundaries, like reads and writes on hidraw.
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) < 0) {
+        fprintf(stderr, "socketpair failed: %s\n", strerror(errno));
+        return 1;
+    }
+    fcntl(sockets[0], F_SETFL, fcntl(sockets[0], F_GETFL) | O_NONBLOCK);
+
+    NullSink sink;
+    sink.fd = sockets[1];
+    sink.thread = std::thread(&NullSink::run, &sink);
+
+    for (const std::string &dataref : options.datarefs) {
+        createMockDataRefWithInference(dataref.c_str(), xplmType_Unknown);
+    }
+
+    AppState::getInstance()->pluginInitialized = true;
+    USBDevice *device = USBDevice::Device(sockets[0], capture.vendorId, capture.productId, "WINCTRL", capture.productName);
+    if (!device || !device->connected) {
+        fprintf(stderr, "No product handles 0x%04X:0x%04X (%s)\n", capture.vendorId, capture.productId, capture.productName.c_str());
+        if (device) {
+            delete device;
+        } else {
+            close(sockets[0]);
+        }
+        sink.thread.join();
+        return 1;
+    }
+
+    // Ticked by AppState::update() like a hot-plugged device.
+    USBController::getInstance()->devices.push_back(device);
+    device->loadProfileForCurrentAircraft();
+    if (!device->profileReady) {
+        fprintf(stderr, "Warning: no aircraft profile selected for %s, input will be ignored; pass --dataref\n", device->classIdentifier());
+    }
+
+    double frameIntervalMicroseconds = 1e6 / options.framesPerSecond;
+    std::vector<double> frameMicroseconds;
+    size_t nextInput = 0;
+    auto replayStart = std::chrono::steady_clock::now();
+
+    for (uint64_t frame = 0; nextInput < inputs.size(); ++frame) {
+        if (options.speed == 0.0) {
+            // Nothing to simulate between inputs when not keeping time.
+            double nextTimestamp = static_cast<double>(inputs[nextInput]->timestampMicroseconds);
+            frame = std::max(frame, static_cast<uint64_t>(std::ceil(nextTimestamp / frameIntervalMicroseconds)));
+        }
+
+        double frameTime = frame * frameIntervalMicroseconds;
+        if (options.speed > 0.0) {
+            auto due = std::chrono::duration<double, std::micro>(frameTime / options.speed);
+            std::this_thread::sleep_until(replayStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(due));
+        }
+
+        while (nextInput < inputs.size() && static_cast<double>(inputs[nextInput]->timestampMicroseconds) <= frameTime) {
+            const std::vector<uint8_t> &bytes = inputs[nextInput]->bytes;
+            device->processOnMainThread(bytes.data(), static_cast<int>(bytes.size()));
+            nextInput++;
+        }
+
+        auto frameStart = std::chrono::steady_clock::now();
+        AppState::Update(0.0f, 0.0f, 1, nullptr);
+        frameMicroseconds.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - frameStart).count());
+    }
+
+    auto replayEnd = std::chrono::steady_clock::now();
+    auto drainDeadline = replayEnd + kDrainTimeout;
+    while (device->getWriteQueueSize() > 0 && std::chrono::steady_clock::now() < drainDeadline) {
+        AppState::Update(0.0f, 0.0f, 1, nullptr);
+        std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>(frameIntervalMicroseconds)));
+    }
+    double drainSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayEnd).count();
+    double replaySeconds = std::chrono::duration<double>(replayEnd - replayStart).count();
+    double captureSeconds = capture.reports.empty() ? 0.0 : capture.reports.back().timestampMicroseconds / 1e6;
+
+    double frameAverage = 0.0;
+    for (double microseconds : frameMicroseconds) {
+        frameAverage += microseconds / frameMicroseconds.size();
+    }
+
+    printf("\nReplay of %s: %s (0x%04X:0x%04X, %s, profile %s)\n", options.capturePath.c_str(), capture.productName.c_str(), capture.vendorId, capture.productId, device->classIdentifier(), device->activeProfileName());
+    printf("  capture   %zu input and %zu output reports over %.2f s\n", inputs.size(), capturedOutputs, captureSeconds);
+    printf("  replay    %.2f s at speed %g, %zu frames at %.0f fps (%.0f input reports/s), %.2f s to drain\n", replaySeconds, options.speed, frameMicroseconds.size(), options.framesPerSecond, replaySeconds > 0.0 ? inputs.size() / replaySeconds : 0.0, drainSeconds);
+    printf("  frames    %.1f us avg, %.1f us p99, %.1f us worst\n", frameAverage, percentile(frameMicroseconds, 0.99), percentile(frameMicroseconds, 1.0));
+
+    InputFilterStats inputStats = device->getInputStats();
+    printf("  input     %llu received, %llu unchanged, %llu ignored, %llu coalesced, %llu dropped on overflow\n", (unsigned long long) inputStats.received, (unsigned long long) inputStats.unchanged, (unsigned long long) inputStats.ignored, (unsigned long long) inputStats.coalesced, (unsigned long long) inputStats.overflows);
+    printf("  output    %llu packets (%llu bytes) written, %zu still queued\n", (unsigned long long) sink.packets.load(), (unsigned long long) sink.bytes.load(), device->getWriteQueueSize());
+
+    static constexpr const char *laneNames[kWriteLaneCount] = {"interactive", "display", "bulk"};
+    auto laneStats = device->getWriteQueueStats();
+    for (size_t lane = 0; lane < kWriteLaneCount; ++lane) {
+        const WriteLaneStats &stats = laneStats[lane];
+        printf("  %-11s %llu sent, %llu superseded, latency %.2f ms avg / %.2f ms worst\n", laneNames[lane], (unsigned long long) stats.sent, (unsigned long long) stats.superseded, stats.averageLatencyMilliseconds, stats.worstLatencyMilliseconds);
+    }
+
+    DisplayPacingStats pacingStats = device->getDisplayPacingStats();
+    printf("  pacing    %.0f packets/s drained, %.3f ms per write, %.1f redraws/s at %.1f packets each\n", pacingStats.packetsPerSecond, pacingStats.writeLatencyMilliseconds, pacingStats.framesPerSecond, pacingStats.packetsPerFrame);
+
+    // Closes the device's end of the socket pair, which ends the sink.
+    USBController::getInstance()->disconnectAllDevices();
+    sink.thread.join();
+    close(sink.fd);
+    USBController::getInstance()->destroy();
+
+    return 0;
+}
@@ -8,13 +8,31 @@
 #include "usbdevice.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
+#include <functional>
+#include <iterator>
 #include <XPLMProcessing.h>
 
 AppState *AppState::instance = nullptr;
 
+namespace {
+    constexpr const char *kPreferencesSection = "Preferences";
+    constexpr auto kPreferencesFlushDelay = std::chrono::milliseconds(500);
+    constexpr int kDefaultFrameBudgetMicroseconds = 500;
+}
+
 AppState::AppState() {
     pluginInitialized = false;
+    nextTaskId = 1;
+    preferencesLoaded = false;
+    preferencesDirty = false;
+    stopPreferencesFlush = false;
+    frameBudget = std::chrono::microseconds(kDefaultFrameBudgetMicroseconds);
+    frameStats = {};
+    frameStats.budgetMicroseconds = kDefaultFrameBudgetMicroseconds;
 }
 
 AppState::~AppState() {
@@ -40,6 +58,12 @@ bool AppState::initialize() {
 
     pluginInitialized = true;
 
+    if (!preferencesLoaded) {
+        loadPreferences();
+    }
+    startPreferencesFlush();
+    setFrameBudget(std::chrono::microseconds(readPreferenceInt("FrameBudgetMicroseconds", kDefaultFrameBudgetMicroseconds)));
+
 #ifdef DEBUG
     Dataref::getInstance()->createCommand(
         PRODUCT_NAME "/debug/disconnect_all_devices", "Disconnects all devices", [this](XPLMCommandPhase inPhase) {
@@ -77,11 +101,21 @@ void AppState::deinitialize() {
 
     Dataref::getInstance()->destroyAllBindings();
 
+    stopPreferencesFlushAndSave();
+
     pluginInitialized = false;
 
     {
         std::lock_guard<std::mutex> lock(taskQueueMutex);
-        taskQueue.clear();
+        tasks.clear();
+        taskHeap.clear();
+        debouncedTasks.clear();
+        ownerTasks.clear();
+        budgetedTasks.clear();
+        budgetedTaskIndex.clear();
+        for (auto &queue : budgetedQueues) {
+            queue.clear();
+        }
     }
 
     instance = nullptr;
@@ -101,24 +135,30 @@ float AppState::Update(float inElapsedSinceLastCall, float inElapsedTimeSinceLas
 
 void AppState::update() {
     auto now = std::chrono::steady_clock::now();
+    auto frameStart = now;
 
-    // Collect ready tasks under the lock, leaving non-ready tasks in the queue.
-    // Executing outside the lock lets callbacks safely call executeAfter without
-    // risk of reallocation invalidating the functor currently on the call stack.
+    // Pop due tasks under the lock, in deadline order. Executing outside the
+    // lock lets callbacks safely call executeAfter without risk of
+    // reallocation invalidating the functor currently on the call stack.
     std::vector<DelayedTask> readyTasks;
     {
         std::lock_guard<std::mutex> lock(taskQueueMutex);
         cancelledOwners.clear();
-        std::vector<DelayedTask> remaining;
-        remaining.reserve(taskQueue.size());
-        for (auto &task : taskQueue) {
-            if (now >= task.runAt) {
-                readyTasks.push_back(std::move(task));
-            } else {
-                remaining.push_back(std::move(task));
+        while (!taskHeap.empty() && taskHeap.front().runAt <= now) {
+            std::pop_heap(taskHeap.begin(), taskHeap.end(), std::greater<>{});
+            ScheduledTask entry = taskHeap.back();
+            taskHeap.pop_back();
+
+            auto it = tasks.find(entry.id);
+            if (it == tasks.end() || it->second.runAt != entry.runAt) {
+                // Cancelled, or re-armed to a later deadline
+                continue;
             }
+
+            forgetTask(entry.id, it->second);
+            readyTasks.push_back(std::move(it->second));
+            tasks.erase(it);
         }
-        taskQueue = std::move(remaining);
     }
 
     for (auto &task : readyTasks) {
@@ -131,7 +171,7 @@ void AppState::update() {
         // owner so tasks already extracted into the batch are skipped too.
         if (task.owner) {
             std::lock_guard<std::mutex> lock(taskQueueMutex);
-            if (std::find(cancelledOwners.begin(), cancelledOwners.end(), task.owner) != cancelledOwners.end()) {
+            if (cancelledOwners.contains(task.owner)) {
                 continue;
             }
         }
@@ -143,32 +183,179 @@ void AppState::update() {
         return;
     }
 
-    Dataref::getInstance()->update();
+    // Dataref polling and device refresh run on a fixed tick so their cost
+    // does not scale with the sim's frame rate. Frames in between only drain
+    // device input, so button presses are still handled immediately.
+    auto tickInterval = std::chrono::milliseconds(DEVICE_TICK_INTERVAL_MILLISECONDS);
+    if (now >= nextDeviceTick) {
+        nextDeviceTick += tickInterval;
+        if (nextDeviceTick <= now) {
+            nextDeviceTick = now + tickInterval;
+        }
+
+        Dataref::getInstance()->update();
+
+        for (auto *device : USBController::getInstance()->devices) {
+            device->update();
+        }
+    } else {
+        for (auto *device : USBController::getInstance()->devices) {
+            device->processInput();
+        }
+    }
+
+    runBudgetedTasks(frameStart);
+
+    int frameMicroseconds = static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frameStart).count());
+    frameStats.frames++;
+    frameStats.lastFrameMicroseconds = frameMicroseconds;
+    frameStats.worstFrameMicroseconds = std::max(frameStats.worstFrameMicroseconds, frameMicroseconds);
+    if (frameMicroseconds > frameStats.budgetMicroseconds) {
+        frameStats.overrunFrames++;
+    }
+}
+
+void AppState::runBudgetedTasks(std::chrono::steady_clock::time_point frameStart) {
+    // At least one task runs every frame so deferred work still makes
+    // progress when the mandatory work alone exceeds the budget.
+    bool ranAny = false;
+    while (!ranAny || std::chrono::steady_clock::now() - frameStart < frameBudget) {
+        BudgetedTask task;
+        {
+            std::lock_guard<std::mutex> lock(taskQueueMutex);
+            bool found = false;
+            for (size_t level = 0; level < std::size(budgetedQueues) && !found; ++level) {
+                auto &queue = budgetedQueues[level];
+                while (!queue.empty()) {
+                    uint64_t id = queue.front();
+                    queue.pop_front();
+
+                    auto it = budgetedTasks.find(id);
+                    if (it == budgetedTasks.end() || static_cast<size_t>(it->second.priority) != level) {
+                        // Cancelled, or promoted to a higher priority queue
+                        continue;
+                    }
+
+                    task = std::move(it->second);
+                    budgetedTasks.erase(it);
+                    budgetedTaskIndex.erase({task.owner, task.name});
+                    if (task.owner) {
+                        auto ownerIt = ownerTasks.find(task.owner);
+                        if (ownerIt != ownerTasks.end()) {
+                            ownerIt->second.erase(id);
+                            if (ownerIt->second.empty()) {
+                                ownerTasks.erase(ownerIt);
+                            }
+                        }
+                    }
+                    found = true;
+                    break;
+                }
+            }
+
+            frameStats.budgetedTasksPending = budgetedTasks.size();
+            if (!found) {
+                return;
+            }
+
+            if (task.owner && cancelledOwners.contains(task.owner)) {
+                continue;
+            }
+        }
+
+        ranAny = true;
+        frameStats.budgetedTasksRun++;
+        if (task.func) {
+            task.func();
+        }
+    }
+}
+
+void AppState::scheduleTask(DelayedTask task) {
+    uint64_t id = nextTaskId++;
+    taskHeap.push_back({task.runAt, id});
+    std::push_heap(taskHeap.begin(), taskHeap.end(), std::greater<>{});
+
+    if (task.owner) {
+        ownerTasks[task.owner].insert(id);
+    }
+    if (!task.name.empty()) {
+        debouncedTasks[{task.owner, task.name}] = id;
+    }
+    tasks.emplace(id, std::move(task));
+}
 
-    for (auto *device : USBController::getInstance()->devices) {
-        device->update();
+void AppState::forgetTask(uint64_t id, const DelayedTask &task) {
+    if (task.owner) {
+        auto it = ownerTasks.find(task.owner);
+        if (it != ownerTasks.end()) {
+            it->second.erase(id);
+            if (it->second.empty()) {
+                ownerTasks.erase(it);
+            }
+        }
+    }
+    if (!task.name.empty()) {
+        debouncedTasks.erase({task.owner, task.name});
     }
 }
 
 void AppState::executeAfter(int milliseconds, void *owner, std::function<void()> func) {
     std::lock_guard<std::mutex> lock(taskQueueMutex);
-    taskQueue.push_back({"", owner, std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds), func});
+    scheduleTask({"", owner, std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds), std::move(func)});
 }
 
 void AppState::executeAfterDebounced(std::string taskName, int milliseconds, void *owner, std::function<void()> func) {
-    auto now = std::chrono::steady_clock::now();
+    auto runAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
     std::lock_guard<std::mutex> lock(taskQueueMutex);
-    auto it = std::find_if(taskQueue.begin(), taskQueue.end(), [&](const DelayedTask &t) {
-        return t.owner == owner && t.name == taskName;
-    });
-
-    if (it != taskQueue.end()) {
-        it->runAt = now + std::chrono::milliseconds(milliseconds);
-        it->owner = owner;
-        it->func = func;
-    } else {
-        taskQueue.push_back({taskName, owner, now + std::chrono::milliseconds(milliseconds), func});
+    auto it = debouncedTasks.find({owner, taskName});
+    if (it == debouncedTasks.end()) {
+        scheduleTask({std::move(taskName), owner, runAt, std::move(func)});
+        return;
+    }
+
+    // Re-arm in place; the heap entry for the old deadline goes stale
+    DelayedTask &task = tasks.at(it->second);
+    task.runAt = runAt;
+    task.func = std::move(func);
+    taskHeap.push_back({runAt, it->second});
+    std::push_heap(taskHeap.begin(), taskHeap.end(), std::greater<>{});
+}
+
+void AppState::executeWithinFrameBudget(std::string taskName, FrameWorkPriority priority, void *owner, std::function<void()> func) {
+    std::lock_guard<std::mutex> lock(taskQueueMutex);
+    auto it = budgetedTaskIndex.find({owner, taskName});
+    if (it != budgetedTaskIndex.end()) {
+        // Already queued; the latest request replaces the pending one
+        BudgetedTask &task = budgetedTasks.at(it->second);
+        task.func = std::move(func);
+        if (priority < task.priority) {
+            task.priority = priority;
+            budgetedQueues[static_cast<size_t>(priority)].push_back(it->second);
+        }
+        return;
+    }
+
+    uint64_t id = nextTaskId++;
+    budgetedQueues[static_cast<size_t>(priority)].push_back(id);
+    if (owner) {
+        ownerTasks[owner].insert(id);
     }
+    budgetedTaskIndex[{owner, taskName}] = id;
+    budgetedTasks.emplace(id, BudgetedTask{std::move(taskName), owner, priority, std::move(func)});
+}
+
+void AppState::setFrameBudget(std::chrono::microseconds budget) {
+    if (budget.count() <= 0) {
+        budget = std::chrono::microseconds(kDefaultFrameBudgetMicroseconds);
+    }
+
+    frameBudget = budget;
+    frameStats.budgetMicroseconds = static_cast<int>(budget.count());
+}
+
+const FrameBudgetStats &AppState::getFrameBudgetStats() {
+    return frameStats;
 }
 
 void AppState::cancelTasksForOwner(void *owner) {
@@ -177,43 +364,216 @@ void AppState::cancelTasksForOwner(void *owner) {
     }
 
     std::lock_guard<std::mutex> lock(taskQueueMutex);
-    taskQueue.erase(
-        std::remove_if(taskQueue.begin(), taskQueue.end(),
-            [owner](const DelayedTask &t) {
-                return t.owner == owner;
-            }),
-        taskQueue.end());
-    cancelledOwners.push_back(owner);
+    auto it = ownerTasks.find(owner);
+    if (it != ownerTasks.end()) {
+        for (uint64_t id : it->second) {
+            auto budgetedIt = budgetedTasks.find(id);
+            if (budgetedIt != budgetedTasks.end()) {
+                budgetedTaskIndex.erase({owner, budgetedIt->second.name});
+                budgetedTasks.erase(budgetedIt);
+                continue;
+            }
+
+            auto taskIt = tasks.find(id);
+            if (taskIt == tasks.end()) {
+                continue;
+            }
+            if (!taskIt->second.name.empty()) {
+                debouncedTasks.erase({owner, taskIt->second.name});
+            }
+            tasks.erase(taskIt);
+        }
+        ownerTasks.erase(it);
+    }
+    cancelledOwners.insert(owner);
 }
 
-std::string AppState::readPreference(const std::string &key, const std::string &defaultValue) {
+void AppState::loadPreferences() {
+    // Resolved here, on the main thread: the flush thread saves to it and
+    // must not call into the SDK itself.
+    std::string path = getPluginDirectory() + "/preferences.ini";
     CSimpleIniA ini;
     ini.SetUnicode();
-    SI_Error rc = ini.LoadFile((getPluginDirectory() + "/preferences.ini").c_str());
+    SI_Error rc = ini.LoadFile(path.c_str());
+
+    std::lock_guard<std::mutex> lock(preferencesMutex);
+    preferencesPath = path;
+    preferences.clear();
+    preferencesDirty = false;
+    preferencesLoaded = true;
     if (rc < 0) {
-        return defaultValue;
+        // File might not exist yet, start with defaults
+        return;
     }
 
-    const char *value = ini.GetValue("Preferences", key.c_str(), defaultValue.c_str());
-    return std::string(value);
+    CSimpleIniA::TNamesDepend keys;
+    ini.GetAllKeys(kPreferencesSection, keys);
+    for (const auto &key : keys) {
+        const char *value = ini.GetValue(kPreferencesSection, key.pItem, "");
+        preferences[key.pItem] = value;
+    }
 }
 
-void AppState::writePreference(const std::string &key, const std::string &value) {
+void AppState::savePreferences(const std::string &path, const std::unordered_map<std::string, std::string> &values) {
+    // Start from the file on disk so sections and keys this plugin does not
+    // know about survive the save.
     CSimpleIniA ini;
     ini.SetUnicode();
-    SI_Error rc = ini.LoadFile((getPluginDirectory() + "/preferences.ini").c_str());
-    if (rc < 0) {
-        // File might not exist yet, continue
-    }
+    ini.LoadFile(path.c_str());
 
-    ini.SetValue("Preferences", key.c_str(), value.c_str());
+    for (const auto &[key, value] : values) {
+        ini.SetValue(kPreferencesSection, key.c_str(), value.c_str());
+    }
 
-    rc = ini.SaveFile((getPluginDirectory() + "/preferences.ini").c_str());
+    SI_Error rc = ini.SaveFile(path.c_str());
     if (rc < 0) {
         Logger::getInstance()->info("Failed to save preferences file.\n");
     }
 }
 
+void AppState::startPreferencesFlush() {
+    {
+        std::lock_guard<std::mutex> lock(preferencesMutex);
+        stopPreferencesFlush = false;
+    }
+    preferencesFlushThread = std::thread(&AppState::preferencesFlushLoop, this);
+}
+
+void AppState::stopPreferencesFlushAndSave() {
+    {
+        std::lock_guard<std::mutex> lock(preferencesMutex);
+        stopPreferencesFlush = true;
+    }
+    preferencesCV.notify_all();
+    if (preferencesFlushThread.joinable()) {
+        preferencesFlushThread.join();
+    }
+
+    // Anything written since the last background flush is saved here
+    std::string path;
+    std::unordered_map<std::string, std::string> values;
+    {
+        std::lock_guard<std::mutex> lock(preferencesMutex);
+        if (!preferencesDirty) {
+            return;
+        }
+        path = preferencesPath;
+        values = preferences;
+        preferencesDirty = false;
+    }
+    savePreferences(path, values);
+}
+
+void AppState::preferencesFlushLoop() {
+    std::unique_lock<std::mutex> lock(preferencesMutex);
+    while (true) {
+        preferencesCV.wait(lock, [this] { return preferencesDirty || stopPreferencesFlush; });
+        if (stopPreferencesFlush) {
+            return;
+        }
+
+        // Let a burst of writes (e.g. clicking through a menu) settle first
+        auto flushAt = lastPreferenceWrite + kPreferencesFlushDelay;
+        if (std::chrono::steady_clock::now() < flushAt) {
+            preferencesCV.wait_until(lock, flushAt);
+            continue;
+        }
+
+        auto path = preferencesPath;
+        auto values = preferences;
+        preferencesDirty = false;
+        lock.unlock();
+        savePreferences(path, values);
+        lock.lock();
+    }
+}
+
+std::string AppState::readPreference(const std::string &key, const std::string &defaultValue) {
+    if (!preferencesLoaded) {
+        loadPreferences();
+    }
+
+    std::lock_guard<std::mutex> lock(preferencesMutex);
+    auto it = preferences.find(key);
+    if (it == preferences.end()) {
+        return defaultValue;
+    }
+
+    return it->second;
+}
+
+void AppState::writePreference(const std::string &key, const std::string &value) {
+    if (!preferencesLoaded) {
+        loadPreferences();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(preferencesMutex);
+        auto it = preferences.find(key);
+        if (it != preferences.end() && it->second == value) {
+            return;
+        }
+
+        preferences[key] = value;
+        preferencesDirty = true;
+        lastPreferenceWrite = std::chrono::steady_clock::now();
+    }
+    preferencesCV.notify_all();
+}
+
+bool AppState::readPreferenceBool(const std::string &key, bool defaultValue) {
+    std::string value = readPreference(key, "");
+    if (value == "1" || value == "true" || value == "yes" || value == "on" || value == "enabled") {
+        return true;
+    }
+
+    if (value == "0" || value == "false" || value == "no" || value == "off" || value == "disabled") {
+        return false;
+    }
+
+    return defaultValue;
+}
+
+int AppState::readPreferenceInt(const std::string &key, int defaultValue) {
+    std::string value = readPreference(key, "");
+    int result = defaultValue;
+    auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (ec != std::errc() || ptr != value.data() + value.size()) {
+        return defaultValue;
+    }
+
+    return result;
+}
+
+float AppState::readPreferenceFloat(const std::string &key, float defaultValue) {
+    std::string value = readPreference(key, "");
+    if (value.empty()) {
+        return defaultValue;
+    }
+
+    char *end = nullptr;
+    float result = std::strtof(value.c_str(), &end);
+    if (*end != '\0') {
+        return defaultValue;
+    }
+
+    return result;
+}
+
+void AppState::writePreferenceBool(const std::string &key, bool value) {
+    writePreference(key, value ? "true" : "false");
+}
+
+void AppState::writePreferenceInt(const std::string &key, int value) {
+    writePreference(key, std::to_string(value));
+}
+
+void AppState::writePreferenceFloat(const std::string &key, float value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%g", value);
+    writePreference(key, buffer);
+}
+
 std::string AppState::getPluginDirectory() {
     char systemPath[512];
     XPLMGetSystemPath(systemPath);
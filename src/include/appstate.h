@@ -1,10 +1,17 @@
 #ifndef APPSTATE_H
 #define APPSTATE_H
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 struct DelayedTask {
@@ -14,17 +21,104 @@ struct DelayedTask {
         std::function<void()> func;
 };
 
+// Heap entry for a task. It goes stale when the task is re-armed, cancelled
+// or run, and is dropped when it reaches the top of the heap.
+struct ScheduledTask {
+        std::chrono::steady_clock::time_point runAt;
+        uint64_t id;
+
+        bool operator>(const ScheduledTask &other) const {
+            return runAt != other.runAt ? runAt > other.runAt : id > other.id;
+        }
+};
+
+enum class FrameWorkPriority : unsigned char {
+    HIGH,
+    NORMAL,
+    LOW
+};
+
+// Deferrable main-thread work, run after the mandatory per-frame work while
+// the frame budget lasts. Keyed by (owner, name) so repeated requests for the
+// same work coalesce into one run.
+struct BudgetedTask {
+        std::string name;
+        void *owner;
+        FrameWorkPriority priority;
+        std::function<void()> func;
+};
+
+struct FrameBudgetStats {
+        uint64_t frames;
+        uint64_t overrunFrames;
+        int budgetMicroseconds;
+        int lastFrameMicroseconds;
+        int worstFrameMicroseconds;
+        uint64_t budgetedTasksRun;
+        size_t budgetedTasksPending;
+};
+
+struct DebounceKey {
+        void *owner;
+        std::string name;
+
+        bool operator==(const DebounceKey &other) const = default;
+};
+
+struct DebounceKeyHash {
+        size_t operator()(const DebounceKey &key) const {
+            return std::hash<void *>{}(key.owner) ^ (std::hash<std::string>{}(key.name) << 1);
+        }
+};
+
 class AppState {
     private:
         AppState();
         ~AppState();
 
         static AppState *instance;
-        std::vector<DelayedTask> taskQueue;
-        std::vector<void *> cancelledOwners;
+        // Tasks by id, ordered by a min-heap on (deadline, id) so update() only
+        // touches tasks that are due. Debounced tasks and per-owner task sets
+        // are indexed so re-arming and cancelling never scan the queue.
+        std::unordered_map<uint64_t, DelayedTask> tasks;
+        std::vector<ScheduledTask> taskHeap;
+        std::unordered_map<DebounceKey, uint64_t, DebounceKeyHash> debouncedTasks;
+        std::unordered_map<void *, std::unordered_set<uint64_t>> ownerTasks;
+        std::unordered_set<void *> cancelledOwners;
+        uint64_t nextTaskId;
         std::mutex taskQueueMutex;
+        void scheduleTask(DelayedTask task);
+        void forgetTask(uint64_t id, const DelayedTask &task);
         void update();
 
+        // Budgeted work shares task ids and the per-owner index with delayed
+        // tasks so cancelTasksForOwner covers both.
+        std::unordered_map<uint64_t, BudgetedTask> budgetedTasks;
+        std::deque<uint64_t> budgetedQueues[3];
+        std::unordered_map<DebounceKey, uint64_t, DebounceKeyHash> budgetedTaskIndex;
+        std::chrono::steady_clock::time_point nextDeviceTick;
+        std::chrono::microseconds frameBudget;
+        FrameBudgetStats frameStats;
+        void runBudgetedTasks(std::chrono::steady_clock::time_point frameStart);
+
+        // preferences.ini is parsed once and served from memory. Writes mark
+        // the cache dirty and a background thread saves it once writes have
+        // been quiet for a moment, so the flight loop never touches disk.
+        std::unordered_map<std::string, std::string> preferences;
+        std::string preferencesPath; // Resolved by loadPreferences() on the main thread
+        std::atomic<bool> preferencesLoaded;
+        bool preferencesDirty;
+        bool stopPreferencesFlush;
+        std::chrono::steady_clock::time_point lastPreferenceWrite;
+        std::mutex preferencesMutex;
+        std::condition_variable preferencesCV;
+        std::thread preferencesFlushThread;
+        void loadPreferences();
+        void savePreferences(const std::string &path, const std::unordered_map<std::string, std::string> &values);
+        void preferencesFlushLoop();
+        void startPreferencesFlush();
+        void stopPreferencesFlushAndSave();
+
     public:
         static float Update(float inElapsedSinceLastCall, float inElapsedTimeSinceLastFlightLoop, int inCounter, void *inRefcon);
 
@@ -37,10 +131,19 @@ class AppState {
 
         void executeAfter(int milliseconds, void *owner, std::function<void()> func);
         void executeAfterDebounced(std::string taskName, int milliseconds, void *owner, std::function<void()> func);
+        void executeWithinFrameBudget(std::string taskName, FrameWorkPriority priority, void *owner, std::function<void()> func);
         void cancelTasksForOwner(void *owner);
+        void setFrameBudget(std::chrono::microseconds budget);
+        const FrameBudgetStats &getFrameBudgetStats();
 
         std::string readPreference(const std::string &key, const std::string &defaultValue);
         void writePreference(const std::string &key, const std::string &value);
+        bool readPreferenceBool(const std::string &key, bool defaultValue);
+        int readPreferenceInt(const std::string &key, int defaultValue);
+        float readPreferenceFloat(const std::string &key, float defaultValue);
+        void writePreferenceBool(const std::string &key, bool value);
+        void writePreferenceInt(const std::string &key, int value);
+        void writePreferenceFloat(const std::string &key, float value);
 };
 
 #endif
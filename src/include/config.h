@@ -11,6 +11,7 @@
 
 #define REFRESH_INTERVAL_SECONDS_SLOW 5.0
 #define REFRESH_INTERVAL_SECONDS_FAST -1
+#define DEVICE_TICK_INTERVAL_MILLISECONDS 20
 
 #define WINCTRL_VENDOR_ID 0x4098
 
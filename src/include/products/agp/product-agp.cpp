@@ -4,6 +4,7 @@
 #include "config.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/pa28-agp-profile.h"
 #include "profiles/rotatemd11-agp-profile.h"
 #include "profiles/toliss-agp-profile.h"
@@ -17,13 +18,23 @@
 #include <unordered_map>
 #include <XPLMUtilities.h>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using AGPProfiles = ProfileRegistry<ProductAGP, AGPAircraftProfile,
+    XCraftsEjetsAGPProfile,
+    RotateMD11AGPProfile,
+    XCraftsErjAGPProfile,
+    ZiboAGPProfile,
+    TolissAGPProfile,
+    PA28AGPProfile>;
+
 ProductAGP::ProductAGP(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -48,30 +59,32 @@ const char *ProductAGP::activeProfileName() const {
 }
 
 void ProductAGP::setProfileForCurrentAircraft() {
-    if (XCraftsEjetsAGPProfile::IsEligible()) {
-        profile = new XCraftsEjetsAGPProfile(this);
-        profileReady = true;
-    } else if (RotateMD11AGPProfile::IsEligible()) {
-        profile = new RotateMD11AGPProfile(this);
-        profileReady = true;
-    } else if (XCraftsErjAGPProfile::IsEligible()) {
-        profile = new XCraftsErjAGPProfile(this);
-        profileReady = true;
-    } else if (ZiboAGPProfile::IsEligible()) {
-        profile = new ZiboAGPProfile(this);
-        profileReady = true;
-    } else if (TolissAGPProfile::IsEligible()) {
-        profile = new TolissAGPProfile(this);
-        profileReady = true;
-    } else if (PA28AGPProfile::IsEligible()) {
-        profile = new PA28AGPProfile(this);
-        profileReady = true;
-    } else {
+    profile = AGPProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductAGP::unloadProfile() {
+    profileReady = false;
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductAGP::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(AGPLed::BACKLIGHT, 128);
+    setLedBrightness(AGPLed::LCD_BRIGHTNESS, 128);
+    setLedBrightness(AGPLed::OVERALL_LEDS_BRIGHTNESS, 255);
+    setAllLedsEnabled(false);
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductAGP::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -146,12 +159,8 @@ void ProductAGP::update() {
 
     USBDevice::update();
 
-    if (++displayUpdateFrameCounter >= getDisplayUpdateFrameInterval(12)) {
-        displayUpdateFrameCounter = 0;
-
-        if (profile) {
-            profile->updateDisplays();
-        }
+    if (profile && isDisplayUpdateDue(std::chrono::milliseconds(200))) {
+        profile->updateDisplays();
     }
 }
 
@@ -166,7 +175,7 @@ void ProductAGP::setAllLedsEnabled(bool enable) {
 }
 
 void ProductAGP::setLedBrightness(AGPLed led, uint8_t brightness) {
-    writeData({0x02, ProductAGP::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, ProductAGP::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductAGP::IdentifierByte, 0xBB, static_cast<uint8_t>(led)));
 }
 
 void ProductAGP::parseSegment(const std::string &text, int expectedLength, std::string &outDigits, uint16_t &colonMask, int digitOffset) {
@@ -257,13 +266,13 @@ void ProductAGP::setLCDText(const std::string &chrono, const std::string &utcTim
         }
     }
 
-    writeData(packet);
+    writeData(packet, WriteLane::INTERACTIVE);
 
     std::vector<uint8_t> commitPacket = {
         0xF0, 0x00, packetNumber, 0x11, ProductAGP::IdentifierByte,
         0xBB, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00};
     commitPacket.resize(64, 0x00);
-    writeData(commitPacket);
+    writeData(commitPacket, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
@@ -291,20 +300,13 @@ void ProductAGP::didReceiveData(int reportId, uint8_t *report, int reportLength)
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductAGP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -330,14 +332,14 @@ void ProductAGP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, ui
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
@@ -4,8 +4,6 @@
 #include "agp-aircraft-profile.h"
 #include "usbdevice.h"
 
-#include <set>
-
 enum class AGPLed : int {
     BACKLIGHT = 0,
     LCD_BRIGHTNESS = 1,
@@ -41,10 +39,9 @@ class ProductAGP : public USBDevice {
     private:
         AGPAircraftProfile *profile;
         int menuItemId;
-        int displayUpdateFrameCounter = 0;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
-        std::set<int> pressedButtonIndices;
+        ButtonStates pressedButtonIndices;
         uint8_t packetNumber = 1;
 
         void setProfileForCurrentAircraft();
@@ -61,6 +58,8 @@ class ProductAGP : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
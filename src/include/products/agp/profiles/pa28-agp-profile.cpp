@@ -1,5 +1,6 @@
 #include "pa28-agp-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-agp.h"
@@ -35,19 +36,19 @@ PA28AGPProfile::PA28AGPProfile(ProductAGP *product) : AGPAircraftProfile(product
         product->setLedBrightness(AGPLed::LCD_BRIGHTNESS, screens);
         product->setLedBrightness(AGPLed::OVERALL_LEDS_BRIGHTNESS, screens);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Logger::getInstance()->info("AGP: PA28 profile active\n");
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
 }
 
 bool PA28AGPProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
     return icao.starts_with("P28");
 }
 
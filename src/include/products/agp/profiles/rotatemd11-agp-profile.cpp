@@ -17,12 +17,12 @@ RotateMD11AGPProfile::RotateMD11AGPProfile(ProductAGP *product) : AGPAircraftPro
         product->setLedBrightness(AGPLed::LCD_BRIGHTNESS, hasPower ? 255 : 0);
         product->setLedBrightness(AGPLed::OVERALL_LEDS_BRIGHTNESS, hasPower ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("Rotate/aircraft/systems/light_fgs_panel_brt_ratio", [](float) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/annun_test_signal", [](int) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/gear_down_l_lt");
@@ -33,7 +33,7 @@ RotateMD11AGPProfile::RotateMD11AGPProfile(ProductAGP *product) : AGPAircraftPro
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/gear_disag_r_lt");
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/controls/auto_brake");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     auto gearGreenHandler = [product](int) {
         bool annunTest = Dataref::getInstance()->getCached<int>("Rotate/aircraft/systems/annun_test_signal") == 1;
@@ -56,12 +56,12 @@ RotateMD11AGPProfile::RotateMD11AGPProfile(ProductAGP *product) : AGPAircraftPro
         product->setLedBrightness(AGPLed::LDG_GEAR_LEVER_RED, (disL || disF || disR) ? 1 : 0);
     };
 
-    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_down_l_lt", gearGreenHandler, this);
-    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_down_f_lt", gearGreenHandler, this);
-    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_down_r_lt", gearGreenHandler, this);
-    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_disag_l_lt", gearUnlkHandler, this);
-    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_disag_f_lt", gearUnlkHandler, this);
-    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_disag_r_lt", gearUnlkHandler, this);
+    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_down_l_lt", gearGreenHandler, this, DatarefPollRate::HZ_5);
+    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_down_f_lt", gearGreenHandler, this, DatarefPollRate::HZ_5);
+    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_down_r_lt", gearGreenHandler, this, DatarefPollRate::HZ_5);
+    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_disag_l_lt", gearUnlkHandler, this, DatarefPollRate::HZ_5);
+    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_disag_f_lt", gearUnlkHandler, this, DatarefPollRate::HZ_5);
+    Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/systems/gear_disag_r_lt", gearUnlkHandler, this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Rotate/aircraft/controls/auto_brake", [product](int mode) {
         bool annunTest = Dataref::getInstance()->getCached<int>("Rotate/aircraft/systems/annun_test_signal") == 1;
@@ -19,19 +19,19 @@ TolissAGPProfile::TolissAGPProfile(ProductAGP *product) : AGPAircraftProfile(pro
         product->setLedBrightness(AGPLed::LCD_BRIGHTNESS, hasEssentialBusPower ? 255 : 0);
         product->setLedBrightness(AGPLed::OVERALL_LEDS_BRIGHTNESS, hasEssentialBusPower ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FCUAvail", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/AnnunMode");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/AnnunMode");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("AirbusFBW/AnnunMode", [this, product](int annunMode) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/TerrainSelectedND1");
@@ -41,7 +41,7 @@ TolissAGPProfile::TolissAGPProfile(ProductAGP *product) : AGPAircraftProfile(pro
         product->setLedBrightness(AGPLed::LDG_GEAR_LEVER_RED, isAnnunTest() ? 255 : 0);
         updateDisplays();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/TerrainSelectedND1", [this, product](bool enabled) {
         if (product->terrainNDPreference == AGPTerrainNDPreference::FIRST_OFFICER) {
@@ -20,12 +20,12 @@ XCraftsErjAGPProfile::XCraftsErjAGPProfile(ProductAGP *product) : AGPAircraftPro
         product->setLedBrightness(AGPLed::LCD_BRIGHTNESS, hasPower ? 255 : 0);
         product->setLedBrightness(AGPLed::OVERALL_LEDS_BRIGHTNESS, hasPower ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("sim/cockpit/switches/gear_handle_status", [product](int gearStatus) {
         product->setLedBrightness(AGPLed::LDG_GEAR_ARROW_GREEN_CENTER, gearStatus == 1 ? 1 : 0);
@@ -3,19 +3,26 @@
 #include "appstate.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/pa28-ecam-profile.h"
 #include "profiles/toliss-ecam-profile.h"
 
 #include <algorithm>
 #include <cmath>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using ECAMProfiles = ProfileRegistry<ProductECAM, ECAMAircraftProfile,
+    TolissECAMProfile,
+    PA28ECAMProfile>;
+
 ProductECAM::ProductECAM(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -40,18 +47,32 @@ const char *ProductECAM::activeProfileName() const {
 }
 
 void ProductECAM::setProfileForCurrentAircraft() {
-    if (TolissECAMProfile::IsEligible()) {
-        profile = new TolissECAMProfile(this);
-        profileReady = true;
-    } else if (PA28ECAMProfile::IsEligible()) {
-        profile = new PA28ECAMProfile(this);
-        profileReady = true;
-    } else {
+    profile = ECAMProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductECAM::unloadProfile() {
+    profileReady = false;
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductECAM::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(ECAMLed::BACKLIGHT, 128);
+    setLedBrightness(ECAMLed::EMER_CANC_BRIGHTNESS, 128);
+    setLedBrightness(ECAMLed::OVERALL_LEDS_BRIGHTNESS, 255);
+    setAllLedsEnabled(false);
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductECAM::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -100,7 +121,7 @@ void ProductECAM::setAllLedsEnabled(bool enable) {
 }
 
 void ProductECAM::setLedBrightness(ECAMLed led, uint8_t brightness) {
-    writeData({0x02, ProductECAM::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, ProductECAM::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductECAM::IdentifierByte, 0xBB, static_cast<uint8_t>(led)));
 }
 
 void ProductECAM::didReceiveData(int reportId, uint8_t *report, int reportLength) {
@@ -125,20 +146,13 @@ void ProductECAM::didReceiveData(int reportId, uint8_t *report, int reportLength
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductECAM::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -164,14 +178,14 @@ void ProductECAM::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, u
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
@@ -4,8 +4,6 @@
 #include "ecam-aircraft-profile.h"
 #include "usbdevice.h"
 
-#include <set>
-
 enum class ECAMLed : int {
     BACKLIGHT = 0,
     OVERALL_LEDS_BRIGHTNESS = 1,
@@ -36,7 +34,7 @@ class ProductECAM : public USBDevice {
         int menuItemId;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
-        std::set<int> pressedButtonIndices;
+        ButtonStates pressedButtonIndices;
 
         void setProfileForCurrentAircraft();
 
@@ -51,6 +49,8 @@ class ProductECAM : public USBDevice {
         const char *activeProfileName() const override;
 
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
         void didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count = 1) override;
@@ -1,5 +1,6 @@
 #include "pa28-ecam-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-ecam.h"
@@ -31,19 +32,19 @@ PA28ECAMProfile::PA28ECAMProfile(ProductECAM *product) : ECAMAircraftProfile(pro
         product->setLedBrightness(ECAMLed::EMER_CANC_BRIGHTNESS, backlight);
         product->setLedBrightness(ECAMLed::OVERALL_LEDS_BRIGHTNESS, screens);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Logger::getInstance()->info("ECAM: PA28 profile active\n");
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
 }
 
 bool PA28ECAMProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
     return icao.starts_with("P28");
 }
 
@@ -17,19 +17,19 @@ TolissECAMProfile::TolissECAMProfile(ProductECAM *product) : ECAMAircraftProfile
         product->setLedBrightness(ECAMLed::BACKLIGHT, backlightBrightness);
         product->setLedBrightness(ECAMLed::EMER_CANC_BRIGHTNESS, backlightBrightness);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         Dataref::getInstance()->executeChangedCallbacksForDataref(ifXPlane11("AirbusFBW/OHPLightsATA31", "AirbusFBW/OHPLightsATA31_Raw"));
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/ECPAvail", [this, product](bool enabled) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         Dataref::getInstance()->executeChangedCallbacksForDataref(ifXPlane11("AirbusFBW/OHPLightsATA31", "AirbusFBW/OHPLightsATA31_Raw"));
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>(ifXPlane11("AirbusFBW/OHPLightsATA31", "AirbusFBW/OHPLightsATA31_Raw"), [product](const std::vector<float> &panelLights) {
         if (panelLights.size() < 45) {
@@ -1,9 +1,11 @@
 #include "product-fcu-efis.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "config.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/c172-afl-fcu-efis-profile.h"
 #include "profiles/c172-laminar-fcu-efis-profile.h"
 #include "profiles/cis-seneca-fcu-efis-profile.h"
@@ -29,6 +31,7 @@
 #include "segment-display.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <iomanip>
 #include <sstream>
@@ -37,13 +40,38 @@
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using FCUEfisProfiles = ProfileRegistry<ProductFCUEfis, FCUEfisAircraftProfile,
+    RotateMD11FCUEfisProfile,
+    JAR330FCUEfisProfile,
+    FF350FCUEfisProfile,
+    XCraftsEjetsFCUEfisProfile,
+    XCraftsErjFCUEfisProfile,
+    Q4XPFCUEfisProfile,
+    CL650FCUEfisProfile,
+    TolissFCUEfisProfile,
+    C172AFLFCUEfisProfile,
+    C172LaminarFCUEfisProfile,
+    CISSenecaFCUEfisProfile,
+    PA28FCUEfisProfile,
+    LaminarA333FCUEfisProfile,
+    Strato77WFCUEfisProfile,
+    FF777FCUEfisProfile,
+    FF767FCUEfisProfile,
+    FPS748FCUEfisProfile,
+    SparkyB744FCUEfisProfile,
+    JF146FCUEfisProfile,
+    KingAir350FCUEfisProfile,
+    ZiboFCUEfisProfile,
+    Laminar737FCUEfisProfile>;
+
 ProductFCUEfis::ProductFCUEfis(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     displayData = {};
-    lastUpdateCycle = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -60,76 +88,10 @@ ProductFCUEfis::~ProductFCUEfis() {
 }
 
 void ProductFCUEfis::setProfileForCurrentAircraft() {
-    if (RotateMD11FCUEfisProfile::IsEligible()) {
-        profile = new RotateMD11FCUEfisProfile(this);
-        profileReady = true;
-    } else if (JAR330FCUEfisProfile::IsEligible()) {
-        profile = new JAR330FCUEfisProfile(this);
-        profileReady = true;
-    } else if (FF350FCUEfisProfile::IsEligible()) {
-        profile = new FF350FCUEfisProfile(this);
-        profileReady = true;
-    } else if (XCraftsEjetsFCUEfisProfile::IsEligible()) {
-        profile = new XCraftsEjetsFCUEfisProfile(this);
-        profileReady = true;
-    } else if (XCraftsErjFCUEfisProfile::IsEligible()) {
-        profile = new XCraftsErjFCUEfisProfile(this);
-        profileReady = true;
-    } else if (Q4XPFCUEfisProfile::IsEligible()) {
-        profile = new Q4XPFCUEfisProfile(this);
-        profileReady = true;
-    } else if (CL650FCUEfisProfile::IsEligible()) {
-        profile = new CL650FCUEfisProfile(this);
-        profileReady = true;
-    } else if (TolissFCUEfisProfile::IsEligible()) {
-        profile = new TolissFCUEfisProfile(this);
-        profileReady = true;
-    } else if (C172AFLFCUEfisProfile::IsEligible()) {
-        profile = new C172AFLFCUEfisProfile(this);
-        profileReady = true;
-    } else if (C172LaminarFCUEfisProfile::IsEligible()) {
-        profile = new C172LaminarFCUEfisProfile(this);
-        profileReady = true;
-    } else if (CISSenecaFCUEfisProfile::IsEligible()) {
-        profile = new CISSenecaFCUEfisProfile(this);
-        profileReady = true;
-    } else if (PA28FCUEfisProfile::IsEligible()) {
-        profile = new PA28FCUEfisProfile(this);
-        profileReady = true;
-    } else if (LaminarA333FCUEfisProfile::IsEligible()) {
-        profile = new LaminarA333FCUEfisProfile(this);
-        profileReady = true;
-    } else if (Strato77WFCUEfisProfile::IsEligible()) {
-        profile = new Strato77WFCUEfisProfile(this);
-        profileReady = true;
-    } else if (FF777FCUEfisProfile::IsEligible()) {
-        profile = new FF777FCUEfisProfile(this);
-        profileReady = true;
-    } else if (FF767FCUEfisProfile::IsEligible()) {
-        profile = new FF767FCUEfisProfile(this);
-        profileReady = true;
-    } else if (FPS748FCUEfisProfile::IsEligible()) {
-        profile = new FPS748FCUEfisProfile(this);
-        profileReady = true;
-    } else if (SparkyB744FCUEfisProfile::IsEligible()) {
-        profile = new SparkyB744FCUEfisProfile(this);
-        profileReady = true;
-    } else if (JF146FCUEfisProfile::IsEligible()) {
-        profile = new JF146FCUEfisProfile(this);
-        profileReady = true;
-    } else if (KingAir350FCUEfisProfile::IsEligible()) {
-        profile = new KingAir350FCUEfisProfile(this);
-        profileReady = true;
-    } else if (ZiboFCUEfisProfile::IsEligible()) {
-        profile = new ZiboFCUEfisProfile(this);
-        profileReady = true;
-    } else if (Laminar737FCUEfisProfile::IsEligible()) {
-        profile = new Laminar737FCUEfisProfile(this);
-        profileReady = true;
-    } else {
-        profile = nullptr;
-        profileReady = false;
-    }
+    displaySubscription.reset();
+
+    profile = FCUEfisProfiles::create(this);
+    profileReady = profile != nullptr;
 }
 
 const char *ProductFCUEfis::classIdentifier() {
@@ -140,8 +102,30 @@ const char *ProductFCUEfis::activeProfileName() const {
     return profile ? typeid(*profile).name() : "none";
 }
 
+void ProductFCUEfis::unloadProfile() {
+    profileReady = false;
+    displaySubscription.reset();
+    // No rematching against the outgoing aircraft: the identity generation
+    // moves on once the next one has loaded.
+    profileMatchGeneration = AircraftIdentity::getInstance()->getGeneration();
+
+    if (profile) {
+        delete profile;
+        profile = nullptr;
+    }
+}
+
+void ProductFCUEfis::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductFCUEfis::connect() {
     if (USBDevice::connect()) {
+        lastLedBrightness.clear();
         initializeDisplays();
 
         // Set initial LED brightness
@@ -209,15 +193,33 @@ void ProductFCUEfis::update() {
     }
 
     if (!profile) {
-        setProfileForCurrentAircraft();
+        // Matching again only helps once the aircraft identity has moved on
+        // (new datarefs, plugin enabled or the recheck backoff).
+        uint64_t identityGeneration = AircraftIdentity::getInstance()->getGeneration();
+        if (identityGeneration == profileMatchGeneration) {
+            return;
+        }
+
+        profileMatchGeneration = identityGeneration;
+        AppState::getInstance()->executeWithinFrameBudget("setProfile", FrameWorkPriority::LOW, this, [this]() {
+            if (!connected || profile) {
+                return;
+            }
+
+            setProfileForCurrentAircraft();
+            if (!profile) {
+                AircraftIdentity::getInstance()->scheduleRecheck();
+            }
+        });
         return;
     }
 
     USBDevice::update();
 
-    if (++displayUpdateFrameCounter >= getDisplayUpdateFrameInterval()) {
-        displayUpdateFrameCounter = 0;
-        updateDisplays(false);
+    if (isDisplayUpdateDue()) {
+        AppState::getInstance()->executeWithinFrameBudget("updateDisplays", FrameWorkPriority::NORMAL, this, [this]() {
+            updateDisplays(false);
+        });
     }
 }
 
@@ -226,14 +228,7 @@ void ProductFCUEfis::updateDisplays(bool force) {
         return;
     }
 
-    bool shouldUpdate = force;
-    auto datarefManager = Dataref::getInstance();
-    for (const std::string &dataref : profile->displayDatarefs()) {
-        if (!lastUpdateCycle || datarefManager->getCachedLastUpdate(dataref.c_str()) > lastUpdateCycle) {
-            shouldUpdate = true;
-            break;
-        }
-    }
+    bool shouldUpdate = force || displaySubscription.hasChanges(profile->displayDatarefs());
 
     if (!shouldUpdate) {
         return;
@@ -259,7 +254,7 @@ void ProductFCUEfis::updateDisplays(bool force) {
     }
 
     if (shouldUpdate) {
-        lastUpdateCycle = XPLMGetCycleNumber();
+        displaySubscription.acknowledge();
     }
 }
 
@@ -267,7 +262,7 @@ void ProductFCUEfis::initializeDisplays() {
     // Initialize displays with proper init sequence
     std::vector<uint8_t> initCmd = {
         0xF0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    writeData(initCmd);
+    writeData(initCmd, WriteLane::INTERACTIVE);
 }
 
 void ProductFCUEfis::clearDisplays() {
@@ -292,7 +287,7 @@ void ProductFCUEfis::sendFCUDisplay(const std::string &speed, const std::string
     auto vsData = SegmentDisplay::encodeStringSwapped(4, SegmentDisplay::fixStringLength(vs, 4));
 
     // Create flag bytes array
-    std::vector<uint8_t> flagBytes(17, 0);
+    std::array<uint8_t, 17> flagBytes = {};
 
     // Set flags based on display data
     if (displayData.displayEnabledWindowsFlag & FCUDisplayData::Window::SpeedMachHeader) {
@@ -415,102 +410,101 @@ void ProductFCUEfis::sendFCUDisplay(const std::string &speed, const std::string
     }
 
     // First request - send display data
-    std::vector<uint8_t> packet = {
-        0xF0, 0x00, packetNumber, 0x31, ProductFCUEfis::FCUIdentifierByte, 0xBB, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    static constexpr uint8_t displayHeader[] = {
+        0xF0, 0x00, 0x00, 0x31, ProductFCUEfis::FCUIdentifierByte, 0xBB, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    WritePacket *packet = reservePacket(WriteLane::INTERACTIVE);
+    if (!packet) {
+        return;
+    }
+
+    // Slots come zeroed, which is the padding up to 64 bytes.
+    uint8_t *bytes = std::copy(std::begin(displayHeader), std::end(displayHeader), packet->bytes.begin());
+    packet->bytes[2] = packetNumber;
 
     // Add speed data (3 bytes)
-    packet.push_back(speedData[2]);
-    packet.push_back(speedData[1] | flagBytes[static_cast<int>(DisplayByteIndex::S1)]);
-    packet.push_back(speedData[0]);
+    *bytes++ = speedData[2];
+    *bytes++ = speedData[1] | flagBytes[static_cast<int>(DisplayByteIndex::S1)];
+    *bytes++ = speedData[0];
 
     // Add heading data (4 bytes)
-    packet.push_back(headingData[3] | flagBytes[static_cast<int>(DisplayByteIndex::H3)]);
-    packet.push_back(headingData[2]);
-    packet.push_back(headingData[1]);
-    packet.push_back(headingData[0] | flagBytes[static_cast<int>(DisplayByteIndex::H0)]);
+    *bytes++ = headingData[3] | flagBytes[static_cast<int>(DisplayByteIndex::H3)];
+    *bytes++ = headingData[2];
+    *bytes++ = headingData[1];
+    *bytes++ = headingData[0] | flagBytes[static_cast<int>(DisplayByteIndex::H0)];
 
     // Add altitude data (6 bytes)
-    packet.push_back(altitudeData[5] | flagBytes[static_cast<int>(DisplayByteIndex::A5)]);
-    packet.push_back(altitudeData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A4)]);
-    packet.push_back(altitudeData[3] | flagBytes[static_cast<int>(DisplayByteIndex::A3)]);
-    packet.push_back(altitudeData[2] | flagBytes[static_cast<int>(DisplayByteIndex::A2)]);
-    packet.push_back(altitudeData[1] | flagBytes[static_cast<int>(DisplayByteIndex::A1)]);
-    packet.push_back(altitudeData[0] | vsData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A0)]);
+    *bytes++ = altitudeData[5] | flagBytes[static_cast<int>(DisplayByteIndex::A5)];
+    *bytes++ = altitudeData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A4)];
+    *bytes++ = altitudeData[3] | flagBytes[static_cast<int>(DisplayByteIndex::A3)];
+    *bytes++ = altitudeData[2] | flagBytes[static_cast<int>(DisplayByteIndex::A2)];
+    *bytes++ = altitudeData[1] | flagBytes[static_cast<int>(DisplayByteIndex::A1)];
+    *bytes++ = altitudeData[0] | vsData[4] | flagBytes[static_cast<int>(DisplayByteIndex::A0)];
 
     // Add vertical speed data (4 bytes)
-    packet.push_back(vsData[3] | flagBytes[static_cast<int>(DisplayByteIndex::V3)]);
-    packet.push_back(vsData[2] | flagBytes[static_cast<int>(DisplayByteIndex::V2)]);
-    packet.push_back(vsData[1] | flagBytes[static_cast<int>(DisplayByteIndex::V1)]);
-    packet.push_back(vsData[0] | flagBytes[static_cast<int>(DisplayByteIndex::V0)]);
+    *bytes++ = vsData[3] | flagBytes[static_cast<int>(DisplayByteIndex::V3)];
+    *bytes++ = vsData[2] | flagBytes[static_cast<int>(DisplayByteIndex::V2)];
+    *bytes++ = vsData[1] | flagBytes[static_cast<int>(DisplayByteIndex::V1)];
+    *bytes++ = vsData[0] | flagBytes[static_cast<int>(DisplayByteIndex::V0)];
 
-    // Pad to 64 bytes
-    while (packet.size() < 64) {
-        packet.push_back(0x00);
-    }
-
-    writeData(packet);
+    packet->length = kWritePacketSize;
+    commitPacket(packet);
 
     // Second request - commit display data
-    std::vector<uint8_t> commitPacket = {
+    std::array<uint8_t, kWritePacketSize> commit = {
         0xF0, 0x00, packetNumber, 0x11, ProductFCUEfis::FCUIdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00};
-
-    // Pad to 64 bytes
-    while (commitPacket.size() < 64) {
-        commitPacket.push_back(0x00);
-    }
-
-    writeData(commitPacket);
+    writeData(commit, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
 }
 
 void ProductFCUEfis::sendEfisDisplayWithFlags(EfisDisplayValue *data, bool isRightSide) {
-    std::vector<uint8_t> flagBytes(17, 0);
+    std::array<uint8_t, 17> flagBytes = {};
     flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B0 : DisplayByteIndex::EFISL_B0)] |= data->isStd ? 0x00 : (data->showQfe ? 0x01 : 0x02);
     if (data->unitIsInHg) { // Show comma
         flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B2 : DisplayByteIndex::EFISL_B2)] |= 0x80;
     }
 
-    // EFIS display protocol
-    std::vector<uint8_t> packet = {
-        0xF0, 0x00, packetNumber, 0x1A, static_cast<uint8_t>(isRightSide ? ProductFCUEfis::EfisRightIdentifierByte : ProductFCUEfis::EfisLeftIdentifierByte), 0xBF, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    uint8_t identifierByte = isRightSide ? ProductFCUEfis::EfisRightIdentifierByte : ProductFCUEfis::EfisLeftIdentifierByte;
 
     // Add barometric data
     auto baroData = SegmentDisplay::encodeStringEfis(4, SegmentDisplay::fixStringLength(data->isStd ? "STD " : data->baro, 4));
 
-    if (!data->displayEnabled) {
-        packet.push_back(0x00);
-        packet.push_back(0x00);
-        packet.push_back(0x00);
-        packet.push_back(0x00);
-        packet.push_back(0x00);
-    } else if (data->displayTest) {
-        packet.push_back(SegmentDisplay::getSegmentMask('8'));
-        packet.push_back(SegmentDisplay::getSegmentMask('8') | 0x80);
-        packet.push_back(SegmentDisplay::getSegmentMask('8'));
-        packet.push_back(SegmentDisplay::getSegmentMask('8'));
-        packet.push_back(0xFF);
-    } else {
-        packet.push_back(baroData[3]);
-        packet.push_back(baroData[2] | flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B2 : DisplayByteIndex::EFISL_B2)]);
-        packet.push_back(baroData[1]);
-        packet.push_back(baroData[0]);
-        packet.push_back(flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B0 : DisplayByteIndex::EFISL_B0)]);
+    // EFIS display protocol
+    static constexpr uint8_t displayHeader[] = {
+        0xF0, 0x00, 0x00, 0x1A, 0x00, 0xBF, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    WritePacket *packet = reservePacket(WriteLane::INTERACTIVE);
+    if (!packet) {
+        return;
     }
 
-    // Pad to 64 bytes
-    while (packet.size() < 64) {
-        packet.push_back(0x00);
+    // Slots come zeroed, which covers the blank display and the padding up
+    // to 64 bytes.
+    uint8_t *bytes = std::copy(std::begin(displayHeader), std::end(displayHeader), packet->bytes.begin());
+    packet->bytes[2] = packetNumber;
+    packet->bytes[4] = identifierByte;
+
+    if (data->displayEnabled && data->displayTest) {
+        *bytes++ = SegmentDisplay::getSegmentMask('8');
+        *bytes++ = SegmentDisplay::getSegmentMask('8') | 0x80;
+        *bytes++ = SegmentDisplay::getSegmentMask('8');
+        *bytes++ = SegmentDisplay::getSegmentMask('8');
+        *bytes++ = 0xFF;
+    } else if (data->displayEnabled) {
+        *bytes++ = baroData[3];
+        *bytes++ = baroData[2] | flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B2 : DisplayByteIndex::EFISL_B2)];
+        *bytes++ = baroData[1];
+        *bytes++ = baroData[0];
+        *bytes++ = flagBytes[static_cast<int>(isRightSide ? DisplayByteIndex::EFISR_B0 : DisplayByteIndex::EFISL_B0)];
     }
 
-    writeData(packet);
+    packet->length = kWritePacketSize;
+    commitPacket(packet);
 
-    std::vector<uint8_t> commitPacket = {
-        0xF0, 0x00, packetNumber, 0x11, static_cast<uint8_t>(isRightSide ? ProductFCUEfis::EfisRightIdentifierByte : ProductFCUEfis::EfisLeftIdentifierByte),
+    std::array<uint8_t, kWritePacketSize> commit = {
+        0xF0, 0x00, packetNumber, 0x11, identifierByte,
         0xBF, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x4C, 0x0C, 0x1D, 0x00};
-    commitPacket.resize(64, 0x00);
-    writeData(commitPacket);
+    writeData(commit, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
@@ -534,28 +528,41 @@ void ProductFCUEfis::setAllLedsEnabled(bool enable) {
 }
 
 void ProductFCUEfis::setLedBrightness(FCUEfisLed led, uint8_t brightness) {
-    std::vector<uint8_t> data;
-
     int ledValue = static_cast<int>(led);
+    auto it = lastLedBrightness.find(ledValue);
+    if (it != lastLedBrightness.end() && it->second == brightness) {
+        return;
+    }
+    lastLedBrightness[ledValue] = brightness;
 
+    uint8_t identifierByte;
+    uint8_t typeByte;
+    uint8_t ledIndex;
     if (ledValue < 100) {
         // FCU LEDs
-        data = {0x02, ProductFCUEfis::FCUIdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(ledValue), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
+        identifierByte = ProductFCUEfis::FCUIdentifierByte;
+        typeByte = 0xBB;
+        ledIndex = static_cast<uint8_t>(ledValue);
     } else if (ledValue < 200) {
         // EFIS Right LEDs
-        data = {0x02, ProductFCUEfis::EfisRightIdentifierByte, 0xBF, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(ledValue - 100), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
+        identifierByte = ProductFCUEfis::EfisRightIdentifierByte;
+        typeByte = 0xBF;
+        ledIndex = static_cast<uint8_t>(ledValue - 100);
     } else if (ledValue < 300) {
         // EFIS Left LEDs
-        data = {0x02, ProductFCUEfis::EfisLeftIdentifierByte, 0xBF, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(ledValue - 200), brightness, 0x00, 0x00, 0x00, 0x00, 0x00};
+        identifierByte = ProductFCUEfis::EfisLeftIdentifierByte;
+        typeByte = 0xBF;
+        ledIndex = static_cast<uint8_t>(ledValue - 200);
+    } else {
+        return;
     }
 
-    if (!data.empty()) {
-        writeData(data);
-    }
+    writeData({0x02, identifierByte, typeByte, 0x00, 0x00, 0x03, 0x49, ledIndex, brightness, 0x00, 0x00, 0x00, 0x00, 0x00},
+        USBWriteQueue::SlotKey(identifierByte, typeByte, ledIndex));
 }
 
 void ProductFCUEfis::forceStateSync() {
-    pressedButtonIndices.clear();
+    pressedButtonIndices.reset();
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
 
@@ -584,41 +591,14 @@ void ProductFCUEfis::didReceiveData(int reportId, uint8_t *report, int reportLen
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    // Process FCU buttons (bytes 1-4 = buttons 0-31)
-    for (int byteIndex = 1; byteIndex <= 4 && byteIndex < reportLength; byteIndex++) {
-        uint8_t buttonByte = report[byteIndex];
-
-        for (int bitIndex = 0; bitIndex < 8; bitIndex++) {
-            int hardwareButtonIndex = (byteIndex - 1) * 8 + bitIndex; // Subtract 1 to start at button 0
-            bool pressed = (buttonByte & (1 << bitIndex)) != 0;
-            didReceiveButton(hardwareButtonIndex, pressed);
-        }
-    }
-
-    // Process EFIS-R buttons (bytes 9-12 = buttons 32-63)
-    for (int byteIndex = 9; byteIndex <= 12 && byteIndex < reportLength; byteIndex++) {
-        uint8_t buttonByte = report[byteIndex];
-
-        for (int bitIndex = 0; bitIndex < 8; bitIndex++) {
-            int hardwareButtonIndex = 64 + (byteIndex - 9) * 8 + bitIndex; // EFIS-R starts at button 64
-            bool pressed = (buttonByte & (1 << bitIndex)) != 0;
-            didReceiveButton(hardwareButtonIndex, pressed);
-        }
-    }
-
-    // Process EFIS-L buttons (bytes 5-8 = buttons 64-95)
-    for (int byteIndex = 5; byteIndex <= 8 && byteIndex < reportLength; byteIndex++) {
-        uint8_t buttonByte = report[byteIndex];
-
-        for (int bitIndex = 0; bitIndex < 8; bitIndex++) {
-            int hardwareButtonIndex = 32 + (byteIndex - 5) * 8 + bitIndex; // EFIS-L starts at button 32
-            bool pressed = (buttonByte & (1 << bitIndex)) != 0;
-            didReceiveButton(hardwareButtonIndex, pressed);
-        }
-    }
+    // FCU buttons 0-31 (bytes 1-4), EFIS-L 32-63 (bytes 5-8), EFIS-R 64-95 (bytes 9-12)
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductFCUEfis::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -644,14 +624,14 @@ void ProductFCUEfis::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
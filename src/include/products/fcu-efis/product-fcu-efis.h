@@ -1,11 +1,12 @@
 #ifndef PRODUCT_FCUEFIS_H
 #define PRODUCT_FCUEFIS_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 #include "usbdevice.h"
 
 #include <map>
-#include <set>
+#include <unordered_map>
 
 class ProductFCUEfis : public USBDevice {
     private:
@@ -13,13 +14,14 @@ class ProductFCUEfis : public USBDevice {
         FCUEfisAircraftProfile *profile;
         int menuItemId;
         FCUDisplayData displayData;
-        int lastUpdateCycle;
-        int displayUpdateFrameCounter = 0;
-        std::set<int> pressedButtonIndices;
+        DatarefSubscription displaySubscription;
+        uint64_t profileMatchGeneration = 0;
+        ButtonStates pressedButtonIndices;
         std::map<std::string, int> selectorPositions;
 
         uint64_t lastButtonStateLo = 0;
         uint32_t lastButtonStateHi = 0;
+        std::unordered_map<int, uint8_t> lastLedBrightness;
 
         void setProfileForCurrentAircraft();
 
@@ -34,6 +36,8 @@ class ProductFCUEfis : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
@@ -6,7 +6,24 @@
 
 #include <XPLMUtilities.h>
 
+const DisplayRef<C172AFLFCUEfisProfile::DisplayRefs> C172AFLFCUEfisProfile::displayRefTable[] = {
+    {"C172/cockpit/pilotAlt/baroPilot", &DisplayRefs::baroPilot},
+    {"sim/physics/metric_press", &DisplayRefs::metricPress},
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+    {"sim/cockpit2/autopilot/servos_on"},
+    {"sim/cockpit2/autopilot/heading_status", &DisplayRefs::headingStatus},
+    {"sim/cockpit2/autopilot/nav_status", &DisplayRefs::navStatus},
+    {"sim/cockpit2/autopilot/approach_status", &DisplayRefs::approachStatus},
+    {"sim/cockpit2/autopilot/altitude_hold_status", &DisplayRefs::altitudeHoldStatus},
+    {"sim/cockpit2/autopilot/vvi_status", &DisplayRefs::vviStatus},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"C172/electric/av2/autoPilotBreaker/kap140/power", &DisplayRefs::kap140Power},
+};
+
 C172AFLFCUEfisProfile::C172AFLFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     // Backlight follows the AirfoilLabs panel-light rheostat, gated by its own breaker.
     Dataref::getInstance()->monitorExistingDataref<float>("C172/cockpit/lights/panelLt", [product](float brightness) {
         bool hasPower = Dataref::getInstance()->get<bool>("C172/electric/bus2/instLtsBreaker/panelLights/rheoPanelLt/power");
@@ -26,7 +43,7 @@ C172AFLFCUEfisProfile::C172AFLFCUEfisProfile(ProductFCUEfis *product) : FCUEfisA
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // The backlight also depends on the panel-light power gate, but that flips on independently
     // of panelLt (e.g. when the bus powers up after load). Re-fire the brightness callback when
@@ -34,7 +51,7 @@ C172AFLFCUEfisProfile::C172AFLFCUEfisProfile(ProductFCUEfis *product) : FCUEfisA
     Dataref::getInstance()->monitorExistingDataref<bool>("C172/electric/bus2/instLtsBreaker/panelLights/rheoPanelLt/power", [](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("C172/cockpit/lights/panelLt");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/physics/metric_press", [product](bool isMetric) {
         product->updateDisplays();
@@ -66,20 +83,7 @@ bool C172AFLFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &C172AFLFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "C172/cockpit/pilotAlt/baroPilot",
-        "sim/physics/metric_press",
-        "sim/cockpit/electrical/battery_on",
-        "sim/cockpit2/autopilot/servos_on",
-        "sim/cockpit2/autopilot/heading_status",
-        "sim/cockpit2/autopilot/nav_status",
-        "sim/cockpit2/autopilot/approach_status",
-        "sim/cockpit2/autopilot/altitude_hold_status",
-        "sim/cockpit2/autopilot/vvi_status",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit/autopilot/vertical_velocity",
-        "C172/electric/av2/autoPilotBreaker/kap140/power",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -124,7 +128,7 @@ void C172AFLFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     // The KAP140 display is alive whenever it is powered (avionics on), independent of whether the
     // autopilot is engaged. Mode headers below light per active mode; the selected altitude shows
     // whenever the display is on.
-    data.displayEnabled = datarefManager->getCached<bool>("C172/electric/av2/autoPilotBreaker/kap140/power");
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.kap140Power);
     data.displayTest = false;
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::None;
     data.speed = "";
@@ -133,9 +137,9 @@ void C172AFLFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.verticalSpeed = "";
 
     // Lateral: HDG label for heading mode, LAT label for NAV/APR tracking.
-    bool hdgActive = datarefManager->getCached<int>("sim/cockpit2/autopilot/heading_status") > 0;
-    bool navActive = datarefManager->getCached<int>("sim/cockpit2/autopilot/nav_status") > 0 ||
-                     datarefManager->getCached<int>("sim/cockpit2/autopilot/approach_status") > 0;
+    bool hdgActive = datarefManager->getCached<int>(displayRefs.headingStatus) > 0;
+    bool navActive = datarefManager->getCached<int>(displayRefs.navStatus) > 0 ||
+                     datarefManager->getCached<int>(displayRefs.approachStatus) > 0;
     if (hdgActive || navActive) {
         data.displayEnabledWindowsFlag |= FCUDisplayData::Window::HeadingTrackHeader;
         data.headingHdg = hdgActive;
@@ -143,7 +147,7 @@ void C172AFLFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Vertical: ALT label for altitude hold, V/S label for vertical-speed mode.
-    if (datarefManager->getCached<int>("sim/cockpit2/autopilot/altitude_hold_status") > 0) {
+    if (datarefManager->getCached<int>(displayRefs.altitudeHoldStatus) > 0) {
         data.displayEnabledWindowsFlag |= FCUDisplayData::Window::AltitudeHeader;
         data.altIndication = true;
     }
@@ -152,7 +156,7 @@ void C172AFLFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     // to 5 only at/above 10000 ft. The window right-pads to width 5 with '0', so pre-pad the
     // 4-digit case with a leading space (renders as a blank digit) to keep it right-aligned.
     if (data.displayEnabled) {
-        int selectedAltitude = static_cast<int>(datarefManager->getCached<float>("sim/cockpit/autopilot/altitude"));
+        int selectedAltitude = static_cast<int>(datarefManager->getCached<float>(displayRefs.altitude));
         std::ostringstream altStream;
         if (selectedAltitude >= 10000) {
             altStream << selectedAltitude;
@@ -167,12 +171,12 @@ void C172AFLFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     // while VS mode is active. VerticalSpeedFPAHeader/vsIndication is the label (byte V0); NOT
     // HdgTrkVsFpaHeader, which would also light the center HDG/TRK/V/S/FPA cluster. The value goes
     // in as a 4-digit magnitude with vsSign controlling +/- (same rendering as the TolISS profile).
-    if (datarefManager->getCached<int>("sim/cockpit2/autopilot/vvi_status") > 0) {
+    if (datarefManager->getCached<int>(displayRefs.vviStatus) > 0) {
         data.displayEnabledWindowsFlag |= FCUDisplayData::Window::VerticalSpeedFPAHeader;
         data.displayEnabledWindowsFlag |= FCUDisplayData::Window::VerticalSpeedFPAValue;
         data.vsIndication = true;
 
-        float verticalSpeed = datarefManager->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+        float verticalSpeed = datarefManager->getCached<float>(displayRefs.verticalVelocity);
         int absVerticalSpeed = std::abs(static_cast<int>(std::round(verticalSpeed)));
         std::ostringstream vsStream;
         vsStream << std::setw(4) << std::setfill('0') << absVerticalSpeed;
@@ -183,9 +187,9 @@ void C172AFLFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     data.efisRight.baro = "";
-    data.efisLeft.displayEnabled = datarefManager->getCached<bool>("sim/cockpit/electrical/battery_on");
-    float baroPilot = datarefManager->getCached<float>("C172/cockpit/pilotAlt/baroPilot");
-    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>("sim/physics/metric_press"));
+    data.efisLeft.displayEnabled = datarefManager->getCached<bool>(displayRefs.batteryOn);
+    float baroPilot = datarefManager->getCached<float>(displayRefs.baroPilot);
+    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>(displayRefs.metricPress));
 }
 
 void C172AFLFCUEfisProfile::buttonPressed(const FCUEfisButtonDef *button, XPLMCommandPhase phase) {
@@ -1,6 +1,7 @@
 #ifndef C172_AFL_FCU_EFIS_PROFILE_H
 #define C172_AFL_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -10,6 +11,21 @@
 class C172AFLFCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         int altitudeIncrements = 0;
+        struct DisplayRefs {
+                DatarefId kap140Power;
+                DatarefId headingStatus;
+                DatarefId navStatus;
+                DatarefId approachStatus;
+                DatarefId altitudeHoldStatus;
+                DatarefId altitude;
+                DatarefId vviStatus;
+                DatarefId verticalVelocity;
+                DatarefId batteryOn;
+                DatarefId baroPilot;
+                DatarefId metricPress;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         C172AFLFCUEfisProfile(ProductFCUEfis *product);
@@ -6,7 +6,17 @@
 
 #include <XPLMUtilities.h>
 
+const DisplayRef<C172LaminarFCUEfisProfile::DisplayRefs> C172LaminarFCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/autopilot/servos_on"},
+    {"sim/cockpit2/autopilot/heading_mode"},
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+    {"sim/physics/metric_press", &DisplayRefs::metricPress},
+};
+
 C172LaminarFCUEfisProfile::C172LaminarFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio_manual", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 2) {
             return;
@@ -29,7 +39,7 @@ C172LaminarFCUEfisProfile::C172LaminarFCUEfisProfile(ProductFCUEfis *product) :
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/physics/metric_press", [product](bool isMetric) {
         product->updateDisplays();
@@ -54,11 +64,7 @@ bool C172LaminarFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &C172LaminarFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/autopilot/servos_on",
-        "sim/cockpit2/autopilot/heading_mode",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -107,9 +113,9 @@ void C172LaminarFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.verticalSpeed = "";
     data.efisRight.baro = "";
 
-    data.efisLeft.displayEnabled = datarefManager->getCached<bool>("sim/cockpit/electrical/battery_on");
-    float baroPilot = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>("sim/physics/metric_press"));
+    data.efisLeft.displayEnabled = datarefManager->getCached<bool>(displayRefs.batteryOn);
+    float baroPilot = Dataref::getInstance()->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>(displayRefs.metricPress));
 }
 
 void C172LaminarFCUEfisProfile::buttonPressed(const FCUEfisButtonDef *button, XPLMCommandPhase phase) {
@@ -1,6 +1,7 @@
 #ifndef C172_LAMINAR_FCU_EFIS_PROFILE_H
 #define C172_LAMINAR_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -10,6 +11,13 @@
 class C172LaminarFCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         int altitudeIncrements = 0;
+        struct DisplayRefs {
+                DatarefId batteryOn;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId metricPress;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         C172LaminarFCUEfisProfile(ProductFCUEfis *product);
@@ -6,7 +6,20 @@
 
 #include <XPLMUtilities.h>
 
+const DisplayRef<CISSenecaFCUEfisProfile::DisplayRefs> CISSenecaFCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/autopilot/servos_on", &DisplayRefs::servosOn},
+    {"sim/cockpit/autopilot/heading_mag"},
+    {"CIS/PA34/autopilot/nav_status", &DisplayRefs::navStatus},
+    {"CIS/PA34/autopilot/heading_status", &DisplayRefs::headingStatus},
+    {"sim/cockpit2/autopilot/altitude_hold_status", &DisplayRefs::altitudeHoldStatus},
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+    {"CIS/PA34/instruments/altimeter/HpA", &DisplayRefs::altimeterHpA},
+};
+
 CISSenecaFCUEfisProfile::CISSenecaFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio_manual", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 2) {
             return;
@@ -29,12 +42,12 @@ CISSenecaFCUEfisProfile::CISSenecaFCUEfisProfile(ProductFCUEfis *product) : FCUE
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [product](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("CIS/PA34/instruments/altimeter/HpA", [product](bool isHpa) {
         product->updateDisplays();
@@ -61,16 +74,7 @@ bool CISSenecaFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &CISSenecaFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/autopilot/servos_on",
-        "sim/cockpit/autopilot/heading_mag",
-        "CIS/PA34/autopilot/nav_status",
-        "CIS/PA34/autopilot/heading_status",
-        "sim/cockpit2/autopilot/altitude_hold_status",
-        "sim/cockpit/electrical/battery_on",
-        "CIS/PA34/instruments/altimeter/HpA",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -113,25 +117,25 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &CISSenecaFCUEfisProfile::b
 void CISSenecaFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.displayEnabled = datarefManager->getCached<bool>("sim/cockpit2/autopilot/servos_on");
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.servosOn);
     data.displayTest = false;
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::None;
 
-    if (datarefManager->getCached<bool>("CIS/PA34/autopilot/heading_status") || datarefManager->getCached<bool>("CIS/PA34/autopilot/nav_status")) {
+    if (datarefManager->getCached<bool>(displayRefs.headingStatus) || datarefManager->getCached<bool>(displayRefs.navStatus)) {
         data.displayEnabledWindowsFlag |= FCUDisplayData::Window::HeadingTrackHeader;
-        data.headingHdg = datarefManager->getCached<bool>("CIS/PA34/autopilot/heading_status");
-        data.headingLat = datarefManager->getCached<bool>("CIS/PA34/autopilot/nav_status");
+        data.headingHdg = datarefManager->getCached<bool>(displayRefs.headingStatus);
+        data.headingLat = datarefManager->getCached<bool>(displayRefs.navStatus);
     }
 
-    if (datarefManager->getCached<int>("sim/cockpit2/autopilot/altitude_hold_status") > 0) {
+    if (datarefManager->getCached<int>(displayRefs.altitudeHoldStatus) > 0) {
         data.displayEnabledWindowsFlag |= FCUDisplayData::Window::AltitudeHeader;
         data.altIndication = true;
     }
 
     data.efisRight.baro = "";
-    data.efisLeft.displayEnabled = datarefManager->getCached<bool>("sim/cockpit/electrical/battery_on");
-    float baroPilot = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>("CIS/PA34/instruments/altimeter/HpA"));
+    data.efisLeft.displayEnabled = datarefManager->getCached<bool>(displayRefs.batteryOn);
+    float baroPilot = Dataref::getInstance()->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>(displayRefs.altimeterHpA));
 }
 
 void CISSenecaFCUEfisProfile::buttonPressed(const FCUEfisButtonDef *button, XPLMCommandPhase phase) {
@@ -1,6 +1,7 @@
 #ifndef CIS_SENECA_FCU_EFIS_PROFILE_H
 #define CIS_SENECA_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,19 @@
 #include <unordered_map>
 
 class CISSenecaFCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId servosOn;
+                DatarefId headingStatus;
+                DatarefId navStatus;
+                DatarefId altitudeHoldStatus;
+                DatarefId batteryOn;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId altimeterHpA;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         CISSenecaFCUEfisProfile(ProductFCUEfis *product);
 
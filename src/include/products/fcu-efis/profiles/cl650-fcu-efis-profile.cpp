@@ -14,7 +14,8 @@ CL650FCUEfisProfile::CL650FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         product->setLedBrightness(FCUEfisLed::EFISR_BACKLIGHT, target);
         product->setLedBrightness(FCUEfisLed::EFISL_BACKLIGHT, target);
         product->forceStateSync();
-    });
+    },
+        nullptr, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>("CL650/lamps/glareshield/FCP/ap_eng_1", [product](float val) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, val > 0.5f ? 1 : 0);
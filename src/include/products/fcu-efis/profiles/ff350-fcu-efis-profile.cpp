@@ -11,7 +11,41 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<FF350FCUEfisProfile::DisplayRefs> FF350FCUEfisProfile::displayRefTable[] = {
+    {"AirbusFBW/FCUAvail", &DisplayRefs::fcuAvail},
+    {"AirbusFBW/AnnunMode", &DisplayRefs::annunMode},
+
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"AirbusFBW/SPDmanaged", &DisplayRefs::spdManaged},
+    {"AirbusFBW/SPDdashed", &DisplayRefs::spdDashed},
+
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"AirbusFBW/HDGmanaged", &DisplayRefs::hdgManaged},
+    {"AirbusFBW/HDGdashed", &DisplayRefs::hdgDashed},
+
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"AirbusFBW/ALTmanaged", &DisplayRefs::altManaged},
+
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"AirbusFBW/VSdashed", &DisplayRefs::vsDashed},
+
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"AirbusFBW/HDGTRKmode", &DisplayRefs::hdgTrkMode},
+
+    {"AirbusFBW/AP1Engage"},
+    {"AirbusFBW/AP2Engage"},
+
+    {"AirbusFBW/BaroStdCapt", &DisplayRefs::baroStdCapt},
+    {"AirbusFBW/BaroUnitCapt", &DisplayRefs::baroUnitCapt},
+    {"AirbusFBW/BaroStdFO", &DisplayRefs::baroStdFO},
+    {"AirbusFBW/BaroUnitFO", &DisplayRefs::baroUnitFO},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+};
+
 FF350FCUEfisProfile::FF350FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/SupplLightLevelRehostats", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 2) {
             return;
@@ -38,7 +72,7 @@ FF350FCUEfisProfile::FF350FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/AP1Engage", [this, product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged || isAnnunTest() ? 1 : 0);
@@ -169,12 +203,12 @@ FF350FCUEfisProfile::FF350FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/NDShowNDBCapt");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/NDShowARPTCapt");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FCUAvail", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/SupplLightLevelRehostats");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool FF350FCUEfisProfile::IsEligible() {
@@ -185,38 +219,7 @@ bool FF350FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &FF350FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "AirbusFBW/FCUAvail",
-        "AirbusFBW/AnnunMode",
-
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "AirbusFBW/SPDmanaged",
-        "AirbusFBW/SPDdashed",
-
-        "sim/cockpit/autopilot/heading_mag",
-        "AirbusFBW/HDGmanaged",
-        "AirbusFBW/HDGdashed",
-
-        "sim/cockpit/autopilot/altitude",
-        "AirbusFBW/ALTmanaged",
-
-        "sim/cockpit/autopilot/vertical_velocity",
-        "AirbusFBW/VSdashed",
-
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "AirbusFBW/HDGTRKmode",
-
-        "AirbusFBW/AP1Engage",
-        "AirbusFBW/AP2Engage",
-
-        "AirbusFBW/BaroStdCapt",
-        "AirbusFBW/BaroUnitCapt",
-        "AirbusFBW/BaroStdFO",
-        "AirbusFBW/BaroUnitFO",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -345,19 +348,19 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &FF350FCUEfisProfile::butto
 void FF350FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.displayEnabled = datarefManager->getCached<bool>("AirbusFBW/FCUAvail");
-    data.displayTest = datarefManager->getCached<int>("AirbusFBW/AnnunMode") == 2;
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.fcuAvail);
+    data.displayTest = datarefManager->getCached<int>(displayRefs.annunMode) == 2;
 
     // Set managed mode indicators - using validated int datarefs (1 or 0)
-    data.spdManaged = datarefManager->getCached<bool>("AirbusFBW/SPDmanaged");
-    data.hdgManaged = datarefManager->getCached<bool>("AirbusFBW/HDGmanaged");
-    data.altManaged = datarefManager->getCached<bool>("AirbusFBW/ALTmanaged");
+    data.spdManaged = datarefManager->getCached<bool>(displayRefs.spdManaged);
+    data.hdgManaged = datarefManager->getCached<bool>(displayRefs.hdgManaged);
+    data.altManaged = datarefManager->getCached<bool>(displayRefs.altManaged);
 
     // Speed/Mach mode - using sim/cockpit/autopilot/airspeed_is_mach (int, 1 or 0)
-    data.spdMach = datarefManager->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = datarefManager->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    data.spdMach = datarefManager->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = datarefManager->getCached<float>(displayRefs.airspeedDialKtsMach);
 
-    if (speed > 0 && datarefManager->getCached<bool>("AirbusFBW/SPDdashed") == false) {
+    if (speed > 0 && datarefManager->getCached<bool>(displayRefs.spdDashed) == false) {
         std::stringstream ss;
         if (data.spdMach) {
             // In Mach mode, format as 0.XX -> "0XX" (e.g., 0.40 -> "040", 0.82 -> "082")
@@ -373,8 +376,8 @@ void FF350FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format FCU heading display - using sim/cockpit/autopilot/heading_mag (float)
-    float heading = datarefManager->getCached<float>("sim/cockpit/autopilot/heading_mag");
-    if (heading >= 0 && datarefManager->getCached<bool>("AirbusFBW/HDGdashed") == false) {
+    float heading = datarefManager->getCached<float>(displayRefs.headingMag);
+    if (heading >= 0 && datarefManager->getCached<bool>(displayRefs.hdgDashed) == false) {
         // Convert 360 to 0 for display
         int hdgDisplay = static_cast<int>(heading) % 360;
         std::stringstream ss;
@@ -385,7 +388,7 @@ void FF350FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format FCU altitude display - using sim/cockpit/autopilot/altitude (float)
-    float altitude = datarefManager->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = datarefManager->getCached<float>(displayRefs.altitude);
     if (altitude >= 0) {
         int altInt = static_cast<int>(altitude);
         std::stringstream ss;
@@ -397,11 +400,11 @@ void FF350FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format vertical speed display - using sim/cockpit/autopilot/vertical_velocity (float)
-    float vs = datarefManager->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
-    bool vsDashed = datarefManager->getCached<bool>("AirbusFBW/VSdashed");
+    float vs = datarefManager->getCached<float>(displayRefs.verticalVelocity);
+    bool vsDashed = datarefManager->getCached<bool>(displayRefs.vsDashed);
 
     // HDG/TRK mode - using AirbusFBW/HDGTRKmode (int, HDG=0, TRK=1)
-    data.headingTrk = datarefManager->getCached<bool>("AirbusFBW/HDGTRKmode");
+    data.headingTrk = datarefManager->getCached<bool>(displayRefs.hdgTrkMode);
     data.headingHdg = !data.headingTrk;
     data.vsMode = !data.headingTrk; // VS mode when HDG mode
     data.fpaMode = data.headingTrk; // FPA mode when TRK mode
@@ -467,13 +470,13 @@ void FF350FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     for (int i = 0; i < 2; i++) {
         bool isCaptain = i == 0;
 
-        bool isStd = datarefManager->getCached<bool>(isCaptain ? "AirbusFBW/BaroStdCapt" : "AirbusFBW/BaroStdFO");
-        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? "AirbusFBW/BaroUnitCapt" : "AirbusFBW/BaroUnitFO");
-        float baroValue = datarefManager->getCached<float>(isCaptain ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot" : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+        bool isStd = datarefManager->getCached<bool>(isCaptain ? displayRefs.baroStdCapt : displayRefs.baroStdFO);
+        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? displayRefs.baroUnitCapt : displayRefs.baroUnitFO);
+        float baroValue = datarefManager->getCached<float>(isCaptain ? displayRefs.barometerSettingInHgPilot : displayRefs.barometerSettingInHgCopilot);
 
         EfisDisplayValue value = {
-            .displayEnabled = datarefManager->getCached<bool>("AirbusFBW/FCUAvail"),
-            .displayTest = datarefManager->getCached<int>("AirbusFBW/AnnunMode") == 2,
+            .displayEnabled = datarefManager->getCached<bool>(displayRefs.fcuAvail),
+            .displayTest = datarefManager->getCached<int>(displayRefs.annunMode) == 2,
             .baro = "",
             .unitIsInHg = false,
             .isStd = isStd,
@@ -1,6 +1,7 @@
 #ifndef FFA350_FCU_EFIS_PROFILE_H
 #define FFA350_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -10,6 +11,30 @@
 class FF350FCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         bool isAnnunTest();
+        struct DisplayRefs {
+                DatarefId fcuAvail;
+                DatarefId annunMode;
+                DatarefId spdManaged;
+                DatarefId hdgManaged;
+                DatarefId altManaged;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId spdDashed;
+                DatarefId headingMag;
+                DatarefId hdgDashed;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId vsDashed;
+                DatarefId hdgTrkMode;
+                DatarefId baroStdCapt;
+                DatarefId baroStdFO;
+                DatarefId baroUnitCapt;
+                DatarefId baroUnitFO;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FF350FCUEfisProfile(ProductFCUEfis *product);
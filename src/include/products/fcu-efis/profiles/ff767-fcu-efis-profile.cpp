@@ -11,7 +11,70 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<FF767FCUEfisProfile::DisplayRefs> FF767FCUEfisProfile::displayRefTable[] = {
+
+    // MCP - Power
+    {"sim/cockpit2/autopilot/autopilot_has_power", &DisplayRefs::autopilotHasPower},
+    {"1-sim/AP/desengageLever"},
+
+    // MCP - Speed
+    {"1-sim/AP/iasmach", &DisplayRefs::iasMach},
+    //"777/autopilot/speed_mode", // SPD, FLCH, etc.
+    {"1-sim/AP/dig3/spdSetting", &DisplayRefs::spdSetting},
+    //"1-sim/output/mcp/fma_spd_mode",
+
+    // MCP - Heading
+    // "1-sim/output/mcp/isHdgTrg",
+    {"1-sim/AP/hdgConfButton", &DisplayRefs::hdgConfButton},
+    {"1-sim/AP/hdgSetting", &DisplayRefs::hdgSetting},
+    //"1-sim/output/mcp/fma_hdg_mode",
+
+    // MCP - Altitude
+    {"1-sim/AP/dig5/altSetting", &DisplayRefs::altSetting},
+    //"1-sim/output/mcp/fma_alt_mode",
+
+    // MCP - Vertical Speed
+    {"1-sim/AP/vviSetting", &DisplayRefs::vviSetting},
+    //"1-sim/output/mcp/fma_vs_mode",
+
+    // EFIS - Barometric settings
+    {"1-sim/gauges/baroINHg1_left"},
+    {"1-sim/gauges/baroINHg1_right"},
+    {"1-sim/gauges/baroHPa1_left"},
+    {"1-sim/gauges/baroHPa1_right"},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    {"1-sim/ckpt/cptHsiStdButton/anim"},
+    {"1-sim/ckpt/foHsiStdButton/anim"},
+
+    {"1-sim/efis/isBaroHpaL", &DisplayRefs::isBaroHpaL}, // 0=inHg,1=hPa
+    {"1-sim/efis/isBaroHpaR", &DisplayRefs::isBaroHpaR},
+    {"1-sim/efis/isBaroStdL", &DisplayRefs::isBaroStdL},
+    {"1-sim/efis/isBaroStdR", &DisplayRefs::isBaroStdR},
+
+    // ND Mode and Range
+    {"1-sim/efis/ctrlPanel/1/hsiModeRotary"},
+    {"1-sim/efis/ctrlPanel/2/hsiModeRotary"},
+    {"1-sim/ndpanel/1/hsiRangeRotary"},
+    {"1-sim/ndpanel/2/hsiRangeRotary"},
+
+    {"1-sim/testPanel/test1Button"},
+
+    // ND Display options
+    {"1-sim/ckpt/cptHsiWptButton/anim"},
+    {"1-sim/ckpt/cptHsiStaButton/anim"},
+    {"1-sim/ckpt/cptHsiDataButton/anim"},
+    {"1-sim/ckpt/cptHsiArptButton/anim"},
+    {"1-sim/ckpt/foHsiWptButton/anim"},
+    {"1-sim/ckpt/foHsiStaButton/anim"},
+    {"1-sim/ckpt/foHsiDataButton/anim"},
+    {"1-sim/ckpt/foHsiArptButton/anim"},
+
+};
+
 FF767FCUEfisProfile::FF767FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<float>("lights/glareshield1_rhe", [product](float brightness) {
         bool hasPower = Dataref::getInstance()->getCached<bool>("sim/cockpit2/autopilot/autopilot_has_power");
 
@@ -33,7 +96,7 @@ FF767FCUEfisProfile::FF767FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // We abuse the GPU dataref to trigger an update when the UI is closed.
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/electrical/gpuAvailable", [product](bool gpuDispo) {
@@ -44,7 +107,7 @@ FF767FCUEfisProfile::FF767FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/autopilot_has_power", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("lights/glareshield1_rhe");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/AP/lnavButton", [this, product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged || isTestMode() ? 1 : 0);
@@ -146,7 +209,7 @@ FF767FCUEfisProfile::FF767FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         product->setLedBrightness(FCUEfisLed::EFISL_NDB_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
         product->setLedBrightness(FCUEfisLed::EFISL_ARPT_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/foCAUTION", [this, product](bool isCaution) {
         bool isWarning = Dataref::getInstance()->getCached<bool>("1-sim/ckpt/lampsGlow/foWARNING");
@@ -156,17 +219,17 @@ FF767FCUEfisProfile::FF767FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         product->setLedBrightness(FCUEfisLed::EFISR_NDB_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
         product->setLedBrightness(FCUEfisLed::EFISR_ARPT_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/cptWARNING", [this, product](bool on) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/warnings/annunciators/master_caution");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/foWARNING", [this, product](bool on) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/warnings/annunciators/master_caution");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("1-sim/testPanel/test1Button", [this, product](int isTest) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/autopilot/autopilot_has_power");
@@ -222,67 +285,7 @@ bool FF767FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &FF767FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-
-        // MCP - Power
-        "sim/cockpit2/autopilot/autopilot_has_power",
-        "1-sim/AP/desengageLever",
-
-        // MCP - Speed
-        "1-sim/AP/iasmach",
-        //"777/autopilot/speed_mode", // SPD, FLCH, etc.
-        "1-sim/AP/dig3/spdSetting",
-        //"1-sim/output/mcp/fma_spd_mode",
-
-        // MCP - Heading
-        // "1-sim/output/mcp/isHdgTrg",
-        "1-sim/AP/hdgConfButton",
-        "1-sim/AP/hdgSetting",
-        //"1-sim/output/mcp/fma_hdg_mode",
-
-        // MCP - Altitude
-        "1-sim/AP/dig5/altSetting",
-        //"1-sim/output/mcp/fma_alt_mode",
-
-        // MCP - Vertical Speed
-        "1-sim/AP/vviSetting",
-        //"1-sim/output/mcp/fma_vs_mode",
-
-        // EFIS - Barometric settings
-        "1-sim/gauges/baroINHg1_left",
-        "1-sim/gauges/baroINHg1_right",
-        "1-sim/gauges/baroHPa1_left",
-        "1-sim/gauges/baroHPa1_right",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        "1-sim/ckpt/cptHsiStdButton/anim",
-        "1-sim/ckpt/foHsiStdButton/anim",
-
-        "1-sim/efis/isBaroHpaL", // 0=inHg,1=hPa
-        "1-sim/efis/isBaroHpaR",
-        "1-sim/efis/isBaroStdL",
-        "1-sim/efis/isBaroStdR",
-
-        // ND Mode and Range
-        "1-sim/efis/ctrlPanel/1/hsiModeRotary",
-        "1-sim/efis/ctrlPanel/2/hsiModeRotary",
-        "1-sim/ndpanel/1/hsiRangeRotary",
-        "1-sim/ndpanel/2/hsiRangeRotary",
-
-        "1-sim/testPanel/test1Button",
-
-        // ND Display options
-        "1-sim/ckpt/cptHsiWptButton/anim",
-        "1-sim/ckpt/cptHsiStaButton/anim",
-        "1-sim/ckpt/cptHsiDataButton/anim",
-        "1-sim/ckpt/cptHsiArptButton/anim",
-        "1-sim/ckpt/foHsiWptButton/anim",
-        "1-sim/ckpt/foHsiStaButton/anim",
-        "1-sim/ckpt/foHsiDataButton/anim",
-        "1-sim/ckpt/foHsiArptButton/anim",
-
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -426,11 +429,11 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &FF767FCUEfisProfile::butto
 void FF767FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.displayEnabled = datarefManager->getCached<bool>("sim/cockpit2/autopilot/autopilot_has_power");
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.autopilotHasPower);
     data.displayTest = isTestMode();
 
-    data.spdMach = datarefManager->getCached<bool>("1-sim/AP/iasmach");
-    float speed = datarefManager->getCached<float>("1-sim/AP/dig3/spdSetting");
+    data.spdMach = datarefManager->getCached<bool>(displayRefs.iasMach);
+    float speed = datarefManager->getCached<float>(displayRefs.spdSetting);
 
     if (speed > 0) {
         std::stringstream ss;
@@ -448,7 +451,7 @@ void FF767FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.spdManaged = false;
 
     // HDG ------------------------------------------------------------------------------
-    float heading = datarefManager->getCached<float>("1-sim/AP/hdgSetting");
+    float heading = datarefManager->getCached<float>(displayRefs.hdgSetting);
     if (heading >= 0) {
         int hdgDisplay = static_cast<int>(heading) % 360;
         std::stringstream ss;
@@ -463,10 +466,10 @@ void FF767FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.hdgManaged = false;
 
     // to be disabled on 767: no TRK mode!?
-    //data.headingHdg = datarefManager->getCached<bool>("1-sim/AP/hdgConfButton") == false;
+    //data.headingHdg = datarefManager->getCached<bool>(displayRefs.hdgConfButton) == false;
 
     // ALT ------------------------------------------------------------------------------
-    float altitude = datarefManager->getCached<float>("1-sim/AP/dig5/altSetting");
+    float altitude = datarefManager->getCached<float>(displayRefs.altSetting);
     if (altitude > 0) {
         //int altInt = static_cast<int>(altitude);
         int altInt = static_cast<int>(std::round(altitude / 100.0f) * 100);
@@ -479,7 +482,7 @@ void FF767FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
 
     data.altManaged = false;
 
-    float vs = datarefManager->getCached<float>("1-sim/AP/vviSetting");
+    float vs = datarefManager->getCached<float>(displayRefs.vviSetting);
 
     data.vsMode = true;
     data.fpaMode = false;
@@ -500,12 +503,12 @@ void FF767FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     for (int i = 0; i < 2; i++) {
         bool isCaptain = i == 0;
 
-        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? "1-sim/efis/isBaroHpaL" : "1-sim/efis/isBaroHpaR");
+        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? displayRefs.isBaroHpaL : displayRefs.isBaroHpaR);
 
-        bool isStdCapt = datarefManager->getCached<bool>("1-sim/efis/isBaroStdL");
-        bool isStdFoff = datarefManager->getCached<bool>("1-sim/efis/isBaroStdR");
+        bool isStdCapt = datarefManager->getCached<bool>(displayRefs.isBaroStdL);
+        bool isStdFoff = datarefManager->getCached<bool>(displayRefs.isBaroStdR);
 
-        float baroValue = datarefManager->getCached<float>(isCaptain ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot" : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+        float baroValue = datarefManager->getCached<float>(isCaptain ? displayRefs.barometerSettingInHgPilot : displayRefs.barometerSettingInHgCopilot);
 
         EfisDisplayValue value = {
             .displayEnabled = data.displayEnabled,
@@ -1,6 +1,7 @@
 #ifndef FF767_FCU_EFIS_PROFILE_H
 #define FF767_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -12,6 +13,23 @@ class FF767FCUEfisProfile : public FCUEfisAircraftProfile {
         bool isTestMode();
         bool isStdCaptain;
         bool isStdFirstOfficer;
+        struct DisplayRefs {
+                DatarefId autopilotHasPower;
+                DatarefId iasMach;
+                DatarefId spdSetting;
+                DatarefId hdgSetting;
+                DatarefId hdgConfButton;
+                DatarefId altSetting;
+                DatarefId vviSetting;
+                DatarefId isBaroHpaL;
+                DatarefId isBaroHpaR;
+                DatarefId isBaroStdL;
+                DatarefId isBaroStdR;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FF767FCUEfisProfile(ProductFCUEfis *product);
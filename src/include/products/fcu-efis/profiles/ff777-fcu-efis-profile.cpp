@@ -11,7 +11,68 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<FF777FCUEfisProfile::DisplayRefs> FF777FCUEfisProfile::displayRefTable[] = {
+    //"T7Avionics/mcp_power",
+    {"1-sim/output/mcp/ok", &DisplayRefs::mcpOk},
+
+    // MCP - Speed
+    //"sim/cockpit2/autopilot/airspeed_dial_kts_mach",
+    //"sim/cockpit/autopilot/airspeed_is_mach",
+    {"1-sim/output/mcp/isMachTrg", &DisplayRefs::isMachTrg},
+    {"1-sim/output/mcp/isHdgTrg", &DisplayRefs::isHdgTrg},
+    //"777/autopilot/speed_mode", // SPD, FLCH, etc.
+    {"1-sim/output/mcp/spd", &DisplayRefs::mcpSpd},
+    {"1-sim/output/mcp/fma_spd_mode"},
+
+    // MCP - Heading
+    //"sim/cockpit/autopilot/heading_mag",
+    //"777/autopilot/heading_hold_active",
+    {"1-sim/output/mcp/hdg", &DisplayRefs::mcpHdg},
+    {"1-sim/output/mcp/fma_hdg_mode"},
+
+    // MCP - Altitude
+    //"sim/cockpit/autopilot/altitude",
+    //"777/autopilot/altitude_hold_active",
+    {"1-sim/output/mcp/alt", &DisplayRefs::mcpAlt},
+    {"1-sim/output/mcp/fma_alt_mode"},
+
+    // MCP - Vertical Speed
+    //"sim/cockpit/autopilot/vertical_velocity",
+    //"777/autopilot/vnav_active",
+    {"1-sim/output/mcp/vs", &DisplayRefs::mcpVs},
+    {"1-sim/output/mcp/fma_vs_mode"},
+
+    // EFIS - Barometric settings
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    // "777/displays/captain_baro_unit", // 0=inHg, 1=hPa
+    // "777/displays/fo_baro_unit",
+    {"1-sim/output/efis/capt/baro_mode"}, // 0=inHg, 1=hPa
+    {"1-sim/output/efis/fo/baro_mode"},
+
+    // ND Mode and Range
+    // "777/displays/captain_nd_mode", // 0=APP, 1=VOR, 2=MAP, 3=PLAN
+    // "777/displays/fo_nd_mode",
+    // "777/displays/captain_nd_range",
+    // "777/displays/fo_nd_range",
+    {"1-sim/efis/capt/nd_mode"}, // 0=APP, 1=VOR, 2=MAP, 3=PLAN
+    {"1-sim/efis/FO/nd_mode"},
+    {"1-sim/efis/capt/nd_range"},
+    {"1-sim/efis/fo/nd_range"},
+
+    {"1-sim/ckpt/indLightTestSwitch/anim"},
+    {"1-sim/output/mcp/isSpdOpen", &DisplayRefs::isSpdOpen},
+    {"1-sim/output/mcp/isVsOpen", &DisplayRefs::isVsOpen},
+    {"1-sim/ckpt/lampsGlow/mcpLNAV", &DisplayRefs::mcpLNAV},
+    {"1-sim/ckpt/lampsGlow/mcpVNAV", &DisplayRefs::mcpVNAV},
+
+    {"1-sim/ckpt/cptHsiBaroModeRotary/anim", &DisplayRefs::cptHsiBaroModeRotaryAnim},
+    {"1-sim/ckpt/foHsiBaroModeRotary/anim", &DisplayRefs::foHsiBaroModeRotaryAnim},
+};
+
 FF777FCUEfisProfile::FF777FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/lights/glareshield", [product](float brightness) {
         bool hasPower = Dataref::getInstance()->getCached<bool>("1-sim/output/mcp/ok");
         uint8_t target = hasPower ? brightness * 255 : 0;
@@ -32,7 +93,7 @@ FF777FCUEfisProfile::FF777FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // We abuse the GPU hatch dataref to trigger an update when the UI is closed.
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/anim/hatchGPU", [product](bool gpuHatchOpen) {
@@ -43,7 +104,7 @@ FF777FCUEfisProfile::FF777FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/output/mcp/ok", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lights/glareshield");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/mcpCaptAP", [this, product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged || isTestMode() ? 1 : 0);
@@ -87,7 +148,7 @@ FF777FCUEfisProfile::FF777FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         product->setLedBrightness(FCUEfisLed::EFISL_NDB_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
         product->setLedBrightness(FCUEfisLed::EFISL_ARPT_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/foCAUTION", [this, product](bool isCaution) {
         bool isWarning = Dataref::getInstance()->getCached<bool>("1-sim/ckpt/lampsGlow/foWARNING");
@@ -97,17 +158,17 @@ FF777FCUEfisProfile::FF777FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         product->setLedBrightness(FCUEfisLed::EFISR_NDB_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
         product->setLedBrightness(FCUEfisLed::EFISR_ARPT_GREEN, isCaution || isWarning || isTestMode() ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/cptWARNING", [this, product](bool on) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lampsGlow/cptCAUTION");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lampsGlow/foWARNING", [this, product](bool on) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lampsGlow/foCAUTION");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("1-sim/ckpt/indLightTestSwitch/anim", [this, product](int isTest) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/output/mcp/ok");
@@ -122,7 +183,7 @@ FF777FCUEfisProfile::FF777FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lampsGlow/cptWARNING");
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lampsGlow/foWARNING");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/cptHsiStdButton/anim", [this, product](float animValue) {
         AppState::getInstance()->executeAfterDebounced("cptStdChanged", 50, this, [this, product]() {
@@ -160,62 +221,7 @@ bool FF777FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &FF777FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        //"T7Avionics/mcp_power",
-        "1-sim/output/mcp/ok",
-
-        // MCP - Speed
-        //"sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        //"sim/cockpit/autopilot/airspeed_is_mach",
-        "1-sim/output/mcp/isMachTrg",
-        "1-sim/output/mcp/isHdgTrg",
-        //"777/autopilot/speed_mode", // SPD, FLCH, etc.
-        "1-sim/output/mcp/spd",
-        "1-sim/output/mcp/fma_spd_mode",
-
-        // MCP - Heading
-        //"sim/cockpit/autopilot/heading_mag",
-        //"777/autopilot/heading_hold_active",
-        "1-sim/output/mcp/hdg",
-        "1-sim/output/mcp/fma_hdg_mode",
-
-        // MCP - Altitude
-        //"sim/cockpit/autopilot/altitude",
-        //"777/autopilot/altitude_hold_active",
-        "1-sim/output/mcp/alt",
-        "1-sim/output/mcp/fma_alt_mode",
-
-        // MCP - Vertical Speed
-        //"sim/cockpit/autopilot/vertical_velocity",
-        //"777/autopilot/vnav_active",
-        "1-sim/output/mcp/vs",
-        "1-sim/output/mcp/fma_vs_mode",
-
-        // EFIS - Barometric settings
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        // "777/displays/captain_baro_unit", // 0=inHg, 1=hPa
-        // "777/displays/fo_baro_unit",
-        "1-sim/output/efis/capt/baro_mode", // 0=inHg, 1=hPa
-        "1-sim/output/efis/fo/baro_mode",
-
-        // ND Mode and Range
-        // "777/displays/captain_nd_mode", // 0=APP, 1=VOR, 2=MAP, 3=PLAN
-        // "777/displays/fo_nd_mode",
-        // "777/displays/captain_nd_range",
-        // "777/displays/fo_nd_range",
-        "1-sim/efis/capt/nd_mode", // 0=APP, 1=VOR, 2=MAP, 3=PLAN
-        "1-sim/efis/FO/nd_mode",
-        "1-sim/efis/capt/nd_range",
-        "1-sim/efis/fo/nd_range",
-
-        "1-sim/ckpt/indLightTestSwitch/anim",
-        "1-sim/output/mcp/isSpdOpen",
-        "1-sim/output/mcp/isVsOpen",
-        "1-sim/ckpt/lampsGlow/mcpLNAV",
-        "1-sim/ckpt/lampsGlow/mcpVNAV",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -347,16 +353,16 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &FF777FCUEfisProfile::butto
 void FF777FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.displayEnabled = datarefManager->getCached<bool>("1-sim/output/mcp/ok");
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.mcpOk);
     data.displayTest = isTestMode();
 
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::All;
     data.displayEnabledWindowsFlag &= ~FCUDisplayData::LevelChangeHeader;
 
-    data.spdMach = datarefManager->getCached<bool>("1-sim/output/mcp/isMachTrg");
-    float speed = datarefManager->getCached<float>("1-sim/output/mcp/spd");
+    data.spdMach = datarefManager->getCached<bool>(displayRefs.isMachTrg);
+    float speed = datarefManager->getCached<float>(displayRefs.mcpSpd);
 
-    bool isSpdOpen = datarefManager->getCached<bool>("1-sim/output/mcp/isSpdOpen");
+    bool isSpdOpen = datarefManager->getCached<bool>(displayRefs.isSpdOpen);
     if (isSpdOpen) {
         if (speed > 0) {
             std::stringstream ss;
@@ -377,7 +383,7 @@ void FF777FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
 
     data.spdManaged = false;
 
-    float heading = datarefManager->getCached<float>("1-sim/output/mcp/hdg");
+    float heading = datarefManager->getCached<float>(displayRefs.mcpHdg);
     if (heading >= 0) {
         int hdgDisplay = static_cast<int>(heading) % 360;
         std::stringstream ss;
@@ -387,11 +393,11 @@ void FF777FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.heading = "---";
     }
 
-    data.hdgManaged = datarefManager->getCached<bool>("1-sim/ckpt/lampsGlow/mcpLNAV");
-    data.headingHdg = datarefManager->getCached<bool>("1-sim/output/mcp/isHdgTrg");
+    data.hdgManaged = datarefManager->getCached<bool>(displayRefs.mcpLNAV);
+    data.headingHdg = datarefManager->getCached<bool>(displayRefs.isHdgTrg);
     data.headingTrk = !data.headingHdg;
 
-    float altitude = datarefManager->getCached<float>("1-sim/output/mcp/alt");
+    float altitude = datarefManager->getCached<float>(displayRefs.mcpAlt);
     if (altitude >= 0) {
         int altInt = static_cast<int>(altitude);
         std::stringstream ss;
@@ -401,14 +407,14 @@ void FF777FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.altitude = "-----";
     }
 
-    data.altManaged = datarefManager->getCached<bool>("1-sim/ckpt/lampsGlow/mcpVNAV");
+    data.altManaged = datarefManager->getCached<bool>(displayRefs.mcpVNAV);
 
-    float vs = datarefManager->getCached<float>("1-sim/output/mcp/vs");
+    float vs = datarefManager->getCached<float>(displayRefs.mcpVs);
 
     data.vsMode = true;
     data.fpaMode = false;
 
-    bool isVsOpen = datarefManager->getCached<bool>("1-sim/output/mcp/isVsOpen");
+    bool isVsOpen = datarefManager->getCached<bool>(displayRefs.isVsOpen);
     if (isVsOpen) {
         std::stringstream ss;
         int vsInt = static_cast<int>(std::round(vs));
@@ -432,8 +438,8 @@ void FF777FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     for (int i = 0; i < 2; i++) {
         bool isCaptain = i == 0;
 
-        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? "1-sim/ckpt/cptHsiBaroModeRotary/anim" : "1-sim/ckpt/foHsiBaroModeRotary/anim");
-        float baroValue = datarefManager->getCached<float>(isCaptain ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot" : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? displayRefs.cptHsiBaroModeRotaryAnim : displayRefs.foHsiBaroModeRotaryAnim);
+        float baroValue = datarefManager->getCached<float>(isCaptain ? displayRefs.barometerSettingInHgPilot : displayRefs.barometerSettingInHgCopilot);
 
         EfisDisplayValue value = {
             .displayEnabled = data.displayEnabled,
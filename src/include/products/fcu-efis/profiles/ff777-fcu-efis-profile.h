@@ -1,6 +1,7 @@
 #ifndef FF777_FCU_EFIS_PROFILE_H
 #define FF777_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -12,6 +13,25 @@ class FF777FCUEfisProfile : public FCUEfisAircraftProfile {
         bool isTestMode();
         bool isStdCaptain;
         bool isStdFirstOfficer;
+        struct DisplayRefs {
+                DatarefId mcpOk;
+                DatarefId isMachTrg;
+                DatarefId mcpSpd;
+                DatarefId isSpdOpen;
+                DatarefId mcpHdg;
+                DatarefId mcpLNAV;
+                DatarefId isHdgTrg;
+                DatarefId mcpAlt;
+                DatarefId mcpVNAV;
+                DatarefId mcpVs;
+                DatarefId isVsOpen;
+                DatarefId cptHsiBaroModeRotaryAnim;
+                DatarefId foHsiBaroModeRotaryAnim;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FF777FCUEfisProfile(ProductFCUEfis *product);
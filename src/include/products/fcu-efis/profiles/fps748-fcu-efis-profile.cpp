@@ -10,11 +10,35 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+// Names starting with '/' get the variant's prefix, see displayDatarefs().
+const DisplayRef<FPS748FCUEfisProfile::DisplayRefs> FPS748FCUEfisProfile::displayRefTable[] = {
+    {"/Elec/bus_1_powered", &DisplayRefs::bus1Powered},
+    {"/B748/MCP/mcp_ias_mach_act", &DisplayRefs::mcpIasMachAct},
+    {"/B748/systems/athr/MCPSPD_spdmach", &DisplayRefs::mcpSpdMach},
+    {"/B748/mcp/speed_is_blank", &DisplayRefs::speedIsBlank},
+    {"/B748/MCP/mcp_heading_bug_act", &DisplayRefs::mcpHeadingBugAct},
+    {"/B748/ND/tk_hdg_pfd", &DisplayRefs::tkHdgPfd},
+    {"/B748/MCP/mcp_alt_target_act", &DisplayRefs::mcpAltTargetAct},
+    {"/B748/MCP/mcp_vs_target_act", &DisplayRefs::mcpVsTargetAct},
+    {"/B748/mcp/vs_is_blank", &DisplayRefs::vsIsBlank},
+    {"FPS/PFD/baro_now", &DisplayRefs::baroNow},
+    {"FPS/PFD/baro_now2", &DisplayRefs::baroNow2},
+    {"FPS/PFD/baro_standard", &DisplayRefs::baroStandard},
+    {"FPS/PFD/baro_standard2", &DisplayRefs::baroStandard2},
+    {"FPS/PFD/baro_type_sw", &DisplayRefs::baroTypeSw},
+    {"/B748/ND/mode_pilot"},
+    {"/B748/ND/mode_copilot"},
+    {"/B748/ND/range_pilot"},
+    {"/B748/ND/range_copilot"},
+};
+
 FPS748FCUEfisProfile::FPS748FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
     bool isSSG = IsSSGVersion();
     std::string prefix = isSSG ? "SSG" : "FPS";
     std::string altPrefix = isSSG ? "ssg" : "FPS";
 
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<float>((altPrefix + "/LGT/glaresheld_sw").c_str(), [product, altPrefix](float brightness) {
         bool hasPower = Dataref::getInstance()->getCached<bool>((altPrefix + "/Elec/bus_1_powered").c_str());
         uint8_t target = hasPower ? brightness * 255 : 0;
@@ -34,12 +58,12 @@ FPS748FCUEfisProfile::FPS748FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAir
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>((altPrefix + "/Elec/bus_1_powered").c_str(), [altPrefix](bool powered) {
         Dataref::getInstance()->executeChangedCallbacksForDataref((altPrefix + "/LGT/glaresheld_sw").c_str());
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // MCP engagement LEDs
     Dataref::getInstance()->monitorExistingDataref<float>((prefix + "/B748/MCP/mcp_a_cmd_act").c_str(), [product](float engaged) {
@@ -128,30 +152,21 @@ bool FPS748FCUEfisProfile::IsEligible() {
 
 const std::vector<std::string> &FPS748FCUEfisProfile::displayDatarefs() const {
     bool isSSG = IsSSGVersion();
-    std::string prefix = isSSG ? "SSG" : "FPS";
-    std::string altPrefix = isSSG ? "ssg" : "FPS";
     static std::unordered_map<bool, std::vector<std::string>> cache;
 
-    return cache.try_emplace(isSSG, std::vector<std::string>{
-                                        altPrefix + "/Elec/bus_1_powered",
-                                        prefix + "/B748/MCP/mcp_ias_mach_act",
-                                        prefix + "/B748/systems/athr/MCPSPD_spdmach",
-                                        prefix + "/B748/mcp/speed_is_blank",
-                                        prefix + "/B748/MCP/mcp_heading_bug_act",
-                                        prefix + "/B748/ND/tk_hdg_pfd",
-                                        prefix + "/B748/MCP/mcp_alt_target_act",
-                                        prefix + "/B748/MCP/mcp_vs_target_act",
-                                        prefix + "/B748/mcp/vs_is_blank",
-                                        "FPS/PFD/baro_now",
-                                        "FPS/PFD/baro_now2",
-                                        "FPS/PFD/baro_standard",
-                                        "FPS/PFD/baro_standard2",
-                                        "FPS/PFD/baro_type_sw",
-                                        prefix + "/B748/ND/mode_pilot",
-                                        prefix + "/B748/ND/mode_copilot",
-                                        prefix + "/B748/ND/range_pilot",
-                                        prefix + "/B748/ND/range_copilot"})
-        .first->second;
+    auto it = cache.find(isSSG);
+    if (it == cache.end()) {
+        std::vector<std::string> refs = displayRefNames(displayRefTable, [isSSG](const char *name) {
+            if (name[0] != '/') {
+                return std::string(name);
+            }
+            // The electrical refs use a lower-case "ssg" prefix
+            bool elec = std::string_view(name).starts_with("/Elec/");
+            return std::string(isSSG ? (elec ? "ssg" : "SSG") : "FPS") + name;
+        });
+        it = cache.emplace(isSSG, std::move(refs)).first;
+    }
+    return it->second;
 }
 
 const std::unordered_map<uint16_t, FCUEfisButtonDef> &FPS748FCUEfisProfile::buttonDefs() const {
@@ -280,21 +295,17 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &FPS748FCUEfisProfile::butt
 }
 
 void FPS748FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
-    bool isSSG = IsSSGVersion();
-    std::string prefix = isSSG ? "SSG" : "FPS";
-    std::string altPrefix = isSSG ? "ssg" : "FPS";
-
     auto dm = Dataref::getInstance();
 
-    data.displayEnabled = dm->getCached<bool>((altPrefix + "/Elec/bus_1_powered").c_str());
+    data.displayEnabled = dm->getCached<bool>(displayRefs.bus1Powered);
     data.displayTest = false;
 
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::All;
     data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::LevelChangeHeader;
 
     // Speed
-    bool speedBlank = dm->getCached<float>((prefix + "/B748/mcp/speed_is_blank").c_str()) > 0.5f;
-    bool isMach = dm->getCached<float>((prefix + "/B748/systems/athr/MCPSPD_spdmach").c_str()) > 0.5f;
+    bool speedBlank = dm->getCached<float>(displayRefs.speedIsBlank) > 0.5f;
+    bool isMach = dm->getCached<float>(displayRefs.mcpSpdMach) > 0.5f;
     data.spdMach = isMach;
 
     if (speedBlank) {
@@ -302,7 +313,7 @@ void FPS748FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::SpeedMachValue;
         data.speed = "---";
     } else {
-        float speed = dm->getCached<float>((prefix + "/B748/MCP/mcp_ias_mach_act").c_str());
+        float speed = dm->getCached<float>(displayRefs.mcpIasMachAct);
         if (speed > 0) {
             std::stringstream ss;
             if (isMach) {
@@ -319,12 +330,12 @@ void FPS748FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.spdManaged = false;
 
     // Heading
-    bool isTrk = dm->getCached<int>((prefix + "/B748/ND/tk_hdg_pfd").c_str()) != 0;
+    bool isTrk = dm->getCached<int>(displayRefs.tkHdgPfd) != 0;
     data.headingHdg = !isTrk;
     data.headingTrk = isTrk;
     data.headingLat = true;
 
-    float heading = dm->getCached<float>((prefix + "/B748/MCP/mcp_heading_bug_act").c_str());
+    float heading = dm->getCached<float>(displayRefs.mcpHeadingBugAct);
     if (heading >= 0) {
         std::stringstream ss;
         ss << std::setfill('0') << std::setw(3) << (static_cast<int>(heading) % 360);
@@ -335,7 +346,7 @@ void FPS748FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.hdgManaged = false;
 
     // Altitude
-    float altitude = dm->getCached<float>((prefix + "/B748/MCP/mcp_alt_target_act").c_str());
+    float altitude = dm->getCached<float>(displayRefs.mcpAltTargetAct);
     if (altitude > 0) {
         int altInt = static_cast<int>(std::round(altitude / 100.0f) * 100);
         std::stringstream ss;
@@ -347,8 +358,8 @@ void FPS748FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.altManaged = false;
 
     // Vertical speed
-    bool vsBlank = dm->getCached<float>((prefix + "/B748/mcp/vs_is_blank").c_str()) > 0.5f;
-    float vs = dm->getCached<float>((prefix + "/B748/MCP/mcp_vs_target_act").c_str());
+    bool vsBlank = dm->getCached<float>(displayRefs.vsIsBlank) > 0.5f;
+    float vs = dm->getCached<float>(displayRefs.mcpVsTargetAct);
 
     data.vsMode = true;
     data.fpaMode = false;
@@ -371,13 +382,13 @@ void FPS748FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // EFIS baro
-    bool baroIsHpa = dm->getCached<bool>("FPS/PFD/baro_type_sw");
-    float captainBaroValue = dm->getCached<float>("FPS/PFD/baro_now");
-    bool captainIsStd = dm->getCached<bool>("FPS/PFD/baro_standard");
+    bool baroIsHpa = dm->getCached<bool>(displayRefs.baroTypeSw);
+    float captainBaroValue = dm->getCached<float>(displayRefs.baroNow);
+    bool captainIsStd = dm->getCached<bool>(displayRefs.baroStandard);
     for (int i = 0; i < 2; i++) {
         bool isCaptain = (i == 0);
-        float foBaroValue = dm->getCached<float>("FPS/PFD/baro_now2");
-        bool foIsStd = dm->getCached<bool>("FPS/PFD/baro_standard2");
+        float foBaroValue = dm->getCached<float>(displayRefs.baroNow2);
+        bool foIsStd = dm->getCached<bool>(displayRefs.baroStandard2);
         // FO baro_now2 = 0 means not independently set — mirror captain
         float baroValue = isCaptain ? captainBaroValue : (foBaroValue > 0 ? foBaroValue : captainBaroValue);
         bool isStd = isCaptain ? captainIsStd : (foBaroValue > 0 ? foIsStd : captainIsStd);
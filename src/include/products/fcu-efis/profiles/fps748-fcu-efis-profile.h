@@ -1,6 +1,7 @@
 #ifndef FPS748_FCU_EFIS_PROFILE_H
 #define FPS748_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <string>
@@ -9,6 +10,24 @@ class FPS748FCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         static bool IsSSGVersion();
         static bool IsFPSVersion();
+        struct DisplayRefs {
+                DatarefId bus1Powered;
+                DatarefId speedIsBlank;
+                DatarefId mcpSpdMach;
+                DatarefId mcpIasMachAct;
+                DatarefId tkHdgPfd;
+                DatarefId mcpHeadingBugAct;
+                DatarefId mcpAltTargetAct;
+                DatarefId vsIsBlank;
+                DatarefId mcpVsTargetAct;
+                DatarefId baroTypeSw;
+                DatarefId baroNow;
+                DatarefId baroStandard;
+                DatarefId baroNow2;
+                DatarefId baroStandard2;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FPS748FCUEfisProfile(ProductFCUEfis *product);
@@ -11,7 +11,36 @@
 #include <iomanip>
 #include <sstream>
 
+const DisplayRef<JAR330FCUEfisProfile::DisplayRefs> JAR330FCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+
+    // Autopilot speed (Airbus format)
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+
+    // Heading
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+
+    // Altitude
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+
+    // Vertical speed
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+
+    // Barometer settings
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot"},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot"},
+
+    // JAR A330 specific barometer unit selection (if available)
+    // "jd/barometer/capt_inHg_hPa_pos",
+    // "jd/barometer/fo_inHg_hPa_pos",
+};
+
 JAR330FCUEfisProfile::JAR330FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     product->setAllLedsEnabled(false);
 
     // Monitor power and brightness
@@ -37,12 +66,12 @@ JAR330FCUEfisProfile::JAR330FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAir
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/battery_on");
 
@@ -55,33 +84,7 @@ bool JAR330FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &JAR330FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/battery_on",
-
-        // Autopilot speed (Airbus format)
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-
-        // Heading
-        "sim/cockpit/autopilot/heading_mag",
-
-        // Altitude
-        "sim/cockpit/autopilot/altitude",
-
-        // Vertical speed
-        "sim/cockpit/autopilot/vertical_velocity",
-
-        // Barometer settings
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot",
-
-        // JAR A330 specific barometer unit selection (if available)
-        // "jd/barometer/capt_inHg_hPa_pos",
-        // "jd/barometer/fo_inHg_hPa_pos",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -194,7 +197,7 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &JAR330FCUEfisProfile::butt
 }
 
 void JAR330FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
-    bool hasPower = Dataref::getInstance()->getCached<bool>("sim/cockpit/electrical/battery_on");
+    bool hasPower = Dataref::getInstance()->getCached<bool>(displayRefs.batteryOn);
 
     if (!hasPower) {
         data.speed = {"", {}};
@@ -212,8 +215,8 @@ void JAR330FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
     // Speed display
-    bool isMach = datarefManager->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = datarefManager->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    bool isMach = datarefManager->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = datarefManager->getCached<float>(displayRefs.airspeedDialKtsMach);
 
     if (isMach) {
         std::ostringstream ss;
@@ -232,19 +235,19 @@ void JAR330FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Heading display
-    float heading = datarefManager->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = datarefManager->getCached<float>(displayRefs.headingMag);
     std::ostringstream headingSs;
     headingSs << std::setw(3) << std::setfill('0') << static_cast<int>(heading) % 360;
     data.heading = headingSs.str();
 
     // Altitude display
-    float altitude = datarefManager->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = datarefManager->getCached<float>(displayRefs.altitude);
     std::ostringstream altSs;
     altSs << std::setw(5) << std::setfill('0') << static_cast<int>(altitude);
     data.altitude = altSs.str();
 
     // Vertical speed display
-    float vs = datarefManager->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+    float vs = datarefManager->getCached<float>(displayRefs.verticalVelocity);
     std::ostringstream vsSs;
     int vsInt = static_cast<int>(vs);
     int absVs = std::abs(vsInt);
@@ -254,8 +257,8 @@ void JAR330FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.vsMode = true;
 
     // Barometer displays (inHg)
-    float baroPilot = datarefManager->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    float baroFO = datarefManager->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+    float baroPilot = datarefManager->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    float baroFO = datarefManager->getCached<float>(displayRefs.barometerSettingInHgCopilot);
 
     data.efisLeft.setBaro(baroPilot, true);
     data.efisRight.setBaro(baroFO, true);
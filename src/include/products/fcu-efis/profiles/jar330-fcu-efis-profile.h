@@ -1,6 +1,7 @@
 #ifndef JAR330_FCU_EFIS_PROFILE_H
 #define JAR330_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,20 @@
 #include <unordered_map>
 
 class JAR330FCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId batteryOn;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         JAR330FCUEfisProfile(ProductFCUEfis *product);
 
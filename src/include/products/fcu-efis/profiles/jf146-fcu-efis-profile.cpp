@@ -1,5 +1,6 @@
 #include "jf146-fcu-efis-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-fcu-efis.h"
@@ -12,7 +13,24 @@
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
 
+const DisplayRef<JF146FCUEfisProfile::DisplayRefs> JF146FCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"thranda/autopilot/FD_Show_Pilot"},
+    {"sim/cockpit2/gauges/indicators/airspeed_kts_pilot", &DisplayRefs::airspeedKtsPilot},
+    {"sim/cockpit2/gauges/indicators/mach_pilot", &DisplayRefs::machPilot},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"thranda/TCAS/AnnLtA", &DisplayRefs::annLtA},
+    {"sim/cockpit2/autopilot/glideslope_status"},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+};
+
 JF146FCUEfisProfile::JF146FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/panel_brightness_ratio", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 4) {
             return;
@@ -36,12 +54,12 @@ JF146FCUEfisProfile::JF146FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/panel_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("sim/cockpit2/annunciators/autopilot", [product](int status) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, status == 1 ? 255 : 0);
@@ -51,7 +69,7 @@ JF146FCUEfisProfile::JF146FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
     Dataref::getInstance()->monitorExistingDataref<int>("thranda/TMS/tmsPwr", [product](int status) {
         product->setLedBrightness(FCUEfisLed::ATHR_GREEN, status == 1 ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("thranda/autopilot/FD_Show_Pilot", [product](int status) {
         product->setLedBrightness(FCUEfisLed::EFISL_FD_GREEN, status == 1 ? 255 : 0);
@@ -67,30 +85,18 @@ JF146FCUEfisProfile::JF146FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircr
         // Ensure cache is updated and trigger display update if needed
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool JF146FCUEfisProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
 
     // Will only match the 146-100, 200, 300, not the Avro
     return icao.starts_with("B46");
 }
 
 const std::vector<std::string> &JF146FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/battery_on",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        "sim/cockpit/autopilot/heading_mag",
-        "thranda/autopilot/FD_Show_Pilot",
-        "sim/cockpit2/gauges/indicators/airspeed_kts_pilot",
-        "sim/cockpit2/gauges/indicators/mach_pilot",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "thranda/TCAS/AnnLtA",
-        "sim/cockpit2/autopilot/glideslope_status"};
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -199,7 +205,7 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &JF146FCUEfisProfile::butto
 }
 
 void JF146FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
-    bool hasPower = Dataref::getInstance()->getCached<bool>("sim/cockpit/electrical/battery_on");
+    bool hasPower = Dataref::getInstance()->getCached<bool>(displayRefs.batteryOn);
 
     if (!hasPower) {
         // Clear all displays when no power
@@ -216,10 +222,10 @@ void JF146FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.headingLat = true;
 
     // Speed display
-    bool isMach = Dataref::getInstance()->getCached<int>("sim/cockpit/autopilot/airspeed_is_mach");
+    bool isMach = Dataref::getInstance()->getCached<int>(displayRefs.airspeedIsMach);
 
     if (isMach) {
-        float speed = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/indicators/mach_pilot");
+        float speed = Dataref::getInstance()->getCached<float>(displayRefs.machPilot);
         // Display as Mach number (e.g., "0.78" -> ".78")
         std::ostringstream ss;
         ss << std::fixed << std::setprecision(2) << speed;
@@ -231,7 +237,7 @@ void JF146FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.spdMach = true;
 
     } else {
-        float speed = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/indicators/airspeed_kts_pilot");
+        float speed = Dataref::getInstance()->getCached<float>(displayRefs.airspeedKtsPilot);
         // Display as knots
         std::ostringstream ss;
         ss << static_cast<int>(speed);
@@ -240,19 +246,19 @@ void JF146FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Heading display
-    float heading = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = Dataref::getInstance()->getCached<float>(displayRefs.headingMag);
     std::ostringstream headingSs;
     headingSs << std::setw(3) << std::setfill('0') << static_cast<int>(heading);
     data.heading = headingSs.str();
 
     // Altitude display
-    float altitude = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = Dataref::getInstance()->getCached<float>(displayRefs.altitude);
     std::ostringstream altSs;
     altSs << std::setw(5) << std::setfill('0') << static_cast<int>(altitude);
     data.altitude = altSs.str();
 
     // Vertical speed display
-    float vs = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+    float vs = Dataref::getInstance()->getCached<float>(displayRefs.verticalVelocity);
     std::ostringstream vsSs;
     int vsInt = static_cast<int>(vs);
     int absVs = std::abs(vsInt);
@@ -262,14 +268,14 @@ void JF146FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.vsMode = true;
 
     // Barometer displays (inHg)
-    float baroPilot = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    float baroFO = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+    float baroPilot = Dataref::getInstance()->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    float baroFO = Dataref::getInstance()->getCached<float>(displayRefs.barometerSettingInHgCopilot);
 
     data.efisLeft.setBaro(baroPilot, true);
     data.efisRight.setBaro(baroFO, true);
 
     // Update Right EFIS LEDs from TCAS Annunciator array
-    std::vector<float> tcasLights = Dataref::getInstance()->getCached<std::vector<float>>("thranda/TCAS/AnnLtA");
+    std::span<const float> tcasLights = Dataref::getInstance()->getCachedArray<float>(displayRefs.annLtA);
 
     if (tcasLights.size() >= 376) {
         auto product = dynamic_cast<ProductFCUEfis *>(this->product);
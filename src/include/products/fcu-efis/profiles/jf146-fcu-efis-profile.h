@@ -1,6 +1,7 @@
 #ifndef JF146_FCU_EFIS_PROFILE_H
 #define JF146_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -11,6 +12,20 @@ class JF146FCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         bool isAnnunTest(bool allowEssentialBusPowerOnly = false);
         std::unordered_map<const FCUEfisButtonDef *, float> lastPressTime;
+        struct DisplayRefs {
+                DatarefId batteryOn;
+                DatarefId airspeedIsMach;
+                DatarefId machPilot;
+                DatarefId airspeedKtsPilot;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+                DatarefId annLtA;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         JF146FCUEfisProfile(ProductFCUEfis *product);
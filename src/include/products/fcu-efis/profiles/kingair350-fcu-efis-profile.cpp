@@ -6,7 +6,16 @@
 
 #include <XPLMUtilities.h>
 
+const DisplayRef<KingAir350FCUEfisProfile::DisplayRefs> KingAir350FCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/autopilot/servos_on"},
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+    {"sim/physics/metric_press", &DisplayRefs::metricPress},
+};
+
 KingAir350FCUEfisProfile::KingAir350FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio_manual", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 2) {
             return;
@@ -29,7 +38,7 @@ KingAir350FCUEfisProfile::KingAir350FCUEfisProfile(ProductFCUEfis *product) : FC
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/physics/metric_press", [product](bool isMetric) {
         product->updateDisplays();
@@ -54,11 +63,7 @@ bool KingAir350FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &KingAir350FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/autopilot/servos_on",
-        "sim/cockpit/electrical/battery_on",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -100,9 +105,9 @@ void KingAir350FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.verticalSpeed = "";
     data.efisRight.baro = "";
 
-    data.efisLeft.displayEnabled = datarefManager->getCached<bool>("sim/cockpit/electrical/battery_on");
-    float baroPilot = datarefManager->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>("sim/physics/metric_press"));
+    data.efisLeft.displayEnabled = datarefManager->getCached<bool>(displayRefs.batteryOn);
+    float baroPilot = datarefManager->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    data.efisLeft.setBaro(baroPilot, !datarefManager->getCached<bool>(displayRefs.metricPress));
 }
 
 void KingAir350FCUEfisProfile::buttonPressed(const FCUEfisButtonDef *button, XPLMCommandPhase phase) {
@@ -1,6 +1,7 @@
 #ifndef KINGAIR350_FCU_EFIS_PROFILE_H
 #define KINGAIR350_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,15 @@
 #include <unordered_map>
 
 class KingAir350FCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId batteryOn;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId metricPress;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         KingAir350FCUEfisProfile(ProductFCUEfis *product);
 
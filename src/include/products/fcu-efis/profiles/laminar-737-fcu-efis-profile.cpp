@@ -11,7 +11,30 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<Laminar737FCUEfisProfile::DisplayRefs> Laminar737FCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/avionics_on", &DisplayRefs::avionicsOn},
+
+    // Autopilot speed
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+
+    // Heading
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+
+    // Altitude
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+
+    // Vertical speed
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+
+    // Barometer settings
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+};
+
 Laminar737FCUEfisProfile::Laminar737FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     // Monitor power and brightness
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/panel_brightness_ratio", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 4) {
@@ -37,12 +60,12 @@ Laminar737FCUEfisProfile::Laminar737FCUEfisProfile(ProductFCUEfis *product) : FC
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/panel_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/avionics_on");
 
@@ -109,27 +132,7 @@ bool Laminar737FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &Laminar737FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/avionics_on",
-
-        // Autopilot speed
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-
-        // Heading
-        "sim/cockpit/autopilot/heading_mag",
-
-        // Altitude
-        "sim/cockpit/autopilot/altitude",
-
-        // Vertical speed
-        "sim/cockpit/autopilot/vertical_velocity",
-
-        // Barometer settings
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -255,7 +258,7 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &Laminar737FCUEfisProfile::
 }
 
 void Laminar737FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
-    bool avionicsOn = Dataref::getInstance()->getCached<bool>("sim/cockpit/electrical/avionics_on");
+    bool avionicsOn = Dataref::getInstance()->getCached<bool>(displayRefs.avionicsOn);
 
     if (!avionicsOn) {
         // Clear all displays when no avionics power
@@ -272,8 +275,8 @@ void Laminar737FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.headingLat = true;
 
     // Speed display
-    bool isMach = Dataref::getInstance()->getCached<int>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = Dataref::getInstance()->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    bool isMach = Dataref::getInstance()->getCached<int>(displayRefs.airspeedIsMach);
+    float speed = Dataref::getInstance()->getCached<float>(displayRefs.airspeedDialKtsMach);
 
     if (isMach) {
         // Display as Mach number (e.g., "0.78" -> ".78")
@@ -295,19 +298,19 @@ void Laminar737FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Heading display
-    float heading = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = Dataref::getInstance()->getCached<float>(displayRefs.headingMag);
     std::ostringstream headingSs;
     headingSs << std::setw(3) << std::setfill('0') << static_cast<int>(heading);
     data.heading = headingSs.str();
 
     // Altitude display
-    float altitude = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = Dataref::getInstance()->getCached<float>(displayRefs.altitude);
     std::ostringstream altSs;
     altSs << std::setw(5) << std::setfill('0') << static_cast<int>(altitude);
     data.altitude = altSs.str();
 
     // Vertical speed display
-    float vs = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+    float vs = Dataref::getInstance()->getCached<float>(displayRefs.verticalVelocity);
     std::ostringstream vsSs;
     int vsInt = static_cast<int>(vs);
     int absVs = std::abs(vsInt);
@@ -317,8 +320,8 @@ void Laminar737FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.vsMode = true;
 
     // Barometer displays (inHg)
-    float baroPilot = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    float baroFO = Dataref::getInstance()->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+    float baroPilot = Dataref::getInstance()->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    float baroFO = Dataref::getInstance()->getCached<float>(displayRefs.barometerSettingInHgCopilot);
 
     data.efisLeft.setBaro(baroPilot, true);
     data.efisRight.setBaro(baroFO, true);
@@ -1,6 +1,7 @@
 #ifndef LAMINAR_737_FCU_EFIS_PROFILE_H
 #define LAMINAR_737_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,20 @@
 #include <unordered_map>
 
 class Laminar737FCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId avionicsOn;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         Laminar737FCUEfisProfile(ProductFCUEfis *product);
 
@@ -11,7 +11,33 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<LaminarA333FCUEfisProfile::DisplayRefs> LaminarA333FCUEfisProfile::displayRefTable[] = {
+    {"laminar/A333/annun/autopilot/ap1_mode"},
+    {"laminar/A333/annun/autopilot/ap2_mode"},
+
+    {"sim/cockpit2/autopilot/vnav_speed_window_open", &DisplayRefs::vnavSpeedWindowOpen},
+    {"laminar/A333/autopilot/hdg_window_open", &DisplayRefs::hdgWindowOpen},
+    {"laminar/A333/autopilot/vvi_fpa_window_open", &DisplayRefs::vviFpaWindowOpen},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"sim/cockpit2/autopilot/vnav_speed_window_open", &DisplayRefs::vnavSpeedWindowOpen},
+    {"sim/cockpit2/autopilot/trk_fpa", &DisplayRefs::trkFpa},
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"sim/cockpit2/autopilot/speed_status"},
+    {"sim/cockpit2/autopilot/fms_vnav", &DisplayRefs::fmsVnav},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot", &DisplayRefs::barometerSettingIsStdPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot", &DisplayRefs::barometerSettingIsStdCopilot},
+    {"laminar/A333/barometer/capt_inHg_hPa_pos", &DisplayRefs::captInHgHPaPos},
+    {"laminar/A333/barometer/fo_inHg_hPa_pos", &DisplayRefs::foInHgHPaPos},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+};
+
 LaminarA333FCUEfisProfile::LaminarA333FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio_manual", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 2) {
             return;
@@ -35,12 +61,12 @@ LaminarA333FCUEfisProfile::LaminarA333FCUEfisProfile(ProductFCUEfis *product) :
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/autopilot_has_power", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("laminar/A333/annun/autopilot/ap1_mode", [product](float brightness) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, brightness > 0.9f ? 1 : 0);
@@ -151,30 +177,7 @@ bool LaminarA333FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &LaminarA333FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "laminar/A333/annun/autopilot/ap1_mode",
-        "laminar/A333/annun/autopilot/ap2_mode",
-
-        "sim/cockpit2/autopilot/vnav_speed_window_open",
-        "laminar/A333/autopilot/hdg_window_open",
-        "laminar/A333/autopilot/vvi_fpa_window_open",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "sim/cockpit2/autopilot/vnav_speed_window_open",
-        "sim/cockpit2/autopilot/trk_fpa",
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit/autopilot/vertical_velocity",
-        "sim/cockpit2/autopilot/speed_status",
-        "sim/cockpit2/autopilot/fms_vnav",
-        "sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot",
-        "laminar/A333/barometer/capt_inHg_hPa_pos",
-        "laminar/A333/barometer/fo_inHg_hPa_pos",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -291,14 +294,14 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &LaminarA333FCUEfisProfile:
 void LaminarA333FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.spdManaged = datarefManager->getCached<bool>("sim/cockpit2/autopilot/vnav_speed_window_open") == false;
-    data.hdgManaged = datarefManager->getCached<bool>("laminar/A333/autopilot/hdg_window_open") == false;
-    data.altManaged = datarefManager->getCached<bool>("sim/cockpit2/autopilot/fms_vnav");
+    data.spdManaged = datarefManager->getCached<bool>(displayRefs.vnavSpeedWindowOpen) == false;
+    data.hdgManaged = datarefManager->getCached<bool>(displayRefs.hdgWindowOpen) == false;
+    data.altManaged = datarefManager->getCached<bool>(displayRefs.fmsVnav);
 
-    data.spdMach = datarefManager->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = datarefManager->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    data.spdMach = datarefManager->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = datarefManager->getCached<float>(displayRefs.airspeedDialKtsMach);
 
-    if (speed > 0 && datarefManager->getCached<bool>("sim/cockpit2/autopilot/vnav_speed_window_open")) {
+    if (speed > 0 && datarefManager->getCached<bool>(displayRefs.vnavSpeedWindowOpen)) {
         std::stringstream ss;
         if (data.spdMach) {
             // In Mach mode, format as 0.XX -> "0XX" (e.g., 0.40 -> "040", 0.82 -> "082")
@@ -314,7 +317,7 @@ void LaminarA333FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format FCU heading display - using sim/cockpit/autopilot/heading_mag (float)
-    float heading = datarefManager->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = datarefManager->getCached<float>(displayRefs.headingMag);
     if (heading >= 0 && data.hdgManaged == false) {
         // Convert 360 to 0 for display
         int hdgDisplay = static_cast<int>(heading) % 360;
@@ -326,7 +329,7 @@ void LaminarA333FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format FCU altitude display - using sim/cockpit/autopilot/altitude (float)
-    float altitude = datarefManager->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = datarefManager->getCached<float>(displayRefs.altitude);
     if (altitude >= 0) {
         int altInt = static_cast<int>(altitude);
         std::stringstream ss;
@@ -338,11 +341,11 @@ void LaminarA333FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format vertical speed display - using sim/cockpit/autopilot/vertical_velocity (float)
-    float vs = datarefManager->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
-    bool vsDashed = datarefManager->getCached<int>("laminar/A333/autopilot/vvi_fpa_window_open") == false;
+    float vs = datarefManager->getCached<float>(displayRefs.verticalVelocity);
+    bool vsDashed = datarefManager->getCached<int>(displayRefs.vviFpaWindowOpen) == false;
 
     // HDG/TRK mode
-    data.headingTrk = datarefManager->getCached<bool>("sim/cockpit2/autopilot/trk_fpa");
+    data.headingTrk = datarefManager->getCached<bool>(displayRefs.trkFpa);
     data.headingHdg = !data.headingTrk;
 
     data.vsMode = !data.headingTrk; // VS mode when HDG mode
@@ -409,9 +412,9 @@ void LaminarA333FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     for (int i = 0; i < 2; i++) {
         bool isCaptain = i == 0;
 
-        bool isStd = datarefManager->getCached<bool>(isCaptain ? "sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot" : "sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot");
-        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? "laminar/A333/barometer/capt_inHg_hPa_pos" : "laminar/A333/barometer/fo_inHg_hPa_pos");
-        float baroValue = datarefManager->getCached<float>(isCaptain ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot" : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+        bool isStd = datarefManager->getCached<bool>(isCaptain ? displayRefs.barometerSettingIsStdPilot : displayRefs.barometerSettingIsStdCopilot);
+        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? displayRefs.captInHgHPaPos : displayRefs.foInHgHPaPos);
+        float baroValue = datarefManager->getCached<float>(isCaptain ? displayRefs.barometerSettingInHgPilot : displayRefs.barometerSettingInHgCopilot);
 
         EfisDisplayValue value = {
             .baro = "",
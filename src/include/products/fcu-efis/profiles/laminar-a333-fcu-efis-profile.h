@@ -1,6 +1,7 @@
 #ifndef LAMINAR_A333_FCU_EFIS_PROFILE_H
 #define LAMINAR_A333_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,28 @@
 #include <vector>
 
 class LaminarA333FCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId vnavSpeedWindowOpen;
+                DatarefId hdgWindowOpen;
+                DatarefId fmsVnav;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId vviFpaWindowOpen;
+                DatarefId trkFpa;
+                DatarefId barometerSettingIsStdPilot;
+                DatarefId barometerSettingIsStdCopilot;
+                DatarefId captInHgHPaPos;
+                DatarefId foInHgHPaPos;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         LaminarA333FCUEfisProfile(ProductFCUEfis *product);
 
@@ -1,5 +1,6 @@
 #include "pa28-fcu-efis-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-fcu-efis.h"
@@ -11,7 +12,16 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<PA28FCUEfisProfile::DisplayRefs> PA28FCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/battery_on", &DisplayRefs::batteryOn},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+};
+
 PA28FCUEfisProfile::PA28FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     // The JF PA28 animates the effective brightness array, not the _manual rheostat array.
     // Screens stay readable whenever the bus is powered; key backlights follow the panel lights.
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio", [this, product](const std::vector<float> &brightness) {
@@ -47,12 +57,12 @@ PA28FCUEfisProfile::PA28FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraf
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [product](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/servos_on", [product](bool isAutopilotEngaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, isAutopilotEngaged ? 1 : 0);
@@ -64,19 +74,14 @@ PA28FCUEfisProfile::PA28FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraf
 }
 
 bool PA28FCUEfisProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
 
     // Matches all PA-28 variants: P28A (Warrior/Archer/Cherokee), P28R (Arrow), P28T/P28U (Turbo Arrow)
     return icao.starts_with("P28");
 }
 
 const std::vector<std::string> &PA28FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/battery_on",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit/autopilot/altitude",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -118,7 +123,7 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &PA28FCUEfisProfile::button
 void PA28FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.displayEnabled = datarefManager->getCached<bool>("sim/cockpit/electrical/battery_on");
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.batteryOn);
     data.displayTest = false;
 
     // No speed target on the PA-28: dashes with the managed dot, like an Airbus in managed speed
@@ -127,7 +132,7 @@ void PA28FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.spdMach = false;
 
     // Heading window shows the directional gyro heading bug
-    float heading = datarefManager->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = datarefManager->getCached<float>(displayRefs.headingMag);
     int hdgDisplay = static_cast<int>(std::round(heading)) % 360;
     std::stringstream hdgSs;
     hdgSs << std::setfill('0') << std::setw(3) << hdgDisplay;
@@ -138,7 +143,7 @@ void PA28FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.hdgManaged = false;
 
     // Altitude window shows the autopilot altitude selector
-    float altitude = datarefManager->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = datarefManager->getCached<float>(displayRefs.altitude);
     int altDisplay = std::max(0, static_cast<int>(std::round(altitude)));
     std::stringstream altSs;
     altSs << std::setfill('0') << std::setw(5) << altDisplay;
@@ -167,7 +172,7 @@ void PA28FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.efisRight.unitIsInHg = false;
         data.efisRight.baro = "";
     } else {
-        float baroPilot = datarefManager->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
+        float baroPilot = datarefManager->getCached<float>(displayRefs.barometerSettingInHgPilot);
         data.efisLeft.setBaro(baroPilot, !captainUnitIsHpa);
         data.efisRight.setBaro(baroPilot, !foUnitIsHpa);
     }
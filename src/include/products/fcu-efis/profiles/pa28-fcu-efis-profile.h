@@ -1,6 +1,7 @@
 #ifndef PA28_FCU_EFIS_PROFILE_H
 #define PA28_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -16,6 +17,14 @@ class PA28FCUEfisProfile : public FCUEfisAircraftProfile {
         float altitudeIncrement = 100.0f;
         int lastBacklightSent = -1;
         int lastScreensSent = -1;
+        struct DisplayRefs {
+                DatarefId batteryOn;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId barometerSettingInHgPilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         PA28FCUEfisProfile(ProductFCUEfis *product);
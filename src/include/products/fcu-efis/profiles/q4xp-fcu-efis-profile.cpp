@@ -9,7 +9,18 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+const DisplayRef<Q4XPFCUEfisProfile::DisplayRefs> Q4XPFCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/autopilot/airspeed", &DisplayRefs::airspeed},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"sim/cockpit/misc/barometer_setting", &DisplayRefs::barometerSetting},
+    {"sim/cockpit/misc/barometer_setting2", &DisplayRefs::barometerSetting2},
+};
+
 Q4XPFCUEfisProfile::Q4XPFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("FJS/Q4XP/Lights/panelText_LIT", [product](const std::vector<float> &brightness) {
         if (brightness.size() <= 1) {
             return;
@@ -22,7 +33,7 @@ Q4XPFCUEfisProfile::Q4XPFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraf
         product->setLedBrightness(FCUEfisLed::EFISR_BACKLIGHT, target);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     product->setLedBrightness(FCUEfisLed::SCREEN_BACKLIGHT, 128);
     product->setLedBrightness(FCUEfisLed::EFISL_SCREEN_BACKLIGHT, 128);
@@ -41,14 +52,7 @@ bool Q4XPFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &Q4XPFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/autopilot/airspeed",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit/autopilot/vertical_velocity",
-        "sim/cockpit/misc/barometer_setting",
-        "sim/cockpit/misc/barometer_setting2",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -105,7 +109,7 @@ void Q4XPFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.displayEnabled = true;
 
     // Speed
-    float ias = dm->getCached<float>("sim/cockpit/autopilot/airspeed");
+    float ias = dm->getCached<float>(displayRefs.airspeed);
     {
         std::ostringstream oss;
         oss << std::setw(3) << std::setfill('0') << static_cast<int>(std::round(ias));
@@ -115,7 +119,7 @@ void Q4XPFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.spdManaged = false;
 
     // Heading
-    float hdg = dm->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float hdg = dm->getCached<float>(displayRefs.headingMag);
     {
         int hdgInt = static_cast<int>(std::round(hdg)) % 360;
         std::ostringstream oss;
@@ -128,7 +132,7 @@ void Q4XPFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.hdgManaged = false;
 
     // Altitude
-    float alt = dm->getCached<float>("sim/cockpit/autopilot/altitude");
+    float alt = dm->getCached<float>(displayRefs.altitude);
     {
         std::ostringstream oss;
         oss << std::setw(5) << std::setfill('0') << static_cast<int>(std::round(alt));
@@ -139,7 +143,7 @@ void Q4XPFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.lvlChange = false;
 
     // Vertical Speed
-    float vs = dm->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+    float vs = dm->getCached<float>(displayRefs.verticalVelocity);
     {
         bool negative = vs < 0;
         int vsAbs = static_cast<int>(std::round(std::abs(vs)));
@@ -155,12 +159,12 @@ void Q4XPFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.vsVerticalLine = false;
 
     // EFIS Baro — inHg → convert to hPa/mbar display
-    float baro1 = dm->getCached<float>("sim/cockpit/misc/barometer_setting");
+    float baro1 = dm->getCached<float>(displayRefs.barometerSetting);
     data.efisLeft.displayEnabled = true;
     data.efisLeft.unitIsInHg = false;
     data.efisLeft.setBaro(baro1, false);
 
-    float baro2 = dm->getCached<float>("sim/cockpit/misc/barometer_setting2");
+    float baro2 = dm->getCached<float>(displayRefs.barometerSetting2);
     data.efisRight.displayEnabled = true;
     data.efisRight.unitIsInHg = false;
     data.efisRight.setBaro(baro2, false);
@@ -1,6 +1,7 @@
 #ifndef Q4XP_FCU_EFIS_PROFILE_H
 #define Q4XP_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,18 @@
 #include <unordered_map>
 
 class Q4XPFCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId airspeed;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId barometerSetting;
+                DatarefId barometerSetting2;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         Q4XPFCUEfisProfile(ProductFCUEfis *product);
         ~Q4XPFCUEfisProfile();
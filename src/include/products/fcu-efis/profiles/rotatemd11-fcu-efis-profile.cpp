@@ -11,7 +11,33 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+const DisplayRef<RotateMD11FCUEfisProfile::DisplayRefs> RotateMD11FCUEfisProfile::displayRefTable[] = {
+    {"Rotate/aircraft/systems/elec_dc_batt_bus_pwrd", &DisplayRefs::elecDcBattBusPwrd},
+
+    {"Rotate/aircraft/systems/gcp_spd_presel_ias", &DisplayRefs::gcpSpdPreselIas},
+    {"Rotate/aircraft/systems/gcp_spd_presel_mach", &DisplayRefs::gcpSpdPreselMach},
+    {"Rotate/aircraft/systems/gcp_active_ias_mach_mode", &DisplayRefs::gcpActiveIasMachMode},
+    {"Rotate/aircraft/systems/afs_fms_spd_engaged", &DisplayRefs::afsFmsSpdEngaged},
+
+    {"Rotate/aircraft/systems/gcp_hdg_presel_deg", &DisplayRefs::gcpHdgPreselDeg},
+    {"Rotate/aircraft/systems/gcp_hdg_trk_presel_set", &DisplayRefs::gcpHdgTrkPreselSet},
+    {"Rotate/aircraft/systems/gcp_hdg_trk_mode", &DisplayRefs::gcpHdgTrkMode},
+
+    {"Rotate/aircraft/systems/gcp_alt_presel_ft", &DisplayRefs::gcpAltPreselFt},
+    {"Rotate/aircraft/systems/gcp_alt_ft_meter_mode", &DisplayRefs::gcpAltFtMeterMode},
+
+    {"Rotate/aircraft/systems/gcp_vs_fpa_mode", &DisplayRefs::gcpVsFpaMode},
+    {"Rotate/aircraft/systems/gcp_vs_sel_fpm", &DisplayRefs::gcpVsSelFpm},
+    {"Rotate/aircraft/systems/gcp_fpa_sel_deg", &DisplayRefs::gcpFpaSelDeg},
+    {"Rotate/aircraft/systems/gcp_pitch_sel_set", &DisplayRefs::gcpPitchSelSet},
+
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+};
+
 RotateMD11FCUEfisProfile::RotateMD11FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<bool>("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd", [this, product](bool hasPower) {
         float panelBrt = hasPower ? Dataref::getInstance()->getCached<float>("Rotate/aircraft/systems/light_fgs_panel_brt_ratio") : 0.0f;
         uint8_t backlight = hasPower ? static_cast<uint8_t>(std::clamp(panelBrt, 0.0f, 1.0f) * 255) : 0;
@@ -33,12 +59,12 @@ RotateMD11FCUEfisProfile::RotateMD11FCUEfisProfile(ProductFCUEfis *product) : FC
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("Rotate/aircraft/systems/light_fgs_panel_brt_ratio", [](float) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("Rotate/aircraft/systems/afs_appr_engaged", [this, product](bool engaged) {
         bool landArmed = Dataref::getInstance()->getCached<bool>("Rotate/aircraft/systems/afs_land_armed");
@@ -60,7 +86,7 @@ RotateMD11FCUEfisProfile::RotateMD11FCUEfisProfile(ProductFCUEfis *product) : FC
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/afs_appr_engaged");
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/afs_land_armed");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<int>>("Rotate/aircraft/systems/gcp_baro_inhg_hpa_mode", [this, product](const std::vector<int> &mode) {
         if (mode.size() >= 2) {
@@ -98,30 +124,7 @@ bool RotateMD11FCUEfisProfile::isAnnunTest() {
 }
 
 const std::vector<std::string> &RotateMD11FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "Rotate/aircraft/systems/elec_dc_batt_bus_pwrd",
-
-        "Rotate/aircraft/systems/gcp_spd_presel_ias",
-        "Rotate/aircraft/systems/gcp_spd_presel_mach",
-        "Rotate/aircraft/systems/gcp_active_ias_mach_mode",
-        "Rotate/aircraft/systems/afs_fms_spd_engaged",
-
-        "Rotate/aircraft/systems/gcp_hdg_presel_deg",
-        "Rotate/aircraft/systems/gcp_hdg_trk_presel_set",
-        "Rotate/aircraft/systems/gcp_hdg_trk_mode",
-
-        "Rotate/aircraft/systems/gcp_alt_presel_ft",
-        "Rotate/aircraft/systems/gcp_alt_ft_meter_mode",
-
-        "Rotate/aircraft/systems/gcp_vs_fpa_mode",
-        "Rotate/aircraft/systems/gcp_vs_sel_fpm",
-        "Rotate/aircraft/systems/gcp_fpa_sel_deg",
-        "Rotate/aircraft/systems/gcp_pitch_sel_set",
-
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -237,7 +240,7 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &RotateMD11FCUEfisProfile::
 void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto dataref = Dataref::getInstance();
 
-    data.displayEnabled = dataref->getCached<bool>("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd");
+    data.displayEnabled = dataref->getCached<bool>(displayRefs.elecDcBattBusPwrd);
     data.displayTest = false;
 
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::All;
@@ -253,17 +256,17 @@ void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Speed
-    bool fmsSpdEngaged = dataref->getCached<int>("Rotate/aircraft/systems/afs_fms_spd_engaged") == 1;
+    bool fmsSpdEngaged = dataref->getCached<int>(displayRefs.afsFmsSpdEngaged) == 1;
     if (fmsSpdEngaged) {
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::SpeedMachHeader;
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::SpeedMachValue;
     } else {
-        int iasMachMode = dataref->getCached<int>("Rotate/aircraft/systems/gcp_active_ias_mach_mode");
+        int iasMachMode = dataref->getCached<int>(displayRefs.gcpActiveIasMachMode);
         data.spdMach = (iasMachMode != 0);
 
         float speed = data.spdMach
-                        ? dataref->getCached<float>("Rotate/aircraft/systems/gcp_spd_presel_mach")
-                        : dataref->getCached<float>("Rotate/aircraft/systems/gcp_spd_presel_ias");
+                        ? dataref->getCached<float>(displayRefs.gcpSpdPreselMach)
+                        : dataref->getCached<float>(displayRefs.gcpSpdPreselIas);
 
         if (speed > 0) {
             std::stringstream ss;
@@ -280,16 +283,16 @@ void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Heading
-    int hdgTrkSel = dataref->getCached<int>("Rotate/aircraft/systems/gcp_hdg_trk_presel_set");
+    int hdgTrkSel = dataref->getCached<int>(displayRefs.gcpHdgTrkPreselSet);
     if (hdgTrkSel != 1) {
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::HeadingTrackHeader;
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::HeadingTrackValue;
     } else {
-        int hdgTrkMode = dataref->getCached<int>("Rotate/aircraft/systems/gcp_hdg_trk_mode");
+        int hdgTrkMode = dataref->getCached<int>(displayRefs.gcpHdgTrkMode);
         data.headingHdg = (hdgTrkMode == 0);
         data.headingTrk = !data.headingHdg;
 
-        float heading = dataref->getCached<float>("Rotate/aircraft/systems/gcp_hdg_presel_deg");
+        float heading = dataref->getCached<float>(displayRefs.gcpHdgPreselDeg);
         int hdgDisplay = static_cast<int>(heading) % 360;
         if (hdgDisplay < 0) {
             hdgDisplay += 360;
@@ -300,8 +303,8 @@ void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Altitude
-    dataref->getCached<int>("Rotate/aircraft/systems/gcp_alt_ft_meter_mode");
-    float altitude = dataref->getCached<float>("Rotate/aircraft/systems/gcp_alt_presel_ft");
+    dataref->getCached<int>(displayRefs.gcpAltFtMeterMode);
+    float altitude = dataref->getCached<float>(displayRefs.gcpAltPreselFt);
     if (altitude >= 0) {
         std::stringstream ss;
         ss << std::setfill('0') << std::setw(5) << static_cast<int>(std::round(altitude));
@@ -311,12 +314,12 @@ void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Vertical speed / FPA
-    int vsFpaMode = dataref->getCached<int>("Rotate/aircraft/systems/gcp_vs_fpa_mode");
+    int vsFpaMode = dataref->getCached<int>(displayRefs.gcpVsFpaMode);
     data.vsMode = (vsFpaMode == 0);
     data.fpaMode = !data.vsMode;
 
     if (data.fpaMode) {
-        float fpa = dataref->getCached<float>("Rotate/aircraft/systems/gcp_fpa_sel_deg");
+        float fpa = dataref->getCached<float>(displayRefs.gcpFpaSelDeg);
         float absFpa = std::abs(fpa);
         int fpaTenths = static_cast<int>(std::round(absFpa * 10));
 
@@ -331,8 +334,8 @@ void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.vsIndication = false;
         data.fpaIndication = true;
     } else {
-        bool pitchSelSet = dataref->getCached<bool>("Rotate/aircraft/systems/gcp_pitch_sel_set");
-        float vs = dataref->getCached<float>("Rotate/aircraft/systems/gcp_vs_sel_fpm");
+        bool pitchSelSet = dataref->getCached<bool>(displayRefs.gcpPitchSelSet);
+        float vs = dataref->getCached<float>(displayRefs.gcpVsSelFpm);
         int absVs = std::abs(static_cast<int>(std::round(vs)));
 
         if (pitchSelSet) {
@@ -361,8 +364,8 @@ void RotateMD11FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         bool isQfe = isCaptain ? isQfeCapt : isQfeFo;
         float baroValue = dataref->getCached<float>(
             isCaptain
-                ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot"
-                : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+                ? displayRefs.barometerSettingInHgPilot
+                : displayRefs.barometerSettingInHgCopilot);
 
         EfisDisplayValue value = {
             .displayEnabled = data.displayEnabled,
@@ -1,6 +1,7 @@
 #ifndef ROTATEMD11_FCU_EFIS_PROFILE_H
 #define ROTATEMD11_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -15,6 +16,26 @@ class RotateMD11FCUEfisProfile : public FCUEfisAircraftProfile {
         bool isQfeCapt = false;
         bool isQfeFo = false;
         bool isAnnunTest();
+        struct DisplayRefs {
+                DatarefId elecDcBattBusPwrd;
+                DatarefId afsFmsSpdEngaged;
+                DatarefId gcpActiveIasMachMode;
+                DatarefId gcpSpdPreselMach;
+                DatarefId gcpSpdPreselIas;
+                DatarefId gcpHdgTrkPreselSet;
+                DatarefId gcpHdgTrkMode;
+                DatarefId gcpHdgPreselDeg;
+                DatarefId gcpAltFtMeterMode;
+                DatarefId gcpAltPreselFt;
+                DatarefId gcpVsFpaMode;
+                DatarefId gcpFpaSelDeg;
+                DatarefId gcpPitchSelSet;
+                DatarefId gcpVsSelFpm;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         RotateMD11FCUEfisProfile(ProductFCUEfis *product);
@@ -10,7 +10,31 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+const DisplayRef<SparkyB744FCUEfisProfile::DisplayRefs> SparkyB744FCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/avionics_on", &DisplayRefs::avionicsOn},
+    {"laminar/B747/autopilot/ias_dial_value", &DisplayRefs::iasDialValue},
+    {"laminar/B747/autopilot/ias_mach/window_open", &DisplayRefs::iasMachWindowOpen},
+    {"laminar/B747/autopilot/heading/degrees", &DisplayRefs::headingDegrees},
+    {"laminar/B747/autopilot/heading/altitude_dial_ft", &DisplayRefs::altitudeDialFt},
+    {"laminar/B747/cockpit2/autopilot/vvi_dial_fpm", &DisplayRefs::vviDialFpm},
+    {"laminar/B747/autopilot/vert_spd/window_open", &DisplayRefs::vertSpdWindowOpen},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"laminar/B747/efis/baro/capt/set_dial_pos"},
+    {"laminar/B747/efis/baro_std/capt/switch_pos", &DisplayRefs::captSwitchPos},
+    {"laminar/B747/efis/baro_ref/capt/sel_dial_pos", &DisplayRefs::captSelDialPos},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    {"laminar/B747/efis/baro/fo/set_dial_pos"},
+    {"laminar/B747/efis/baro_std/fo/switch_pos", &DisplayRefs::foSwitchPos},
+    {"laminar/B747/efis/baro_ref/fo/sel_dial_pos", &DisplayRefs::foSelDialPos},
+    {"laminar/B747/nd/mode/capt/sel_dial_pos"},
+    {"laminar/B747/nd/range/capt/sel_dial_pos"},
+    {"laminar/B747/nd/mode/fo/sel_dial_pos"},
+    {"laminar/B747/nd/range/fo/sel_dial_pos"},
+};
+
 SparkyB744FCUEfisProfile::SparkyB744FCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [product](bool powered) {
         uint8_t backlight = powered ? 200 : 0;
         product->setLedBrightness(FCUEfisLed::BACKLIGHT, backlight);
@@ -29,7 +53,7 @@ SparkyB744FCUEfisProfile::SparkyB744FCUEfisProfile(ProductFCUEfis *product) : FC
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // MCP engagement LEDs
     Dataref::getInstance()->monitorExistingDataref<double>("laminar/B747/autopilot/cmd_L_mode/status", [product](double engaged) {
@@ -102,26 +126,7 @@ bool SparkyB744FCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &SparkyB744FCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/avionics_on",
-        "laminar/B747/autopilot/ias_dial_value",
-        "laminar/B747/autopilot/ias_mach/window_open",
-        "laminar/B747/autopilot/heading/degrees",
-        "laminar/B747/autopilot/heading/altitude_dial_ft",
-        "laminar/B747/cockpit2/autopilot/vvi_dial_fpm",
-        "laminar/B747/autopilot/vert_spd/window_open",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "laminar/B747/efis/baro/capt/set_dial_pos",
-        "laminar/B747/efis/baro_std/capt/switch_pos",
-        "laminar/B747/efis/baro_ref/capt/sel_dial_pos",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        "laminar/B747/efis/baro/fo/set_dial_pos",
-        "laminar/B747/efis/baro_std/fo/switch_pos",
-        "laminar/B747/efis/baro_ref/fo/sel_dial_pos",
-        "laminar/B747/nd/mode/capt/sel_dial_pos",
-        "laminar/B747/nd/range/capt/sel_dial_pos",
-        "laminar/B747/nd/mode/fo/sel_dial_pos",
-        "laminar/B747/nd/range/fo/sel_dial_pos"};
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -228,12 +233,12 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &SparkyB744FCUEfisProfile::
 void SparkyB744FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto dm = Dataref::getInstance();
 
-    data.displayEnabled = dm->getCached<bool>("sim/cockpit/electrical/avionics_on");
+    data.displayEnabled = dm->getCached<bool>(displayRefs.avionicsOn);
     data.displayTest = false;
 
     // Speed
-    double speedTarget = dm->getCached<double>("laminar/B747/autopilot/ias_dial_value");
-    bool windowOpen = dm->getCached<double>("laminar/B747/autopilot/ias_mach/window_open") > 0.5;
+    double speedTarget = dm->getCached<double>(displayRefs.iasDialValue);
+    bool windowOpen = dm->getCached<double>(displayRefs.iasMachWindowOpen) > 0.5;
     bool isMach = false;
     data.spdMach = isMach;
 
@@ -251,7 +256,7 @@ void SparkyB744FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.headingTrk = false;
     data.headingLat = true;
 
-    double heading = dm->getCached<double>("laminar/B747/autopilot/heading/degrees");
+    double heading = dm->getCached<double>(displayRefs.headingDegrees);
     if (heading >= 0) {
         std::stringstream ss;
         ss << std::setfill('0') << std::setw(3) << (static_cast<int>(heading) % 360);
@@ -262,7 +267,7 @@ void SparkyB744FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.hdgManaged = false;
 
     // Altitude
-    double altitude = dm->getCached<double>("laminar/B747/autopilot/heading/altitude_dial_ft");
+    double altitude = dm->getCached<double>(displayRefs.altitudeDialFt);
     if (altitude > 0) {
         int altInt = static_cast<int>(std::round(altitude / 100.0) * 100);
         std::stringstream ss;
@@ -274,8 +279,8 @@ void SparkyB744FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.altManaged = false;
 
     // Vertical speed
-    bool vsWindowOpen = dm->getCached<double>("laminar/B747/autopilot/vert_spd/window_open") > 0.5;
-    double vs = dm->getCached<double>("laminar/B747/cockpit2/autopilot/vvi_dial_fpm");
+    bool vsWindowOpen = dm->getCached<double>(displayRefs.vertSpdWindowOpen) > 0.5;
+    double vs = dm->getCached<double>(displayRefs.vviDialFpm);
 
     data.vsMode = true;
     data.fpaMode = false;
@@ -298,11 +303,11 @@ void SparkyB744FCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     // EFIS baro — preselect is in inHg, convert to hPa if unit selector says so
     for (int i = 0; i < 2; i++) {
         bool isCaptain = (i == 0);
-        const char *baroValueRef = isCaptain
-                                     ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot"
-                                     : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot";
-        const char *baroStdRef = isCaptain ? "laminar/B747/efis/baro_std/capt/switch_pos" : "laminar/B747/efis/baro_std/fo/switch_pos";
-        const char *baroTypeRef = isCaptain ? "laminar/B747/efis/baro_ref/capt/sel_dial_pos" : "laminar/B747/efis/baro_ref/fo/sel_dial_pos";
+        DatarefId baroValueRef = isCaptain
+                                   ? displayRefs.barometerSettingInHgPilot
+                                   : displayRefs.barometerSettingInHgCopilot;
+        DatarefId baroStdRef = isCaptain ? displayRefs.captSwitchPos : displayRefs.foSwitchPos;
+        DatarefId baroTypeRef = isCaptain ? displayRefs.captSelDialPos : displayRefs.foSelDialPos;
 
         float baroInhg = dm->getCached<float>(baroValueRef);
         bool isStd = dm->getCached<double>(baroStdRef) > 0.5;
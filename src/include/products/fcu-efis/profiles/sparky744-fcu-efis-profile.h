@@ -1,11 +1,31 @@
 #ifndef SPARKYB744_FCU_EFIS_PROFILE_H
 #define SPARKYB744_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <string>
 
 class SparkyB744FCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId avionicsOn;
+                DatarefId iasDialValue;
+                DatarefId iasMachWindowOpen;
+                DatarefId headingDegrees;
+                DatarefId altitudeDialFt;
+                DatarefId vertSpdWindowOpen;
+                DatarefId vviDialFpm;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+                DatarefId captSwitchPos;
+                DatarefId foSwitchPos;
+                DatarefId captSelDialPos;
+                DatarefId foSelDialPos;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         SparkyB744FCUEfisProfile(ProductFCUEfis *product);
 
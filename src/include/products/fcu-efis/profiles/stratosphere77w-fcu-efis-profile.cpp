@@ -10,7 +10,35 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+const DisplayRef<Strato77WFCUEfisProfile::DisplayRefs> Strato77WFCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit2/autopilot/autopilot_has_power", &DisplayRefs::autopilotHasPower},
+
+    // MCP display values
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+
+    // MCP mode states
+    {"Strato/777/mcp/hdg_to_trk", &DisplayRefs::hdgToTrk},
+    {"Strato/777/mcp/vs_fpa", &DisplayRefs::vsFpa},
+    {"Strato/777/mcp/vshold", &DisplayRefs::vsHold},
+
+    // EFIS baro
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    {"Strato/777/baro_mode", &DisplayRefs::baroMode},
+    {"Strato/777/displays/alt_std", &DisplayRefs::altStd},
+
+    // ND mode and range
+    {"Strato/777/fltInst/nd_mode_selector"},
+    {"Strato/777/map_zoom_knob"},
+};
+
 Strato77WFCUEfisProfile::Strato77WFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/autopilot_has_power", [product](bool powered) {
         uint8_t backlight = powered ? 200 : 0;
         product->setLedBrightness(FCUEfisLed::BACKLIGHT, backlight);
@@ -25,7 +53,7 @@ Strato77WFCUEfisProfile::Strato77WFCUEfisProfile(ProductFCUEfis *product) : FCUE
         product->setLedBrightness(FCUEfisLed::EFISL_OVERALL_GREEN, powered ? 255 : 0);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Strato/777/mcp/ap_on", [product](int engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged ? 1 : 0);
@@ -54,7 +82,7 @@ Strato77WFCUEfisProfile::Strato77WFCUEfisProfile(ProductFCUEfis *product) : FCUE
         product->setLedBrightness(FCUEfisLed::EFISL_VORD_GREEN, on || warn ? 1 : 0);
         product->setLedBrightness(FCUEfisLed::EFISL_ARPT_GREEN, on || warn ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Strato/777/cockpit/lights/caut_fo", [product](int on) {
         bool warn = Dataref::getInstance()->getCached<bool>("Strato/777/cockpit/lights/warn_fo");
@@ -62,17 +90,17 @@ Strato77WFCUEfisProfile::Strato77WFCUEfisProfile(ProductFCUEfis *product) : FCUE
         product->setLedBrightness(FCUEfisLed::EFISR_VORD_GREEN, on || warn ? 1 : 0);
         product->setLedBrightness(FCUEfisLed::EFISR_ARPT_GREEN, on || warn ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Strato/777/cockpit/lights/warn_cap", [product](int on) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Strato/777/cockpit/lights/caut_cap");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Strato/777/cockpit/lights/warn_fo", [product](int on) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Strato/777/cockpit/lights/caut_fo");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/autopilot/autopilot_has_power");
 }
@@ -83,31 +111,7 @@ bool Strato77WFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &Strato77WFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit2/autopilot/autopilot_has_power",
-
-        // MCP display values
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit/autopilot/vertical_velocity",
-
-        // MCP mode states
-        "Strato/777/mcp/hdg_to_trk",
-        "Strato/777/mcp/vs_fpa",
-        "Strato/777/mcp/vshold",
-
-        // EFIS baro
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        "Strato/777/baro_mode",
-        "Strato/777/displays/alt_std",
-
-        // ND mode and range
-        "Strato/777/fltInst/nd_mode_selector",
-        "Strato/777/map_zoom_knob",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -217,14 +221,14 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &Strato77WFCUEfisProfile::b
 void Strato77WFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto dm = Dataref::getInstance();
 
-    data.displayEnabled = dm->getCached<bool>("sim/cockpit2/autopilot/autopilot_has_power");
+    data.displayEnabled = dm->getCached<bool>(displayRefs.autopilotHasPower);
     data.displayTest = false;
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::All;
     data.displayEnabledWindowsFlag &= ~FCUDisplayData::LevelChangeHeader;
 
     // Speed
-    bool isMach = dm->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = dm->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    bool isMach = dm->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = dm->getCached<float>(displayRefs.airspeedDialKtsMach);
     data.spdMach = isMach;
 
     if (speed > 0) {
@@ -242,12 +246,12 @@ void Strato77WFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.spdManaged = false;
 
     // Heading
-    bool isHdg = !dm->getCached<bool>("Strato/777/mcp/hdg_to_trk");
+    bool isHdg = !dm->getCached<bool>(displayRefs.hdgToTrk);
     data.headingHdg = isHdg;
     data.headingTrk = !isHdg;
     data.headingLat = false;
 
-    float heading = dm->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = dm->getCached<float>(displayRefs.headingMag);
     if (heading >= 0) {
         std::stringstream ss;
         ss << std::setfill('0') << std::setw(3) << (static_cast<int>(std::round(heading)) % 360);
@@ -258,7 +262,7 @@ void Strato77WFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.hdgManaged = false;
 
     // Altitude
-    float altitude = dm->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = dm->getCached<float>(displayRefs.altitude);
     if (altitude >= 0 && altitude < 100000) {
         int altInt = static_cast<int>(std::round(altitude / 100.0) * 100);
         std::stringstream ss;
@@ -270,8 +274,8 @@ void Strato77WFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.altManaged = false;
 
     // Vertical speed
-    bool isVsMode = !dm->getCached<bool>("Strato/777/mcp/vs_fpa");
-    bool vsOpen = dm->getCached<bool>("Strato/777/mcp/vshold");
+    bool isVsMode = !dm->getCached<bool>(displayRefs.vsFpa);
+    bool vsOpen = dm->getCached<bool>(displayRefs.vsHold);
 
     data.vsMode = isVsMode;
     data.fpaMode = !isVsMode;
@@ -281,7 +285,7 @@ void Strato77WFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.vsVerticalLine = vsOpen;
 
     if (vsOpen) {
-        float vs = dm->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+        float vs = dm->getCached<float>(displayRefs.verticalVelocity);
         int absVs = std::abs(static_cast<int>(std::round(vs)));
         std::stringstream ss;
         ss << std::setfill('0') << std::setw(4) << absVs;
@@ -293,14 +297,14 @@ void Strato77WFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // EFIS baro
-    auto baroModes = dm->getCached<std::vector<float>>("Strato/777/baro_mode");
-    auto altStd = dm->getCached<std::vector<float>>("Strato/777/displays/alt_std");
+    std::span<const float> baroModes = dm->getCachedArray<float>(displayRefs.baroMode);
+    std::span<const float> altStd = dm->getCachedArray<float>(displayRefs.altStd);
 
     for (int i = 0; i < 2; i++) {
         bool isCaptain = (i == 0);
-        const char *baroRef = isCaptain
-                                ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot"
-                                : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot";
+        DatarefId baroRef = isCaptain
+                              ? displayRefs.barometerSettingInHgPilot
+                              : displayRefs.barometerSettingInHgCopilot;
 
         float baroInhg = dm->getCached<float>(baroRef);
         bool baroIsHpa = baroModes.size() > (size_t) i && baroModes[i] > 0.5f;
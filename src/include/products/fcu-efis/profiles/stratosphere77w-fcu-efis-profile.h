@@ -1,6 +1,7 @@
 #ifndef STRATOSPHERE77W_FCU_EFIS_PROFILE_H
 #define STRATOSPHERE77W_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,25 @@
 #include <vector>
 
 class Strato77WFCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId autopilotHasPower;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId hdgToTrk;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId vsFpa;
+                DatarefId vsHold;
+                DatarefId verticalVelocity;
+                DatarefId baroMode;
+                DatarefId altStd;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         Strato77WFCUEfisProfile(ProductFCUEfis *product);
 
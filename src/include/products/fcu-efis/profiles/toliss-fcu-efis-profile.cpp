@@ -11,7 +11,42 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<TolissFCUEfisProfile::DisplayRefs> TolissFCUEfisProfile::displayRefTable[] = {
+    {"AirbusFBW/FCUAvail", &DisplayRefs::fcuAvail},
+    {"AirbusFBW/AnnunMode"},
+
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"AirbusFBW/SPDmanaged", &DisplayRefs::spdManaged},
+    {"AirbusFBW/SPDdashed", &DisplayRefs::spdDashed},
+
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"AirbusFBW/HDGmanaged", &DisplayRefs::hdgManaged},
+    {"AirbusFBW/HDGdashed", &DisplayRefs::hdgDashed},
+
+    {"sim/cockpit/autopilot/altitude"},
+    {"toliss_airbus/pfdoutputs/general/ap_altitude_reference", &DisplayRefs::apAltitudeReference},
+    {"AirbusFBW/ALTmanaged", &DisplayRefs::altManaged},
+
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"AirbusFBW/VSdashed", &DisplayRefs::vsDashed},
+
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"AirbusFBW/HDGTRKmode", &DisplayRefs::hdgTrkMode},
+
+    {"AirbusFBW/AP1Engage"},
+    {"AirbusFBW/AP2Engage"},
+
+    {"AirbusFBW/BaroStdCapt", &DisplayRefs::baroStdCapt},
+    {"AirbusFBW/BaroUnitCapt", &DisplayRefs::baroUnitCapt},
+    {"AirbusFBW/BaroStdFO", &DisplayRefs::baroStdFO},
+    {"AirbusFBW/BaroUnitFO", &DisplayRefs::baroUnitFO},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+};
+
 TolissFCUEfisProfile::TolissFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/SupplLightLevelRehostats", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 2) {
             return;
@@ -38,7 +73,7 @@ TolissFCUEfisProfile::TolissFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAir
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("AirbusFBW/AnnunMode", [this](int annunMode) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/SupplLightLevelRehostats");
@@ -66,12 +101,12 @@ TolissFCUEfisProfile::TolissFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAir
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/NDShowNDBCapt");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/NDShowARPTCapt");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FCUAvail", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/AnnunMode");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/AP1Engage", [this, product](bool engaged) {
         product->setLedBrightness(FCUEfisLed::AP1_GREEN, engaged || isAnnunTest() ? 1 : 0);
@@ -188,39 +223,7 @@ bool TolissFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &TolissFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "AirbusFBW/FCUAvail",
-        "AirbusFBW/AnnunMode",
-
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "AirbusFBW/SPDmanaged",
-        "AirbusFBW/SPDdashed",
-
-        "sim/cockpit/autopilot/heading_mag",
-        "AirbusFBW/HDGmanaged",
-        "AirbusFBW/HDGdashed",
-
-        "sim/cockpit/autopilot/altitude",
-        "toliss_airbus/pfdoutputs/general/ap_altitude_reference",
-        "AirbusFBW/ALTmanaged",
-
-        "sim/cockpit/autopilot/vertical_velocity",
-        "AirbusFBW/VSdashed",
-
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "AirbusFBW/HDGTRKmode",
-
-        "AirbusFBW/AP1Engage",
-        "AirbusFBW/AP2Engage",
-
-        "AirbusFBW/BaroStdCapt",
-        "AirbusFBW/BaroUnitCapt",
-        "AirbusFBW/BaroStdFO",
-        "AirbusFBW/BaroUnitFO",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -326,19 +329,19 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &TolissFCUEfisProfile::butt
 void TolissFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto datarefManager = Dataref::getInstance();
 
-    data.displayEnabled = datarefManager->getCached<bool>("AirbusFBW/FCUAvail");
+    data.displayEnabled = datarefManager->getCached<bool>(displayRefs.fcuAvail);
     data.displayTest = isAnnunTest(true);
 
     // Set managed mode indicators
-    data.spdManaged = datarefManager->getCached<bool>("AirbusFBW/SPDmanaged");
-    data.hdgManaged = datarefManager->getCached<bool>("AirbusFBW/HDGmanaged");
-    data.altManaged = datarefManager->getCached<bool>("AirbusFBW/ALTmanaged");
+    data.spdManaged = datarefManager->getCached<bool>(displayRefs.spdManaged);
+    data.hdgManaged = datarefManager->getCached<bool>(displayRefs.hdgManaged);
+    data.altManaged = datarefManager->getCached<bool>(displayRefs.altManaged);
 
     // Speed/Mach mode
-    data.spdMach = datarefManager->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = datarefManager->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    data.spdMach = datarefManager->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = datarefManager->getCached<float>(displayRefs.airspeedDialKtsMach);
 
-    if (speed > 0 && datarefManager->getCached<bool>("AirbusFBW/SPDdashed") == false) {
+    if (speed > 0 && datarefManager->getCached<bool>(displayRefs.spdDashed) == false) {
         std::stringstream ss;
         if (data.spdMach) {
             // In Mach mode, format as 0.XX -> "0XX" (e.g., 0.40 -> "040", 0.82 -> "082")
@@ -354,8 +357,8 @@ void TolissFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format FCU heading display
-    float heading = datarefManager->getCached<float>("sim/cockpit/autopilot/heading_mag");
-    if (heading >= 0 && datarefManager->getCached<bool>("AirbusFBW/HDGdashed") == false) {
+    float heading = datarefManager->getCached<float>(displayRefs.headingMag);
+    if (heading >= 0 && datarefManager->getCached<bool>(displayRefs.hdgDashed) == false) {
         // Convert 360 to 0 for display
         int hdgDisplay = static_cast<int>(heading) % 360;
         std::stringstream ss;
@@ -366,7 +369,7 @@ void TolissFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format FCU altitude display
-    float altitude = datarefManager->getCached<float>("toliss_airbus/pfdoutputs/general/ap_altitude_reference");
+    float altitude = datarefManager->getCached<float>(displayRefs.apAltitudeReference);
     if (altitude >= 0) {
         int altInt = static_cast<int>(altitude);
         std::stringstream ss;
@@ -378,11 +381,11 @@ void TolissFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Format vertical speed display
-    float vs = datarefManager->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
-    bool vsDashed = datarefManager->getCached<bool>("AirbusFBW/VSdashed");
+    float vs = datarefManager->getCached<float>(displayRefs.verticalVelocity);
+    bool vsDashed = datarefManager->getCached<bool>(displayRefs.vsDashed);
 
     // HDG/TRK mode
-    data.headingTrk = datarefManager->getCached<bool>("AirbusFBW/HDGTRKmode");
+    data.headingTrk = datarefManager->getCached<bool>(displayRefs.hdgTrkMode);
     data.headingHdg = !data.headingTrk;
     data.vsMode = !data.headingTrk; // VS mode when HDG mode
     data.fpaMode = data.headingTrk; // FPA mode when TRK mode
@@ -448,12 +451,12 @@ void TolissFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     for (int i = 0; i < 2; i++) {
         bool isCaptain = i == 0;
 
-        bool isStd = datarefManager->getCached<bool>(isCaptain ? "AirbusFBW/BaroStdCapt" : "AirbusFBW/BaroStdFO");
-        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? "AirbusFBW/BaroUnitCapt" : "AirbusFBW/BaroUnitFO");
-        float baroValue = datarefManager->getCached<float>(isCaptain ? "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot" : "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+        bool isStd = datarefManager->getCached<bool>(isCaptain ? displayRefs.baroStdCapt : displayRefs.baroStdFO);
+        bool isBaroHpa = datarefManager->getCached<bool>(isCaptain ? displayRefs.baroUnitCapt : displayRefs.baroUnitFO);
+        float baroValue = datarefManager->getCached<float>(isCaptain ? displayRefs.barometerSettingInHgPilot : displayRefs.barometerSettingInHgCopilot);
 
         EfisDisplayValue value = {
-            .displayEnabled = datarefManager->getCached<bool>("AirbusFBW/FCUAvail"),
+            .displayEnabled = datarefManager->getCached<bool>(displayRefs.fcuAvail),
             .displayTest = isAnnunTest(true),
             .baro = "",
             .unitIsInHg = false,
@@ -1,6 +1,7 @@
 #ifndef TOLISS_FCU_EFIS_PROFILE_H
 #define TOLISS_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -10,6 +11,29 @@
 class TolissFCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         bool isAnnunTest(bool allowEssentialBusPowerOnly = false);
+        struct DisplayRefs {
+                DatarefId fcuAvail;
+                DatarefId spdManaged;
+                DatarefId hdgManaged;
+                DatarefId altManaged;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId spdDashed;
+                DatarefId headingMag;
+                DatarefId hdgDashed;
+                DatarefId apAltitudeReference;
+                DatarefId verticalVelocity;
+                DatarefId vsDashed;
+                DatarefId hdgTrkMode;
+                DatarefId baroStdCapt;
+                DatarefId baroStdFO;
+                DatarefId baroUnitCapt;
+                DatarefId baroUnitFO;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         TolissFCUEfisProfile(ProductFCUEfis *product);
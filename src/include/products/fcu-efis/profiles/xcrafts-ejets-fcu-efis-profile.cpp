@@ -8,7 +8,34 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+const DisplayRef<XCraftsEjetsFCUEfisProfile::DisplayRefs> XCraftsEjetsFCUEfisProfile::displayRefTable[] = {
+    {"XCrafts/ERJ/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+
+    {"XCrafts/ERJ/autopilot/altitude", &DisplayRefs::altitude},
+
+    {"XCrafts/ERJ/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+
+    {"sim/cockpit/autopilot/autopilot_mode"},
+    {"XCrafts/ERJ/autothrottle_armed"},
+    {"XCrafts/ERJ/autopilot/autothrottle_system_active"},
+    {"XCrafts/speed_knob_fms_man", &DisplayRefs::speedKnobFmsMan},
+
+    {"XCrafts/ERJ/cockpit/annunciators_test", &DisplayRefs::annunciatorsTest},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/physics/metric_press", &DisplayRefs::metricPress},
+    {"XCrafts/ERJ/STD_visible", &DisplayRefs::stdVisible},
+
+    {"sim/cockpit2/autopilot/st55_nav", &DisplayRefs::st55Nav},
+    {"sim/cockpit2/autopilot/st55_vs", &DisplayRefs::st55Vs},
+    {"sim/cockpit2/autopilot/st55_apr"},
+};
+
 XCraftsEjetsFCUEfisProfile::XCraftsEjetsFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<float>("XCrafts/panel_brt_1", [product](float brightness) {
         uint8_t target = static_cast<uint8_t>(brightness * 255);
         product->setLedBrightness(FCUEfisLed::BACKLIGHT, target);
@@ -23,7 +50,7 @@ XCraftsEjetsFCUEfisProfile::XCraftsEjetsFCUEfisProfile(ProductFCUEfis *product)
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("sim/cockpit/autopilot/autopilot_mode", [this, product](int mode) {
         bool engaged = (mode == 2);
@@ -54,7 +81,7 @@ XCraftsEjetsFCUEfisProfile::XCraftsEjetsFCUEfisProfile(ProductFCUEfis *product)
         Dataref::getInstance()->executeChangedCallbacksForDataref("XCrafts/ERJ/autothrottle_armed");
         Dataref::getInstance()->executeChangedCallbacksForDataref("XCrafts/ERJ/autopilot/autothrottle_system_active");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool XCraftsEjetsFCUEfisProfile::IsEligible() {
@@ -62,31 +89,7 @@ bool XCraftsEjetsFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &XCraftsEjetsFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "XCrafts/ERJ/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-
-        "sim/cockpit/autopilot/heading_mag",
-
-        "XCrafts/ERJ/autopilot/altitude",
-
-        "XCrafts/ERJ/autopilot/vertical_velocity",
-
-        "sim/cockpit/autopilot/autopilot_mode",
-        "XCrafts/ERJ/autothrottle_armed",
-        "XCrafts/ERJ/autopilot/autothrottle_system_active",
-        "XCrafts/speed_knob_fms_man",
-
-        "XCrafts/ERJ/cockpit/annunciators_test",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/physics/metric_press",
-        "XCrafts/ERJ/STD_visible",
-
-        "sim/cockpit2/autopilot/st55_nav",
-        "sim/cockpit2/autopilot/st55_vs",
-        "sim/cockpit2/autopilot/st55_apr",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -157,18 +160,18 @@ void XCraftsEjetsFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     auto dr = Dataref::getInstance();
 
     data.displayEnabled = true;
-    data.displayTest = dr->getCached<bool>("XCrafts/ERJ/cockpit/annunciators_test");
+    data.displayTest = dr->getCached<bool>(displayRefs.annunciatorsTest);
     data.displayEnabledWindowsFlag = FCUDisplayData::Window::All;
     data.displayEnabledWindowsFlag &= ~FCUDisplayData::LevelChangeHeader;
 
-    if (!dr->getCached<bool>("sim/cockpit2/autopilot/st55_vs")) {
+    if (!dr->getCached<bool>(displayRefs.st55Vs)) {
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::VerticalSpeedFPAHeader;
         data.displayEnabledWindowsFlag &= ~FCUDisplayData::VerticalSpeedFPAValue;
     }
 
     // Speed / Mach
-    data.spdMach = dr->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = dr->getCached<float>("XCrafts/ERJ/autopilot/airspeed_dial_kts_mach");
+    data.spdMach = dr->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = dr->getCached<float>(displayRefs.airspeedDialKtsMach);
 
     if (speed > 0) {
         std::stringstream ss;
@@ -184,7 +187,7 @@ void XCraftsEjetsFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Heading
-    float heading = dr->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = dr->getCached<float>(displayRefs.headingMag);
     if (heading >= 0) {
         int hdgDisplay = static_cast<int>(heading) % 360;
         std::stringstream ss;
@@ -202,7 +205,7 @@ void XCraftsEjetsFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.headingLat = false;
 
     // Altitude
-    float altitude = dr->getCached<float>("XCrafts/ERJ/autopilot/altitude"); // ugh.. 11900 (rounded FL110 maar display zegt FL111)
+    float altitude = dr->getCached<float>(displayRefs.altitude); // ugh.. 11900 (rounded FL110 maar display zegt FL111)
     if (altitude >= 0) {
         int altInt = (static_cast<int>(altitude) / 100) * 100;
         std::stringstream ss;
@@ -213,7 +216,7 @@ void XCraftsEjetsFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Vertical speed
-    float vs = dr->getCached<float>("XCrafts/ERJ/autopilot/vertical_velocity");
+    float vs = dr->getCached<float>(displayRefs.verticalVelocity);
     int vsInt = (static_cast<int>(vs) / 100) * 100;
     int absVs = std::abs(vsInt);
 
@@ -231,20 +234,20 @@ void XCraftsEjetsFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.fpaIndication = false;
     data.vsVerticalLine = data.vsMode && (data.verticalSpeed != "-----");
 
-    data.spdManaged = dr->getCached<bool>("XCrafts/speed_knob_fms_man");
-    data.hdgManaged = dr->getCached<bool>("sim/cockpit2/autopilot/st55_nav");
+    data.spdManaged = dr->getCached<bool>(displayRefs.speedKnobFmsMan);
+    data.hdgManaged = dr->getCached<bool>(displayRefs.st55Nav);
     data.altManaged = false;
 
     // EFIS baro display
-    float baroInHg = dr->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
-    bool isMetric = dr->getCached<bool>("sim/physics/metric_press");
+    float baroInHg = dr->getCached<float>(displayRefs.barometerSettingInHgPilot);
+    bool isMetric = dr->getCached<bool>(displayRefs.metricPress);
 
     EfisDisplayValue efisValue = {
         .displayEnabled = data.displayEnabled,
         .displayTest = data.displayTest,
         .baro = "",
         .unitIsInHg = !isMetric,
-        .isStd = dr->getCached<bool>("XCrafts/ERJ/STD_visible"),
+        .isStd = dr->getCached<bool>(displayRefs.stdVisible),
     };
 
     if (baroInHg > 0 && !efisValue.isStd) {
@@ -1,6 +1,7 @@
 #ifndef XCRAFTS_EJETS_FCU_EFIS_PROFILE_H
 #define XCRAFTS_EJETS_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <string>
@@ -10,6 +11,22 @@ class XCraftsEjetsFCUEfisProfile : public FCUEfisAircraftProfile {
     private:
         int altitudeIncrements = 0;
         bool isAnnunTest();
+        struct DisplayRefs {
+                DatarefId annunciatorsTest;
+                DatarefId st55Vs;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId speedKnobFmsMan;
+                DatarefId st55Nav;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId metricPress;
+                DatarefId stdVisible;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         XCraftsEjetsFCUEfisProfile(ProductFCUEfis *product);
@@ -12,7 +12,28 @@
 #include <sstream>
 #include <XPLMUtilities.h>
 
+const DisplayRef<XCraftsErjFCUEfisProfile::DisplayRefs> XCraftsErjFCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot", &DisplayRefs::barometerSettingIsStdPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot", &DisplayRefs::barometerSettingInHgPilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot", &DisplayRefs::barometerSettingIsStdCopilot},
+    {"sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot", &DisplayRefs::barometerSettingInHgCopilot},
+    {"sim/physics/metric_press", &DisplayRefs::metricPress},
+    {"sim/cockpit2/autopilot/flight_director_mode"},
+    {"sim/cockpit2/autopilot/flight_director2_mode"},
+    {"sim/cockpit2/EFIS/map_range"},
+    {"sim/cockpit2/EFIS/map_range_copilot"},
+    {"XCrafts/ERJ/MFD1/map_plan_status"},
+    {"XCrafts/ERJ/MFD2/map_plan_status"},
+};
+
 XCraftsErjFCUEfisProfile::XCraftsErjFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio_manual", [product](const std::vector<float> &brightness) {
         if (brightness.size() <= 12) {
             return;
@@ -33,7 +54,7 @@ XCraftsErjFCUEfisProfile::XCraftsErjFCUEfisProfile(ProductFCUEfis *product) : FC
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<int>("sim/cockpit/autopilot/autopilot_mode", [product](int mode) {
         bool engaged = (mode == 2);
@@ -60,25 +81,7 @@ bool XCraftsErjFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &XCraftsErjFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit/autopilot/vertical_velocity",
-        "sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot",
-        "sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot",
-        "sim/physics/metric_press",
-        "sim/cockpit2/autopilot/flight_director_mode",
-        "sim/cockpit2/autopilot/flight_director2_mode",
-        "sim/cockpit2/EFIS/map_range",
-        "sim/cockpit2/EFIS/map_range_copilot",
-        "XCrafts/ERJ/MFD1/map_plan_status",
-        "XCrafts/ERJ/MFD2/map_plan_status",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -152,8 +155,8 @@ void XCraftsErjFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
 
     data.headingHdg = true;
     data.displayEnabledWindowsFlag &= ~FCUDisplayData::Window::LevelChangeHeader;
-    data.spdMach = datarefManager->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speed = datarefManager->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    data.spdMach = datarefManager->getCached<bool>(displayRefs.airspeedIsMach);
+    float speed = datarefManager->getCached<float>(displayRefs.airspeedDialKtsMach);
 
     if (speed > 0) {
         std::stringstream ss;
@@ -168,7 +171,7 @@ void XCraftsErjFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.speed = "---";
     }
 
-    float heading = datarefManager->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = datarefManager->getCached<float>(displayRefs.headingMag);
     if (heading >= 0) {
         int hdgDisplay = static_cast<int>(heading) % 360;
         std::stringstream ss;
@@ -178,7 +181,7 @@ void XCraftsErjFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.heading = "---";
     }
 
-    float altitude = datarefManager->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = datarefManager->getCached<float>(displayRefs.altitude);
     if (altitude >= 0) {
         int altInt = static_cast<int>(altitude);
         std::stringstream ss;
@@ -188,7 +191,7 @@ void XCraftsErjFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         data.altitude = "-----";
     }
 
-    float vs = datarefManager->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+    float vs = datarefManager->getCached<float>(displayRefs.verticalVelocity);
     std::stringstream ss;
     int vsInt = static_cast<int>(std::round(vs));
     int absVs = std::abs(vsInt);
@@ -204,10 +207,10 @@ void XCraftsErjFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
 
     data.headingLat = true;
 
-    bool metricPress = datarefManager->getCached<bool>("sim/physics/metric_press");
+    bool metricPress = datarefManager->getCached<bool>(displayRefs.metricPress);
 
-    bool isStdPilot = datarefManager->getCached<bool>("sim/cockpit2/gauges/actuators/barometer_setting_is_std_pilot");
-    float baroValuePilot = datarefManager->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_pilot");
+    bool isStdPilot = datarefManager->getCached<bool>(displayRefs.barometerSettingIsStdPilot);
+    float baroValuePilot = datarefManager->getCached<float>(displayRefs.barometerSettingInHgPilot);
     EfisDisplayValue pilotValue = {
         .baro = "",
         .unitIsInHg = false,
@@ -217,8 +220,8 @@ void XCraftsErjFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
         pilotValue.setBaro(baroValuePilot, !metricPress);
     }
 
-    bool isStdCopilot = datarefManager->getCached<bool>("sim/cockpit2/gauges/actuators/barometer_setting_is_std_copilot");
-    float baroValueCopilot = datarefManager->getCached<float>("sim/cockpit2/gauges/actuators/barometer_setting_in_hg_copilot");
+    bool isStdCopilot = datarefManager->getCached<bool>(displayRefs.barometerSettingIsStdCopilot);
+    float baroValueCopilot = datarefManager->getCached<float>(displayRefs.barometerSettingInHgCopilot);
     EfisDisplayValue copilotValue = {
         .baro = "",
         .unitIsInHg = false,
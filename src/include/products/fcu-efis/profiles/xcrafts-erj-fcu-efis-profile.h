@@ -1,6 +1,7 @@
 #ifndef XCRAFTS_ERJ_FCU_EFIS_PROFILE_H
 #define XCRAFTS_ERJ_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,22 @@
 #include <vector>
 
 class XCraftsErjFCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId metricPress;
+                DatarefId barometerSettingIsStdPilot;
+                DatarefId barometerSettingInHgPilot;
+                DatarefId barometerSettingIsStdCopilot;
+                DatarefId barometerSettingInHgCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         XCraftsErjFCUEfisProfile(ProductFCUEfis *product);
 
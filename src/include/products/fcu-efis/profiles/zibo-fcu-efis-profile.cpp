@@ -11,7 +11,48 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<ZiboFCUEfisProfile::DisplayRefs> ZiboFCUEfisProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/avionics_on", &DisplayRefs::avionicsOn},
+
+    // Autopilot speed
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+
+    // Heading
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+
+    // Altitude
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+
+    // Vertical speed
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+
+    // Barometer settings - use Zibo-specific datarefs
+    {"laminar/B738/EFIS/baro_sel_in_hg_pilot", &DisplayRefs::baroSelInHgPilot},
+    {"laminar/B738/EFIS/baro_sel_in_hg_copilot", &DisplayRefs::baroSelInHgCopilot},
+
+    // Barometer unit selection - triggers display updates
+    {"laminar/B738/EFIS_control/capt/baro_in_hpa", &DisplayRefs::captBaroInHpa},
+    {"laminar/B738/EFIS_control/fo/baro_in_hpa", &DisplayRefs::foBaroInHpa},
+
+    // Barometer STD mode - shows "Std" instead of the numeric value
+    {"laminar/B738/EFIS/baro_set_std_pilot", &DisplayRefs::baroSetStdPilot},
+    {"laminar/B738/EFIS/baro_set_std_copilot", &DisplayRefs::baroSetStdCopilot},
+
+    // Vertical speed window visibility
+    {"laminar/B738/autopilot/vvi_dial_show", &DisplayRefs::vviDialShow},
+
+    // Speed window visibility
+    {"laminar/B738/autopilot/show_ias", &DisplayRefs::showIas},
+
+    // LNAV/VNAV status - drive the HDG/ALT managed dots
+    {"laminar/B738/autopilot/lnav_status", &DisplayRefs::lnavStatus},
+    {"laminar/B738/autopilot/vnav_status1", &DisplayRefs::vnavStatus1},
+};
+
 ZiboFCUEfisProfile::ZiboFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/electric/panel_brightness", [product](const std::vector<float> &brightness) {
         if (brightness.empty()) {
             return;
@@ -36,12 +77,12 @@ ZiboFCUEfisProfile::ZiboFCUEfisProfile(ProductFCUEfis *product) : FCUEfisAircraf
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/avionics_on");
 
@@ -120,45 +161,7 @@ bool ZiboFCUEfisProfile::IsEligible() {
 }
 
 const std::vector<std::string> &ZiboFCUEfisProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/avionics_on",
-
-        // Autopilot speed
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-
-        // Heading
-        "sim/cockpit/autopilot/heading_mag",
-
-        // Altitude
-        "sim/cockpit/autopilot/altitude",
-
-        // Vertical speed
-        "sim/cockpit/autopilot/vertical_velocity",
-
-        // Barometer settings - use Zibo-specific datarefs
-        "laminar/B738/EFIS/baro_sel_in_hg_pilot",
-        "laminar/B738/EFIS/baro_sel_in_hg_copilot",
-
-        // Barometer unit selection - triggers display updates
-        "laminar/B738/EFIS_control/capt/baro_in_hpa",
-        "laminar/B738/EFIS_control/fo/baro_in_hpa",
-
-        // Barometer STD mode - shows "Std" instead of the numeric value
-        "laminar/B738/EFIS/baro_set_std_pilot",
-        "laminar/B738/EFIS/baro_set_std_copilot",
-
-        // Vertical speed window visibility
-        "laminar/B738/autopilot/vvi_dial_show",
-
-        // Speed window visibility
-        "laminar/B738/autopilot/show_ias",
-
-        // LNAV/VNAV status - drive the HDG/ALT managed dots
-        "laminar/B738/autopilot/lnav_status",
-        "laminar/B738/autopilot/vnav_status1",
-    };
-
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -283,7 +286,7 @@ const std::unordered_map<uint16_t, FCUEfisButtonDef> &ZiboFCUEfisProfile::button
 }
 
 void ZiboFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
-    bool avionicsOn = Dataref::getInstance()->getCached<bool>("sim/cockpit/electrical/avionics_on");
+    bool avionicsOn = Dataref::getInstance()->getCached<bool>(displayRefs.avionicsOn);
 
     if (!avionicsOn) {
         // Clear all displays when no avionics power
@@ -305,14 +308,14 @@ void ZiboFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     data.headingHdg = true;
 
     // "Managed" dots follow the FMC modes: LNAV -> HDG dot, VNAV -> ALT dot
-    data.hdgManaged = Dataref::getInstance()->getCached<float>("laminar/B738/autopilot/lnav_status") > 0.5f;
-    data.altManaged = Dataref::getInstance()->getCached<float>("laminar/B738/autopilot/vnav_status1") > 0.5f;
+    data.hdgManaged = Dataref::getInstance()->getCached<float>(displayRefs.lnavStatus) > 0.5f;
+    data.altManaged = Dataref::getInstance()->getCached<float>(displayRefs.vnavStatus1) > 0.5f;
 
     // Speed display - only show when the MCP speed window is active
-    bool speedWindowActive = Dataref::getInstance()->getCached<bool>("laminar/B738/autopilot/show_ias");
+    bool speedWindowActive = Dataref::getInstance()->getCached<bool>(displayRefs.showIas);
     if (speedWindowActive) {
-        bool isMach = Dataref::getInstance()->getCached<int>("sim/cockpit/autopilot/airspeed_is_mach");
-        float speed = Dataref::getInstance()->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+        bool isMach = Dataref::getInstance()->getCached<int>(displayRefs.airspeedIsMach);
+        float speed = Dataref::getInstance()->getCached<float>(displayRefs.airspeedDialKtsMach);
 
         if (isMach) {
             std::ostringstream ss;
@@ -336,21 +339,21 @@ void ZiboFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Heading display
-    float heading = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = Dataref::getInstance()->getCached<float>(displayRefs.headingMag);
     std::ostringstream headingSs;
     headingSs << std::setw(3) << std::setfill('0') << static_cast<int>(heading);
     data.heading = headingSs.str();
 
     // Altitude display
-    float altitude = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = Dataref::getInstance()->getCached<float>(displayRefs.altitude);
     std::ostringstream altSs;
     altSs << std::setw(5) << std::setfill('0') << static_cast<int>(altitude);
     data.altitude = altSs.str();
 
     // Vertical speed display - only show when window is active
-    bool vsWindowActive = Dataref::getInstance()->getCached<bool>("laminar/B738/autopilot/vvi_dial_show");
+    bool vsWindowActive = Dataref::getInstance()->getCached<bool>(displayRefs.vviDialShow);
     if (vsWindowActive) {
-        float vs = Dataref::getInstance()->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
+        float vs = Dataref::getInstance()->getCached<float>(displayRefs.verticalVelocity);
         std::ostringstream vsSs;
         int vsInt = static_cast<int>(vs);
         int absVs = std::abs(vsInt);
@@ -364,18 +367,18 @@ void ZiboFCUEfisProfile::updateDisplayData(FCUDisplayData &data) {
     }
 
     // Barometer displays with Zibo unit selection
-    float baroPilot = Dataref::getInstance()->getCached<float>("laminar/B738/EFIS/baro_sel_in_hg_pilot");
-    float baroFO = Dataref::getInstance()->getCached<float>("laminar/B738/EFIS/baro_sel_in_hg_copilot");
+    float baroPilot = Dataref::getInstance()->getCached<float>(displayRefs.baroSelInHgPilot);
+    float baroFO = Dataref::getInstance()->getCached<float>(displayRefs.baroSelInHgCopilot);
 
-    bool pilotInHpa = Dataref::getInstance()->getCached<bool>("laminar/B738/EFIS_control/capt/baro_in_hpa");
-    bool foInHpa = Dataref::getInstance()->getCached<bool>("laminar/B738/EFIS_control/fo/baro_in_hpa");
+    bool pilotInHpa = Dataref::getInstance()->getCached<bool>(displayRefs.captBaroInHpa);
+    bool foInHpa = Dataref::getInstance()->getCached<bool>(displayRefs.foBaroInHpa);
 
     data.efisLeft.setBaro(baroPilot, !pilotInHpa);
     data.efisRight.setBaro(baroFO, !foInHpa);
 
     // STD mode overrides the numeric readout with "Std" (setBaro resets isStd, so set it after)
-    data.efisLeft.isStd = Dataref::getInstance()->getCached<bool>("laminar/B738/EFIS/baro_set_std_pilot");
-    data.efisRight.isStd = Dataref::getInstance()->getCached<bool>("laminar/B738/EFIS/baro_set_std_copilot");
+    data.efisLeft.isStd = Dataref::getInstance()->getCached<bool>(displayRefs.baroSetStdPilot);
+    data.efisRight.isStd = Dataref::getInstance()->getCached<bool>(displayRefs.baroSetStdCopilot);
 }
 
 void ZiboFCUEfisProfile::buttonPressed(const FCUEfisButtonDef *button, XPLMCommandPhase phase) {
@@ -1,6 +1,7 @@
 #ifndef ZIBO_FCU_EFIS_PROFILE_H
 #define ZIBO_FCU_EFIS_PROFILE_H
 
+#include "dataref.h"
 #include "fcu-efis-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,28 @@
 #include <unordered_map>
 
 class ZiboFCUEfisProfile : public FCUEfisAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId avionicsOn;
+                DatarefId lnavStatus;
+                DatarefId vnavStatus1;
+                DatarefId showIas;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId vviDialShow;
+                DatarefId verticalVelocity;
+                DatarefId baroSelInHgPilot;
+                DatarefId baroSelInHgCopilot;
+                DatarefId captBaroInHpa;
+                DatarefId foBaroInHpa;
+                DatarefId baroSetStdPilot;
+                DatarefId baroSetStdCopilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         ZiboFCUEfisProfile(ProductFCUEfis *product);
 
@@ -1,13 +1,16 @@
 #ifndef FMC_AIRCRAFT_PROFILE_H
 #define FMC_AIRCRAFT_PROFILE_H
 
+#include "dataref.h"
 #include "fmc-hardware-mapping.h"
 #include "profile-cleanup.h"
 
 #include <array>
+#include <functional>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <XPLMUtilities.h>
 
 enum FMCLed : unsigned char {
@@ -97,9 +100,46 @@ enum class FMCBackgroundVariant : unsigned char {
 class ProductFMC;
 
 class FMCAircraftProfile {
+    private:
+        std::vector<DatarefId> displayIds;
+
     protected:
         ProductFMC *product;
 
+        // displayDatarefs() interned on first use, index for index, so
+        // updatePage() reads the screen by id rather than by name.
+        const std::vector<DatarefId> &displayDatarefIds() {
+            if (displayIds.empty()) {
+                for (const std::string &ref : displayDatarefs()) {
+                    displayIds.push_back(Dataref::getInstance()->intern(ref.c_str()));
+                }
+            }
+            return displayIds;
+        }
+
+        // For screens read line by line with two refs per line (e.g. text and
+        // style): lineRefs() lists first(0), second(0), first(1), ... at the
+        // start of displayDatarefs(), and lineIds() reads a line's pair back.
+        struct LineIds {
+                DatarefId first;
+                DatarefId second;
+        };
+
+        static std::vector<std::string> lineRefs(int lines, const std::function<std::string(int)> &first, const std::function<std::string(int)> &second) {
+            std::vector<std::string> refs;
+            refs.reserve(lines * 2);
+            for (int line = 0; line < lines; ++line) {
+                refs.push_back(first(line));
+                refs.push_back(second(line));
+            }
+            return refs;
+        }
+
+        LineIds lineIds(int line) {
+            const std::vector<DatarefId> &ids = displayDatarefIds();
+            return {ids[line * 2], ids[line * 2 + 1]};
+        }
+
     public:
         FMCAircraftProfile(ProductFMC *product) :
             product(product) {};
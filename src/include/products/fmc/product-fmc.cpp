@@ -1,9 +1,11 @@
 #include "product-fmc.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "config.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/bae146-fmc-profile.h"
 #include "profiles/ff350-fmc-profile.h"
 #include "profiles/ff767-fmc-profile.h"
@@ -25,20 +27,53 @@
 #include "profiles/zibo-fmc-profile.h"
 #include "usbcontroller.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <XPLMProcessing.h>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using FMCProfiles = ProfileRegistry<ProductFMC, FMCAircraftProfile,
+    JAR330FMCProfile,
+    FF350FMCProfile,
+    TolissFMCProfile,
+    CL650FMCProfile,
+    Q4XPFMCProfile,
+    LaminarA333FMCProfile,
+    LaminarCitXFMCProfile,
+    XCraftsEjetsFMCProfile,
+    XCraftsErjFMCProfile,
+    ZiboFMCProfile,
+    RotateMD11FMCProfile,
+    FlightFactor767FMCProfile,
+    Strato77WFMCProfile,
+    FlightFactor777FMCProfile,
+    FPS748FMCProfile,
+    BAE146FMCProfile,
+    SparkyB744FMCProfile,
+    IXEG733FMCProfile,
+    PA28FMCProfile>;
+
+namespace {
+    // Page bytes carried by one 0xf2 display report after its report ID.
+    constexpr size_t kDisplayChunkLength = kWritePacketSize - 1;
+
+    std::string fontKey(const std::string &source, unsigned char characterHeight, unsigned char characterWidth, unsigned char x, unsigned char y) {
+        return source + "@" + std::to_string(characterHeight) + "x" + std::to_string(characterWidth) + "+" + std::to_string(x) + "," + std::to_string(y);
+    }
+}
+
 ProductFMC::ProductFMC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, FMCHardwareType hardwareType, FMCDeviceVariant variant, unsigned char identifierByte) : USBDevice(hidDevice, vendorId, productId, vendorName, productName), hardwareType(hardwareType), identifierByte(identifierByte), deviceVariant(variant) {
     profile = nullptr;
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageBytesPerLine, ' '));
-    lastUpdateCycle = 0;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
     menuItemId = -1;
     fontsMenuItemId = -1;
 
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 
 #ifdef DEBUG
@@ -51,7 +86,7 @@ ProductFMC::ProductFMC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t pr
             std::string fontFile = AppState::getInstance()->readPreference("FMCFont", "");
             Logger::getInstance()->info("Reloading active font (\"%s\") on FMC...\n", fontFile.c_str());
 
-            setFont(preferredFontVariant);
+            setFont(preferredFontVariant, true);
             updatePage(true);
         });
 #endif
@@ -71,86 +106,15 @@ ProductFMC::~ProductFMC() {
 }
 
 void ProductFMC::setProfileForCurrentAircraft() {
-    if (JAR330FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new JAR330FMCProfile(this);
-        profileReady = true;
-    } else if (FF350FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new FF350FMCProfile(this);
-        profileReady = true;
-    } else if (TolissFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new TolissFMCProfile(this);
-        profileReady = true;
-    } else if (CL650FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new CL650FMCProfile(this);
-        profileReady = true;
-    } else if (Q4XPFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new Q4XPFMCProfile(this);
-        profileReady = true;
-    } else if (LaminarA333FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new LaminarA333FMCProfile(this);
-        profileReady = true;
-    } else if (LaminarCitXFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new LaminarCitXFMCProfile(this);
-        profileReady = true;
-    } else if (XCraftsEjetsFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new XCraftsEjetsFMCProfile(this);
-        profileReady = true;
-    } else if (XCraftsErjFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new XCraftsErjFMCProfile(this);
-        profileReady = true;
-    } else if (ZiboFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new ZiboFMCProfile(this);
-        profileReady = true;
-    } else if (RotateMD11FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new RotateMD11FMCProfile(this);
-        profileReady = true;
-    } else if (FlightFactor767FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new FlightFactor767FMCProfile(this);
-        profileReady = true;
-    } else if (Strato77WFMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new Strato77WFMCProfile(this);
-        profileReady = true;
-    } else if (FlightFactor777FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new FlightFactor777FMCProfile(this);
-        profileReady = true;
-    } else if (FPS748FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new FPS748FMCProfile(this);
-        profileReady = true;
-    } else if (BAE146FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new BAE146FMCProfile(this);
-        profileReady = true;
-    } else if (SparkyB744FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new SparkyB744FMCProfile(this);
-        profileReady = true;
-    } else if (IXEG733FMCProfile::IsEligible()) {
-        clearDisplay();
-        profile = new IXEG733FMCProfile(this);
-        profileReady = true;
-    } else if (PA28FMCProfile::IsEligible()) {
+    displaySubscription.reset();
+
+    auto factory = FMCProfiles::find();
+    if (factory) {
         clearDisplay();
-        profile = new PA28FMCProfile(this);
-        profileReady = true;
-    } else {
-        profile = nullptr;
-        profileReady = false;
     }
+
+    profile = factory ? factory(this) : nullptr;
+    profileReady = profile != nullptr;
 }
 
 const char *ProductFMC::classIdentifier() {
@@ -173,25 +137,28 @@ const char *ProductFMC::activeProfileName() const {
 
 bool ProductFMC::connect() {
     if (USBDevice::connect()) {
+        lastLedBrightness.clear();
+        loadedFontKey.clear();
+
         uint8_t col_bg[] = {0x00, 0x00, 0x00};
 
-        writeData({0xf0, 0x0, 0x1, 0x38, identifierByte, 0xbb, 0x0, 0x0, 0x1e, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x18, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x34, 0x0, 0x18, 0x0, 0xe, 0x0, 0x18, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x2, 0x38, 0x0, 0x0, 0x0, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x1, 0x0, 0x6, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x3, 0x38, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0xff, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x4, 0x38, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0xff, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x5, 0x38, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0x63, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x6, 0x38, 0xff, 0xff, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x7, 0x38, 0x0, 0x0, 0x2, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x42, 0x5c, 0x61, 0xff, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x8, 0x38, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x77, 0x77, 0x77, 0xff, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x5e, 0x73, 0x79, 0xff, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x9, 0x38, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, col_bg[0], col_bg[1], col_bg[2], 0xff, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xa, 0x38, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xb, 0x38, 0xff, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xc, 0x38, 0x0, 0x3, 0x0, 0xff, 0x63, 0xff, 0xff, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xd, 0x38, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x42, 0x5c, 0x61, 0xff, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xe, 0x38, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x77, 0x77, 0x77, 0xff, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5e, 0x73, 0x79, 0xff, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0xf, 0x38, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x10, 0x38, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x1a, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
-        writeData({0xf0, 0x0, 0x11, 0x12, 0x2, identifierByte, 0xbb, 0x0, 0x0, 0x1c, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0});
+        writeData({0xf0, 0x0, 0x1, 0x38, identifierByte, 0xbb, 0x0, 0x0, 0x1e, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x18, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x34, 0x0, 0x18, 0x0, 0xe, 0x0, 0x18, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x2, 0x38, 0x0, 0x0, 0x0, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0xc4, 0x24, 0xa, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x1, 0x0, 0x6, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x3, 0x38, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0xff, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x4, 0x38, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0xff, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x5, 0x38, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0x63, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x6, 0x38, 0xff, 0xff, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x7, 0x38, 0x0, 0x0, 0x2, 0x0, 0x0, 0xff, 0xff, 0xff, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x42, 0x5c, 0x61, 0xff, 0xc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x8, 0x38, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x77, 0x77, 0x77, 0xff, 0xd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x2, 0x0, 0x5e, 0x73, 0x79, 0xff, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x9, 0x38, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, col_bg[0], col_bg[1], col_bg[2], 0xff, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xa5, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0xa, 0x38, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0xb, 0x38, 0xff, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3d, 0xff, 0x0, 0xff, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0xc, 0x38, 0x0, 0x3, 0x0, 0xff, 0x63, 0xff, 0xff, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0xd, 0x38, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0xff, 0xff, 0xff, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x42, 0x5c, 0x61, 0xff, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0xe, 0x38, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x77, 0x77, 0x77, 0xff, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5e, 0x73, 0x79, 0xff, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0xf, 0x38, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x10, 0x38, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x19, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0, 0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, identifierByte, 0xbb, 0x0, 0x0, 0x1a, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
+        writeData({0xf0, 0x0, 0x11, 0x12, 0x2, identifierByte, 0xbb, 0x0, 0x0, 0x1c, 0x1, 0x0, 0x0, 0x76, 0x72, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}, WriteLane::BULK);
 
         setLedBrightness(FMCLed::BACKLIGHT, 128);
         setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
@@ -253,6 +220,10 @@ void ProductFMC::blackout() {
 
 void ProductFMC::unloadProfile() {
     profileReady = false;
+    displaySubscription.reset();
+    // No rematching against the outgoing aircraft: the identity generation
+    // moves on once the next one has loaded.
+    profileMatchGeneration = AircraftIdentity::getInstance()->getGeneration();
 
     if (!profile) {
         return;
@@ -262,21 +233,55 @@ void ProductFMC::unloadProfile() {
     profile = nullptr;
 }
 
+void ProductFMC::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(FMCLed::BACKLIGHT, 128);
+    setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
+    setLedBrightness(FMCLed::OVERALL_LEDS_BRIGHTNESS, 255);
+    setAllLedsEnabled(false);
+
+    setLedBrightness(FMCLed::MCDU_FAIL, 1);
+    setLedBrightness(FMCLed::PFP_FAIL, 1);
+
+    setProfileForCurrentAircraft();
+}
+
 void ProductFMC::update() {
     if (!connected) {
         return;
     }
 
     if (!profile) {
-        setProfileForCurrentAircraft();
+        // Matching again only helps once the aircraft identity has moved on
+        // (new datarefs, plugin enabled or the recheck backoff).
+        uint64_t identityGeneration = AircraftIdentity::getInstance()->getGeneration();
+        if (identityGeneration == profileMatchGeneration) {
+            return;
+        }
+
+        profileMatchGeneration = identityGeneration;
+        AppState::getInstance()->executeWithinFrameBudget("setProfile", FrameWorkPriority::LOW, this, [this]() {
+            if (!connected || profile) {
+                return;
+            }
+
+            setProfileForCurrentAircraft();
+            if (!profile) {
+                AircraftIdentity::getInstance()->scheduleRecheck();
+            }
+        });
         return;
     }
 
     USBDevice::update();
 
-    if (++displayUpdateFrameCounter >= std::max(getDisplayUpdateFrameInterval(), 4)) {
-        displayUpdateFrameCounter = 0;
-        updatePage();
+    if (isDisplayUpdateDue(std::chrono::milliseconds(67))) {
+        AppState::getInstance()->executeWithinFrameBudget("updateDisplays", FrameWorkPriority::NORMAL, this, [this]() {
+            updatePage();
+        });
     }
 }
 
@@ -302,20 +307,13 @@ void ProductFMC::didReceiveData(int reportId, uint8_t *report, int reportLength)
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductFMC::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -329,7 +327,7 @@ void ProductFMC::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, ui
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     XPLMCommandPhase command = -1;
     if (pressed && !pressedButtonIndexExists) {
         command = xplm_CommandBegin;
@@ -344,7 +342,7 @@ void ProductFMC::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, ui
     }
 
     if (command == xplm_CommandBegin) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
     }
 
     FMCKey key = FMCHardwareMapping::ButtonIdentifierForIndex(hardwareType, hardwareButtonIndex);
@@ -361,7 +359,7 @@ void ProductFMC::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, ui
     }
 
     if (command == xplm_CommandEnd) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
     }
 }
 
@@ -370,19 +368,11 @@ void ProductFMC::updatePage(bool forceUpdate) {
         return;
     }
 
-    auto datarefManager = Dataref::getInstance();
-    bool shouldUpdate = forceUpdate;
-
-    for (const std::string &dataref : profile->displayDatarefs()) {
-        if (!lastUpdateCycle || datarefManager->getCachedLastUpdate(dataref.c_str()) > lastUpdateCycle) {
-            shouldUpdate = true;
-            break;
-        }
-    }
+    bool shouldUpdate = forceUpdate || displaySubscription.hasChanges(profile->displayDatarefs());
 
     if (shouldUpdate) {
         profile->updatePage(page);
-        lastUpdateCycle = XPLMGetCycleNumber();
+        displaySubscription.acknowledge();
         draw();
     }
 }
@@ -393,30 +383,32 @@ void ProductFMC::draw(const std::vector<std::vector<char>> *pagePtr) {
     }
 
     const auto &p = pagePtr ? *pagePtr : page;
-    std::vector<uint8_t> buf;
+    drawBuffer.clear();
 
     for (int i = 0; i < ProductFMC::PageLines; ++i) {
         for (int j = 0; j < ProductFMC::PageCharsPerLine; ++j) {
             char color = p[i][j * ProductFMC::PageBytesPerChar];
             bool fontSmall = p[i][j * ProductFMC::PageBytesPerChar + 1];
             auto [dataLow, dataHigh] = dataFromColFont(color, fontSmall);
-            buf.push_back(dataLow);
-            buf.push_back(dataHigh);
+            drawBuffer.push_back(dataLow);
+            drawBuffer.push_back(dataHigh);
 
             char val = p[i][j * ProductFMC::PageBytesPerChar + ProductFMC::PageBytesPerChar - 1];
-            profile->mapCharacter(&buf, val, fontSmall);
+            profile->mapCharacter(&drawBuffer, val, fontSmall);
         }
     }
 
-    while (!buf.empty()) {
-        size_t maxLength = std::min<size_t>(63, buf.size());
-        std::vector<uint8_t> usbBuf(buf.begin(), buf.begin() + maxLength);
-        usbBuf.insert(usbBuf.begin(), 0xf2);
-        if (maxLength < 63) {
-            usbBuf.insert(usbBuf.end(), 63 - maxLength, 0);
+    for (size_t offset = 0; offset < drawBuffer.size(); offset += kDisplayChunkLength) {
+        WritePacket *packet = reservePacket();
+        if (!packet) {
+            return;
         }
-        writeData(usbBuf);
-        buf.erase(buf.begin(), buf.begin() + maxLength);
+
+        size_t chunkLength = std::min(kDisplayChunkLength, drawBuffer.size() - offset);
+        packet->bytes[0] = 0xf2;
+        std::copy_n(drawBuffer.begin() + offset, chunkLength, packet->bytes.begin() + 1);
+        packet->length = kWritePacketSize;
+        commitPacket(packet);
     }
 }
 
@@ -474,20 +466,25 @@ void ProductFMC::writeLineToPage(std::vector<std::vector<char>> &page, int line,
 void ProductFMC::clearDisplay() {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageBytesPerLine, ' '));
 
-    std::vector<uint8_t> blankLine = {};
-    blankLine.push_back(0xf2);
-    for (int i = 0; i < ProductFMC::PageCharsPerLine; ++i) {
-        blankLine.push_back(0x42);
-        blankLine.push_back(0x00);
-        blankLine.push_back(' ');
-    }
-
+    // 16 reports of 21 blank white cells cover the 14x24 page.
     for (int i = 0; i < 16; ++i) {
-        writeData(blankLine);
+        WritePacket *packet = reservePacket();
+        if (!packet) {
+            return;
+        }
+
+        packet->bytes[0] = 0xf2;
+        for (size_t j = 1; j + 2 < kWritePacketSize; j += 3) {
+            packet->bytes[j] = 0x42;
+            packet->bytes[j + 1] = 0x00;
+            packet->bytes[j + 2] = ' ';
+        }
+        packet->length = kWritePacketSize;
+        commitPacket(packet);
     }
 }
 
-void ProductFMC::setFont(FontVariant preferredVariant) {
+void ProductFMC::setFont(FontVariant preferredVariant, bool forceUpload) {
     std::string fontPreference = AppState::getInstance()->readPreference("FMCFont", "default");
 
     if (fontPreference == "no_font") {
@@ -502,6 +499,17 @@ void ProductFMC::setFont(FontVariant preferredVariant) {
         shouldLoadDefaultFont = true;
     }
 
+    // Apply the SimAppPro "Screen Layout" for the connected hardware so the 14 display
+    // rows line up with the physical LSK keys. ResizeCellHeight is best-effort: it
+    // no-ops at the authored height (MCDU 29) and leaves `font` untouched if it cannot
+    // parse the structure, so we always send whatever we have.
+    FMCScreenLayout layout = FMCHardwareMapping::ScreenLayoutForHardware(hardwareType);
+    std::string key = fontKey(shouldLoadDefaultFont ? "variant:" + std::to_string((int) preferredVariant) : "file:" + fontPreference, layout.characterHeight, layout.characterWidth, layout.x, layout.y);
+    if (!forceUpload && key == loadedFontKey) {
+        showBackground(FMCBackgroundVariant::BLACK);
+        return;
+    }
+
     std::vector<std::vector<unsigned char>> font = {};
     if (shouldLoadDefaultFont) {
         font = Font::GlyphData(preferredVariant, identifierByte, hardwareType);
@@ -515,16 +523,12 @@ void ProductFMC::setFont(FontVariant preferredVariant) {
         return;
     }
 
-    // Apply the SimAppPro "Screen Layout" for the connected hardware so the 14 display
-    // rows line up with the physical LSK keys. ResizeCellHeight is best-effort: it
-    // no-ops at the authored height (MCDU 29) and leaves `font` untouched if it cannot
-    // parse the structure, so we always send whatever we have.
-    FMCScreenLayout layout = FMCHardwareMapping::ScreenLayoutForHardware(hardwareType);
     Font::ResizeCellHeight(font, layout.characterHeight, layout.characterWidth);
 
     for (auto &fontBytes : font) {
-        writeData(fontBytes);
+        writeData(fontBytes, WriteLane::BULK);
     }
+    loadedFontKey = key;
 
     showBackground(FMCBackgroundVariant::BLACK);
 
@@ -533,6 +537,12 @@ void ProductFMC::setFont(FontVariant preferredVariant) {
 
 void ProductFMC::setScreenLayout(FontVariant variant, unsigned char characterHeight, unsigned char characterWidth, unsigned char x, unsigned char y) {
     preferredFontVariant = variant;
+    std::string key = fontKey("variant:" + std::to_string((int) variant), characterHeight, characterWidth, x, y);
+    if (key == loadedFontKey) {
+        showBackground(FMCBackgroundVariant::BLACK);
+        return;
+    }
+
     std::vector<std::vector<unsigned char>> font = Font::GlyphData(variant, identifierByte, hardwareType);
     if (font.empty()) {
         Logger::getInstance()->critical("setScreenLayout: failed to load font data\n");
@@ -544,8 +554,9 @@ void ProductFMC::setScreenLayout(FontVariant variant, unsigned char characterHei
     }
 
     for (auto &fontBytes : font) {
-        writeData(fontBytes);
+        writeData(fontBytes, WriteLane::BULK);
     }
+    loadedFontKey = key;
 
     showBackground(FMCBackgroundVariant::BLACK);
 
@@ -557,14 +568,19 @@ void ProductFMC::setScreenPosition(unsigned char x, unsigned char y) {
     // SAP "Screen Layout Settings" position update: one 0x2a packet carrying the
     // 0x18 text-grid block (25 bytes) + COMMIT (17 bytes) = 42 = 0x2a.
     // left = x + 36, top = y + 20 (verified from SAP captures).
-    std::vector<unsigned char> packet(64, 0);
-    packet[0] = 0xf0;
-    packet[1] = 0x00;
-    packet[2] = 0x00; // sequence (tolerant)
-    packet[3] = 0x2a; // TYPE = 42 meaningful bytes
+    WritePacket *packet = reservePacket(WriteLane::BULK);
+    if (!packet) {
+        return;
+    }
+
+    unsigned char *bytes = packet->bytes.data();
+    bytes[0] = 0xf0;
+    bytes[1] = 0x00;
+    bytes[2] = 0x00; // sequence (tolerant)
+    bytes[3] = 0x2a; // TYPE = 42 meaningful bytes
 
     // 0x18 grid block at payload offset 0 (packet byte 4)
-    unsigned char *p = packet.data() + 4;
+    unsigned char *p = bytes + 4;
     p[ 0] = identifierByte; p[ 1] = 0xbb; p[ 2] = 0x00; p[ 3] = 0x00;
     p[ 4] = 0x18;           p[ 5] = 0x01; p[ 6] = 0x00; p[ 7] = 0x00;
     p[ 8] = 0x00; p[ 9] = 0x00; p[10] = 0x00; p[11] = 0x00; // addr (tolerant = 0)
@@ -575,60 +591,79 @@ void ProductFMC::setScreenPosition(unsigned char x, unsigned char y) {
     p[21] = 0x0e; p[22] = 0x00; p[23] = 0x18; p[24] = 0x00; // 14 cols, 24 rows
 
     // COMMIT block at payload offset 25 (packet byte 29)
-    unsigned char *c = packet.data() + 29;
+    unsigned char *c = bytes + 29;
     c[ 0] = identifierByte; c[ 1] = 0xbb; c[ 2] = 0x00; c[ 3] = 0x00;
     c[ 4] = 0x05;           c[ 5] = 0x01; c[ 6] = 0x00; c[ 7] = 0x00;
     c[ 8] = 0x00; c[ 9] = 0x00; c[10] = 0x00; c[11] = 0x00; // addr
     c[12] = 0x01; c[13] = 0x00; c[14] = 0x00; c[15] = 0x00; c[16] = 0x00;
 
-    writeData(packet);
+    packet->length = kWritePacketSize;
+    commitPacket(packet);
 }
 
 void ProductFMC::showBackground(FMCBackgroundVariant variant) {
-    std::vector<uint8_t> data;
+    // Sequence byte, then the three header bytes that differ per variant.
+    std::array<uint8_t, 4> variantBytes;
 
     switch (variant) {
         case FMCBackgroundVariant::GRAY:
-            data = {0xf0, 0x00, 0x02, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x53, 0x20, 0x07, 0x00};
+            variantBytes = {0x02, 0x53, 0x20, 0x07};
             break;
 
         case FMCBackgroundVariant::BLACK:
-            data = {0xf0, 0x00, 0x03, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0xfd, 0x24, 0x07, 0x00};
+            variantBytes = {0x03, 0xfd, 0x24, 0x07};
             break;
 
         case FMCBackgroundVariant::RED:
-            data = {0xf0, 0x00, 0x04, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x55, 0x29, 0x07, 0x00};
+            variantBytes = {0x04, 0x55, 0x29, 0x07};
             break;
 
         case FMCBackgroundVariant::GREEN:
-            data = {0xf0, 0x00, 0x06, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0xad, 0x95, 0x09, 0x00};
+            variantBytes = {0x06, 0xad, 0x95, 0x09};
             break;
 
         case FMCBackgroundVariant::BLUE:
-            data = {0xf0, 0x00, 0x07, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0xa7, 0x9b, 0x09, 0x00};
+            variantBytes = {0x07, 0xa7, 0x9b, 0x09};
             break;
 
         case FMCBackgroundVariant::YELLOW:
-            data = {0xf0, 0x00, 0x08, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x09, 0xa1, 0x09, 0x00};
+            variantBytes = {0x08, 0x09, 0xa1, 0x09};
             break;
 
         case FMCBackgroundVariant::PURPLE:
-            data = {0xf0, 0x00, 0x09, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x05, 0xa7, 0x09, 0x00};
+            variantBytes = {0x09, 0x05, 0xa7, 0x09};
             break;
 
         case FMCBackgroundVariant::WINCTRL_LOGO:
-            data = {0xf0, 0x00, 0x0a, 0x12, identifierByte, 0xbb, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0xd4, 0xac, 0x09, 0x00};
+            variantBytes = {0x0a, 0xd4, 0xac, 0x09};
             break;
 
         default:
             return;
     }
 
-    std::vector<uint8_t> extra = {
-        0x00, 0x01, 0x00, 0x00, 0x00, static_cast<uint8_t>(0x0c + (int) variant), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    data.insert(data.end(), extra.begin(), extra.end());
+    WritePacket *packet = reservePacket(WriteLane::BULK);
+    if (!packet) {
+        return;
+    }
 
-    writeData(data);
+    // Slots come zeroed; only the non-zero bytes are written.
+    unsigned char *bytes = packet->bytes.data();
+    bytes[0] = 0xf0;
+    bytes[2] = variantBytes[0];
+    bytes[3] = 0x12;
+    bytes[4] = identifierByte;
+    bytes[5] = 0xbb;
+    bytes[8] = 0x04;
+    bytes[9] = 0x01;
+    bytes[12] = variantBytes[1];
+    bytes[13] = variantBytes[2];
+    bytes[14] = variantBytes[3];
+    bytes[17] = 0x01;
+    bytes[21] = static_cast<uint8_t>(0x0c + (int) variant);
+
+    packet->length = kWritePacketSize;
+    commitPacket(packet);
 }
 
 void ProductFMC::setAllLedsEnabled(bool enable) {
@@ -655,7 +690,13 @@ void ProductFMC::setLedBrightness(FMCLed led, uint8_t brightness) {
         return;
     }
 
-    writeData({0x02, identifierByte, 0xbb, 0x00, 0x00, 0x03, 0x49, led, brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    auto it = lastLedBrightness.find(led);
+    if (it != lastLedBrightness.end() && it->second == brightness) {
+        return;
+    }
+    lastLedBrightness[led] = brightness;
+
+    writeData({0x02, identifierByte, 0xbb, 0x00, 0x00, 0x03, 0x49, led, brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(identifierByte, 0xbb, led));
 }
 
 void ProductFMC::setDeviceVariant(FMCDeviceVariant variant) {
@@ -695,7 +736,7 @@ void ProductFMC::reloadFontsMenu() {
                 PluginsMenu::getInstance()->uncheckSubmenuSiblings(itemId);
                 PluginsMenu::getInstance()->setItemChecked(itemId, true);
 
-                setFont(preferredFontVariant);
+                setFont(preferredFontVariant, true);
                 updatePage(true);
             },
         },
@@ -741,7 +782,7 @@ void ProductFMC::reloadFontsMenu() {
                         PluginsMenu::getInstance()->uncheckSubmenuSiblings(itemId);
                         PluginsMenu::getInstance()->setItemChecked(itemId, true);
 
-                        setFont(preferredFontVariant);
+                        setFont(preferredFontVariant, true);
                         updatePage(true);
                     },
                 });
@@ -1,26 +1,34 @@
 #ifndef PRODUCT_FMC_H
 #define PRODUCT_FMC_H
 
+#include "dataref.h"
 #include "fmc-aircraft-profile.h"
 #include "font.h"
 #include "usbdevice.h"
 
 #include <chrono>
 #include <map>
-#include <set>
+#include <string>
+#include <unordered_map>
 
 class ProductFMC : public USBDevice {
     private:
         FMCAircraftProfile *profile;
         std::vector<std::vector<char>> page;
-        int lastUpdateCycle;
-        int displayUpdateFrameCounter = 0;
-        std::set<int> pressedButtonIndices;
+        DatarefSubscription displaySubscription;
+        uint64_t profileMatchGeneration = 0;
+        ButtonStates pressedButtonIndices;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
         int menuItemId;
         int fontsMenuItemId;
         FontVariant preferredFontVariant = FontVariant::Default;
+        std::unordered_map<int, uint8_t> lastLedBrightness;
+        // Glyph set and screen layout currently on the device; setFont and
+        // setScreenLayout skip the upload when it would not change anything.
+        std::string loadedFontKey;
+        // Encoded page of the last draw(), kept so redraws reuse its storage.
+        std::vector<uint8_t> drawBuffer;
 
         void draw(const std::vector<std::vector<char>> *pagePtr = nullptr);
         std::pair<uint8_t, uint8_t> dataFromColFont(char color, bool fontSmall = false);
@@ -48,7 +56,8 @@ class ProductFMC : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
-        void unloadProfile();
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void updatePage(bool forceUpdate = false);
@@ -57,7 +66,7 @@ class ProductFMC : public USBDevice {
 
         char getPageCharacter(std::vector<std::vector<char>> &page, int line, int pos);
         void writeLineToPage(std::vector<std::vector<char>> &page, int line, int pos, const std::string &text, char color, bool fontSmall = false);
-        void setFont(FontVariant preferredVariant);
+        void setFont(FontVariant preferredVariant, bool forceUpload = false);
 
         // Apply the SimAppPro "Screen Layout Settings" as one unit: Character Size
         // (width x height of each character) plus Screen Position (top-left x/y). Used
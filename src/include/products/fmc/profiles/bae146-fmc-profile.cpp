@@ -1,5 +1,6 @@
 #include "bae146-fmc-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-fmc.h"
@@ -48,12 +49,12 @@ BAE146FMCProfile::BAE146FMCProfile(ProductFMC *product) : FMCAircraftProfile(pro
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, screens);
         product->setLedBrightness(FMCLed::OVERALL_LEDS_BRIGHTNESS, screens);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // EXEC annunciator. The BAe 146 has a single FMC, so drive the light from the
     // pilot exec flag regardless of the connected device variant.
@@ -68,7 +69,7 @@ BAE146FMCProfile::BAE146FMCProfile(ProductFMC *product) : FMCAircraftProfile(pro
 }
 
 bool BAE146FMCProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
     // JF BAe 146: -100 = B461, -200 = B462, -300 = B463. Also require the FJCC
     // UFMC to be loaded so we never claim another B46x airframe.
     return icao.starts_with("B46") && Dataref::getInstance()->exists((kPrefix + "LINE_1").c_str());
@@ -224,7 +225,11 @@ void BAE146FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
+    const auto &refs = displayDatarefs();
+    const auto &ids = displayDatarefIds();
+    std::string text;
+    for (size_t index = 0; index < refs.size(); ++index) {
+        const std::string &ref = refs[index];
         std::smatch match;
         if (!std::regex_match(ref, match, datarefRegex)) {
             continue;
@@ -237,7 +242,7 @@ void BAE146FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             continue;
         }
 
-        std::string text = datarefManager->getCached<std::string>(ref.c_str());
+        text.assign(datarefManager->getCachedString(ids[index]));
         if (text.empty()) {
             continue;
         }
@@ -10,13 +10,15 @@
 #include <iomanip>
 #include <sstream>
 
+static constexpr int kScreenLines = 15; // text_line0..text_line14; line 14 is a message line we don't draw
+
 CL650FMCProfile::CL650FMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
 
     auto font = Font::GlyphData("CL650.xpwwf", product->identifierByte, product->hardwareType);
     if (!font.empty()) {
         for (auto &packet : font) {
-            product->writeData(packet);
+            product->writeData(packet, WriteLane::BULK);
         }
     } else {
         product->setFont(FontVariant::FontAirbus);
@@ -28,11 +30,13 @@ CL650FMCProfile::CL650FMCProfile(ProductFMC *product) : FMCAircraftProfile(produ
 
     Dataref::getInstance()->monitorExistingDataref<float>(screenBrtRef.c_str(), [product](float val) {
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, static_cast<uint8_t>(std::clamp(val, 0.0f, 1.0f) * 255));
-    });
+    },
+        nullptr, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>(brtRef.c_str(), [product](float val) {
         product->setLedBrightness(FMCLed::BACKLIGHT, static_cast<uint8_t>(std::clamp(val, 0.0f, 1.0f) * 255));
-    });
+    },
+        nullptr, DatarefPollRate::HZ_5);
 
 #ifdef DEBUG
     Dataref::getInstance()->createCommand(
@@ -90,13 +94,14 @@ const std::vector<std::string> &CL650FMCProfile::displayDatarefs() const {
     auto it = cache.find(product->deviceVariant);
     if (it == cache.end()) {
         const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "1" : "2";
-        std::vector<std::string> refs;
+        std::vector<std::string> refs = lineRefs(
+            kScreenLines, [&cdu](int line) {
+                return "CL650/CDU/" + cdu + "/screen/text_line" + std::to_string(line);
+            },
+            [&cdu](int line) {
+                return "CL650/CDU/" + cdu + "/screen/style_line" + std::to_string(line);
+            });
         refs.push_back("CL650/CDU/" + cdu + "/screen/brt");
-        static constexpr int ScreenLines = 15;
-        for (int i = 0; i < ScreenLines; ++i) {
-            refs.push_back("CL650/CDU/" + cdu + "/screen/text_line" + std::to_string(i));
-            refs.push_back("CL650/CDU/" + cdu + "/screen/style_line" + std::to_string(i));
-        }
         it = cache.emplace(product->deviceVariant, std::move(refs)).first;
     }
     return it->second;
@@ -290,7 +295,6 @@ void CL650FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "1" : "2";
 
     // Replace unicode symbols with single-byte placeholders
     const std::vector<std::pair<std::string, unsigned char>> symbols = {
@@ -349,19 +353,16 @@ void CL650FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
         {"\u27E7", ']'},  // ⟧
     };
 
-    static constexpr int ScreenLines = 14; // text_line0..text_line13; line 14 is a message line we skip
-
-    for (int lineNum = 0; lineNum < ScreenLines; ++lineNum) {
-        std::string textDataref = "CL650/CDU/" + cdu + "/screen/text_line" + std::to_string(lineNum);
-        std::string styleDataref = "CL650/CDU/" + cdu + "/screen/style_line" + std::to_string(lineNum);
-
-        std::string text = datarefManager->getCached<std::string>(textDataref.c_str());
+    std::string text;
+    for (int lineNum = 0; lineNum < kScreenLines - 1; ++lineNum) {
+        auto [textRef, styleRef] = lineIds(lineNum);
+        text.assign(datarefManager->getCachedString(textRef));
         if (text.empty()) {
             continue;
         }
 
         // style_lineN displayed as int[24] in DataRefEditor but stored as byte array
-        std::vector<unsigned char> styleBytes = datarefManager->getCached<std::vector<unsigned char>>(styleDataref.c_str());
+        std::span<const unsigned char> styleBytes = datarefManager->getCachedArray<unsigned char>(styleRef);
 
         // Replace unicode symbols with single-byte placeholders
         for (const auto &symbol : symbols) {
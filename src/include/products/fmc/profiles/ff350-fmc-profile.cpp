@@ -41,9 +41,9 @@ FF350FMCProfile::FF350FMCProfile(ProductFMC *product) : TolissFMCProfile(product
     // Re-evaluate the backlight when the knob moves or when bus power toggles, so
     // the panel comes up at the current knob setting on power-up rather than only
     // after the knob is next touched.
-    datarefManager->monitorExistingDataref<float>(kBrightnessDataref, [applyScreenBrightness](float) { applyScreenBrightness(); }, this);
-    datarefManager->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [applyScreenBrightness](bool) { applyScreenBrightness(); }, this);
-    datarefManager->monitorExistingDataref<bool>("sim/cockpit2/radios/actuators/com1_power", [applyScreenBrightness](bool) { applyScreenBrightness(); }, this);
+    datarefManager->monitorExistingDataref<float>(kBrightnessDataref, [applyScreenBrightness](float) { applyScreenBrightness(); }, this, DatarefPollRate::HZ_5);
+    datarefManager->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [applyScreenBrightness](bool) { applyScreenBrightness(); }, this, DatarefPollRate::HZ_1);
+    datarefManager->monitorExistingDataref<bool>("sim/cockpit2/radios/actuators/com1_power", [applyScreenBrightness](bool) { applyScreenBrightness(); }, this, DatarefPollRate::HZ_1);
 }
 
 bool FF350FMCProfile::IsEligible() {
@@ -1,5 +1,6 @@
 #include "ff767-fmc-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-fmc.h"
@@ -13,7 +14,17 @@
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
 
+// Names are relative to the CDU, see displayDatarefs().
+const DisplayRef<FlightFactor767FMCProfile::DisplayRefs> FlightFactor767FMCProfile::displayRefTable[] = {
+    {"/display/symbols", &DisplayRefs::symbols},               // 336 letters
+    {"/display/symbolsColor", &DisplayRefs::symbolsColor},     // 336 numbers
+    {"/display/symbolsEffects", &DisplayRefs::symbolsEffects}, // 336 numbers
+    {"/display/symbolsSize", &DisplayRefs::symbolsSize},       // 336 numbers
+};
+
 FlightFactor767FMCProfile::FlightFactor767FMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     product->setAllLedsEnabled(false);
     product->setFont(FontVariant::Font737);
 
@@ -22,17 +33,17 @@ FlightFactor767FMCProfile::FlightFactor767FMCProfile(ProductFMC *product) : FMCA
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/instrument_brightness");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool FlightFactor767FMCProfile::IsEligible() {
-    const std::string author = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_author");
-    const std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &author = AircraftIdentity::getInstance()->getAuthor();
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
 
     if (!author.starts_with("FlightFactor")) {
         return false;
@@ -47,14 +58,14 @@ const std::vector<std::string> &FlightFactor767FMCProfile::displayDatarefs() con
     const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "cduL" : "cduR";
     static std::unordered_map<FMCDeviceVariant, std::vector<std::string>> cache;
 
-    return cache.try_emplace(product->deviceVariant,
-                    std::vector<std::string>{
-                        "1-sim/" + cdu + "/display/symbols",        // 336 letters
-                        "1-sim/" + cdu + "/display/symbolsColor",   // 336 numbers
-                        "1-sim/" + cdu + "/display/symbolsEffects", // 336 numbers
-                        "1-sim/" + cdu + "/display/symbolsSize"     // 336 numbers
-                    })
-        .first->second;
+    auto it = cache.find(product->deviceVariant);
+    if (it == cache.end()) {
+        std::vector<std::string> refs = displayRefNames(displayRefTable, [&cdu](const char *name) {
+            return "1-sim/" + cdu + name;
+        });
+        it = cache.emplace(product->deviceVariant, std::move(refs)).first;
+    }
+    return it->second;
 }
 
 const std::vector<FMCButtonDef> &FlightFactor767FMCProfile::buttonDefs() const {
@@ -195,11 +206,10 @@ void FlightFactor767FMCProfile::updatePage(std::vector<std::vector<char>> &page)
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "cduL" : "cduR";
-    std::vector<unsigned char> symbols = datarefManager->getCached<std::vector<unsigned char>>(("1-sim/" + cdu + "/display/symbols").c_str());
-    std::vector<int> colors = datarefManager->getCached<std::vector<int>>(("1-sim/" + cdu + "/display/symbolsColor").c_str());
-    std::vector<int> sizes = datarefManager->getCached<std::vector<int>>(("1-sim/" + cdu + "/display/symbolsSize").c_str());
-    std::vector<int> effects = datarefManager->getCached<std::vector<int>>(("1-sim/" + cdu + "/display/symbolsEffects").c_str());
+    std::span<const unsigned char> symbols = datarefManager->getCachedArray<unsigned char>(displayRefs.symbols);
+    std::span<const int> colors = datarefManager->getCachedArray<int>(displayRefs.symbolsColor);
+    std::span<const int> sizes = datarefManager->getCachedArray<int>(displayRefs.symbolsSize);
+    std::span<const int> effects = datarefManager->getCachedArray<int>(displayRefs.symbolsEffects);
 
     if (symbols.size() < FlightFactor767FMCProfile::DataLength || colors.size() < FlightFactor767FMCProfile::DataLength || sizes.size() < FlightFactor767FMCProfile::DataLength || effects.size() < FlightFactor767FMCProfile::DataLength) {
         return;
@@ -10,6 +10,14 @@ class FlightFactor767FMCProfile : public FMCAircraftProfile {
         static std::vector<std::string> datarefsList;
         static std::vector<FMCButtonDef> buttonsList;
         static std::map<char, int> colors;
+        struct DisplayRefs {
+                DatarefId symbols;
+                DatarefId symbolsColor;
+                DatarefId symbolsEffects;
+                DatarefId symbolsSize;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FlightFactor767FMCProfile(ProductFMC *product);
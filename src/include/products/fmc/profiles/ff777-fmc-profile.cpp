@@ -8,7 +8,17 @@
 #include <cmath>
 #include <cstring>
 
+// Names are relative to the CDU, see displayDatarefs().
+const DisplayRef<FlightFactor777FMCProfile::DisplayRefs> FlightFactor777FMCProfile::displayRefTable[] = {
+    {"/display/symbols", &DisplayRefs::symbols},               // 336 letters
+    {"/display/symbolsColor", &DisplayRefs::symbolsColor},     // 336 numbers
+    {"/display/symbolsEffects", &DisplayRefs::symbolsEffects}, // 336 numbers
+    {"/display/symbolsSize", &DisplayRefs::symbolsSize},       // 336 numbers
+};
+
 FlightFactor777FMCProfile::FlightFactor777FMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     product->setAllLedsEnabled(false);
     product->setFont(FontVariant::Font737);
 
@@ -17,36 +27,36 @@ FlightFactor777FMCProfile::FlightFactor777FMCProfile(ProductFMC *product) : FMCA
         uint8_t target = Dataref::getInstance()->get<bool>(("1-sim/" + cdu + "/ok").c_str()) ? brightness * 255 : 0;
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/lights/aisle", [product, cdu](float brightness) {
         uint8_t target = Dataref::getInstance()->get<bool>(("1-sim/" + cdu + "/ok").c_str()) ? brightness * 255 : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>(("1-sim/" + cdu + "/ok").c_str(), [cdu](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref(("1-sim/" + cdu + "/brt").c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lights/aisle");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lamps/cduCptAct", [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_EXEC, enabled ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_STATUS, enabled ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lamps/cduCptMSG", [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_MSG, enabled ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_MCDU, enabled ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/ckpt/lamps/cduCptOFST", [product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_OFST, enabled ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool FlightFactor777FMCProfile::IsEligible() {
@@ -57,14 +67,14 @@ const std::vector<std::string> &FlightFactor777FMCProfile::displayDatarefs() con
     const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "cduL" : (product->deviceVariant == FMCDeviceVariant::VARIANT_FIRSTOFFICER ? "cduR" : "cduC");
     static std::unordered_map<FMCDeviceVariant, std::vector<std::string>> cache;
 
-    return cache.try_emplace(product->deviceVariant,
-                    std::vector<std::string>{
-                        "1-sim/" + cdu + "/display/symbols",        // 336 letters
-                        "1-sim/" + cdu + "/display/symbolsColor",   // 336 numbers
-                        "1-sim/" + cdu + "/display/symbolsEffects", // 336 numbers
-                        "1-sim/" + cdu + "/display/symbolsSize"     // 336 numbers
-                    })
-        .first->second;
+    auto it = cache.find(product->deviceVariant);
+    if (it == cache.end()) {
+        std::vector<std::string> refs = displayRefNames(displayRefTable, [&cdu](const char *name) {
+            return "1-sim/" + cdu + name;
+        });
+        it = cache.emplace(product->deviceVariant, std::move(refs)).first;
+    }
+    return it->second;
 }
 
 const std::vector<FMCButtonDef> &FlightFactor777FMCProfile::buttonDefs() const {
@@ -206,11 +216,10 @@ void FlightFactor777FMCProfile::updatePage(std::vector<std::vector<char>> &page)
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "cduL" : (product->deviceVariant == FMCDeviceVariant::VARIANT_FIRSTOFFICER ? "cduR" : "cduC");
-    std::vector<unsigned char> symbols = datarefManager->getCached<std::vector<unsigned char>>(("1-sim/" + cdu + "/display/symbols").c_str());
-    std::vector<int> colors = datarefManager->getCached<std::vector<int>>(("1-sim/" + cdu + "/display/symbolsColor").c_str());
-    std::vector<int> sizes = datarefManager->getCached<std::vector<int>>(("1-sim/" + cdu + "/display/symbolsSize").c_str());
-    std::vector<int> effects = datarefManager->getCached<std::vector<int>>(("1-sim/" + cdu + "/display/symbolsEffects").c_str());
+    std::span<const unsigned char> symbols = datarefManager->getCachedArray<unsigned char>(displayRefs.symbols);
+    std::span<const int> colors = datarefManager->getCachedArray<int>(displayRefs.symbolsColor);
+    std::span<const int> sizes = datarefManager->getCachedArray<int>(displayRefs.symbolsSize);
+    std::span<const int> effects = datarefManager->getCachedArray<int>(displayRefs.symbolsEffects);
 
     if (symbols.size() < FlightFactor777FMCProfile::DataLength || colors.size() < FlightFactor777FMCProfile::DataLength || sizes.size() < FlightFactor777FMCProfile::DataLength || effects.size() < FlightFactor777FMCProfile::DataLength) {
         return;
@@ -8,6 +8,14 @@ class FlightFactor777FMCProfile : public FMCAircraftProfile {
         static std::vector<std::string> datarefsList;
         static std::vector<FMCButtonDef> buttonsList;
         static std::map<char, int> colors;
+        struct DisplayRefs {
+                DatarefId symbols;
+                DatarefId symbolsColor;
+                DatarefId symbolsEffects;
+                DatarefId symbolsSize;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FlightFactor777FMCProfile(ProductFMC *product);
@@ -23,12 +23,12 @@ FPS748FMCProfile::FPS748FMCProfile(ProductFMC *product) : FMCAircraftProfile(pro
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>((alternatePrefix + "/Elec/bus_1_powered").c_str(), [alternatePrefix](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref((alternatePrefix + "/LGT/mcdu_brt_sw").c_str());
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>((prefix + "/UFMC/Exec_Light_on_Pilot").c_str(), [product](bool enabled) {
         if (product->deviceVariant != FMCDeviceVariant::VARIANT_CAPTAIN) {
@@ -230,7 +230,11 @@ void FPS748FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
+    const auto &refs = displayDatarefs();
+    const auto &ids = displayDatarefIds();
+    std::string text;
+    for (size_t index = 0; index < refs.size(); ++index) {
+        const std::string &ref = refs[index];
         std::smatch match;
         if (!std::regex_match(ref, match, datarefRegex)) {
             continue;
@@ -243,7 +247,7 @@ void FPS748FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
             continue;
         }
 
-        std::string text = datarefManager->getCached<std::string>(ref.c_str());
+        text.assign(datarefManager->getCachedString(ids[index]));
         if (text.empty()) {
             continue;
         }
@@ -21,12 +21,12 @@ IXEG733FMCProfile::IXEG733FMCProfile(ProductFMC *product) : FMCAircraftProfile(p
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("ixeg/733/rheostats/light_fmc_pt_act");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool IXEG733FMCProfile::IsEligible() {
@@ -200,7 +200,7 @@ void IXEG733FMCProfile::mapCharacter(std::vector<uint8_t> *buffer, uint8_t chara
     }
 }
 
-std::pair<std::string, std::vector<char>> IXEG733FMCProfile::processIxegText(const std::vector<unsigned char> &characters) {
+std::pair<std::string, std::vector<char>> IXEG733FMCProfile::processIxegText(std::span<const unsigned char> characters) {
     std::string text;
     std::vector<char> colors;
 
@@ -254,8 +254,11 @@ void IXEG733FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
-        std::vector<unsigned char> characters = datarefManager->getCached<std::vector<unsigned char>>(ref.c_str());
+    const auto &refs = displayDatarefs();
+    const auto &ids = displayDatarefIds();
+    for (size_t index = 0; index < refs.size(); ++index) {
+        const std::string &ref = refs[index];
+        std::span<const unsigned char> characters = datarefManager->getCachedArray<unsigned char>(ids[index]);
         if (characters.empty()) {
             continue;
         }
@@ -7,7 +7,7 @@
 
 class IXEG733FMCProfile : public FMCAircraftProfile {
     private:
-        std::pair<std::string, std::vector<char>> processIxegText(const std::vector<unsigned char> &characters);
+        std::pair<std::string, std::vector<char>> processIxegText(std::span<const unsigned char> characters);
 
     public:
         IXEG733FMCProfile(ProductFMC *product);
@@ -8,6 +8,8 @@
 #include <cstring>
 #include <limits>
 
+static constexpr int kScreenLines = 14; // fms_cdu1_text_line0..13
+
 JAR330FMCProfile::JAR330FMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
     product->setFont(FontVariant::FontAirbus);
@@ -22,12 +24,12 @@ JAR330FMCProfile::JAR330FMCProfile(ProductFMC *product) : FMCAircraftProfile(pro
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     product->setLedBrightness(FMCLed::BACKLIGHT, 128);
     product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
@@ -38,41 +40,16 @@ bool JAR330FMCProfile::IsEligible() {
 }
 
 const std::vector<std::string> &JAR330FMCProfile::displayDatarefs() const {
-    static std::unordered_map<FMCDeviceVariant, std::vector<std::string>> cache;
-
-    return cache.try_emplace(FMCDeviceVariant::VARIANT_CAPTAIN,
-                    std::vector<std::string>{
-                        // Standard X-Plane FMS datarefs: 14 lines of text + style
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line0",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line1",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line2",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line3",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line4",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line5",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line6",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line7",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line8",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line9",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line10",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line11",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line12",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line13",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line0",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line1",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line2",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line3",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line4",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line5",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line6",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line7",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line8",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line9",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line10",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line11",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line12",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_style_line13",
-                    })
-        .first->second;
+    // Standard X-Plane FMS datarefs: 14 lines of text + style
+    static const std::vector<std::string> datarefs = lineRefs(
+        kScreenLines, [](int line) {
+            return "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(line);
+        },
+        [](int line) {
+            return "sim/cockpit2/radios/indicators/fms_cdu1_style_line" + std::to_string(line);
+        });
+
+    return datarefs;
 }
 
 const std::vector<FMCButtonDef> &JAR330FMCProfile::buttonDefs() const {
@@ -248,16 +225,15 @@ void JAR330FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     auto datarefManager = Dataref::getInstance();
 
     // Standard X-Plane FMS datarefs
-    for (int lineNum = 0; lineNum < 14; ++lineNum) {
-        std::string textDataref = "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(lineNum);
-        std::string styleDataref = "sim/cockpit2/radios/indicators/fms_cdu1_style_line" + std::to_string(lineNum);
-
-        std::string text = datarefManager->getCached<std::string>(textDataref.c_str());
+    std::string text;
+    for (int lineNum = 0; lineNum < kScreenLines; ++lineNum) {
+        auto [textRef, styleRef] = lineIds(lineNum);
+        text.assign(datarefManager->getCachedString(textRef));
         if (text.empty()) {
             continue;
         }
 
-        std::vector<unsigned char> styleBytes = datarefManager->getCached<std::vector<unsigned char>>(styleDataref.c_str());
+        std::span<const unsigned char> styleBytes = datarefManager->getCachedArray<unsigned char>(styleRef);
 
         // Replace all special characters with placeholders
         const std::vector<std::pair<std::string, unsigned char>> symbols = {
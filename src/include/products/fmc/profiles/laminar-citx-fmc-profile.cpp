@@ -7,6 +7,8 @@
 #include <cmath>
 #include <cstring>
 
+static constexpr int kScreenLines = 16; // fms_cdu1_text_line0..15
+
 LaminarCitXFMCProfile::LaminarCitXFMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
     product->setFont(FontVariant::Default);
@@ -20,12 +22,12 @@ LaminarCitXFMCProfile::LaminarCitXFMCProfile(ProductFMC *product) : FMCAircraftP
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     product->setLedBrightness(FMCLed::BACKLIGHT, 128);
     product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
@@ -36,28 +38,16 @@ bool LaminarCitXFMCProfile::IsEligible() {
 }
 
 const std::vector<std::string> &LaminarCitXFMCProfile::displayDatarefs() const {
-    static std::unordered_map<FMCDeviceVariant, std::vector<std::string>> cache;
-
-    return cache.try_emplace(FMCDeviceVariant::VARIANT_CAPTAIN,
-                    std::vector<std::string>{
-                        // Text content for lines 0-15
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line0",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line1",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line2",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line3",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line4",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line5",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line6",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line7",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line8",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line9",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line10",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line11",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line12",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line13",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line14",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line15"})
-        .first->second;
+    // Text and style for lines 0-15
+    static const std::vector<std::string> datarefs = lineRefs(
+        kScreenLines, [](int line) {
+            return "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(line);
+        },
+        [](int line) {
+            return "sim/cockpit2/radios/indicators/fms_cdu1_style_line" + std::to_string(line);
+        });
+
+    return datarefs;
 }
 
 const std::vector<FMCButtonDef> &LaminarCitXFMCProfile::buttonDefs() const {
@@ -219,16 +209,15 @@ void LaminarCitXFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    for (int lineNum = 0; lineNum < std::min(ProductFMC::PageLines, (unsigned int) 16); ++lineNum) {
-        std::string textDataref = "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(lineNum);
-        std::string styleDataref = "sim/cockpit2/radios/indicators/fms_cdu1_style_line" + std::to_string(lineNum);
-
-        std::string text = datarefManager->getCached<std::string>(textDataref.c_str());
+    std::string text;
+    for (int lineNum = 0; lineNum < std::min(static_cast<int>(ProductFMC::PageLines), kScreenLines); ++lineNum) {
+        auto [textRef, styleRef] = lineIds(lineNum);
+        text.assign(datarefManager->getCachedString(textRef));
         if (text.empty()) {
             continue;
         }
 
-        std::vector<unsigned char> styleBytes = datarefManager->getCached<std::vector<unsigned char>>(styleDataref.c_str());
+        std::span<const unsigned char> styleBytes = datarefManager->getCachedArray<unsigned char>(styleRef);
 
         // Replace all special characters with placeholders
         const std::vector<std::pair<std::string, unsigned char>> symbols = {
@@ -1,5 +1,6 @@
 #include "pa28-fmc-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-fmc.h"
@@ -31,19 +32,19 @@ PA28FMCProfile::PA28FMCProfile(ProductFMC *product) : FMCAircraftProfile(product
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, screens);
         product->setLedBrightness(FMCLed::OVERALL_LEDS_BRIGHTNESS, screens);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Logger::getInstance()->info("FMC: PA28 profile active\n");
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
 }
 
 bool PA28FMCProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
     return icao.starts_with("P28");
 }
 
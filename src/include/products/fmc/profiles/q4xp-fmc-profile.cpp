@@ -9,6 +9,8 @@
 #include <cstring>
 #include <sstream>
 
+static constexpr int kScreenLines = 11;
+
 Q4XPFMCProfile::Q4XPFMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
 
@@ -20,12 +22,12 @@ Q4XPFMCProfile::Q4XPFMCProfile(ProductFMC *product) : FMCAircraftProfile(product
         uint8_t target = static_cast<uint8_t>(std::clamp(brightness[2], 0.0f, 1.0f) * 255);
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     auto font = Font::GlyphData("Q4XP.xpwwf", product->identifierByte, product->hardwareType);
     if (!font.empty()) {
         for (auto &packet : font) {
-            product->writeData(packet);
+            product->writeData(packet, WriteLane::BULK);
         }
     } else {
         product->setFont(FontVariant::Default);
@@ -45,12 +47,13 @@ const std::vector<std::string> &Q4XPFMCProfile::displayDatarefs() const {
     auto it = cache.find(product->deviceVariant);
     if (it == cache.end()) {
         const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "cdu1" : "cdu2";
-        std::vector<std::string> refs;
-        static constexpr int ScreenLines = 11;
-        for (int i = 0; i < ScreenLines; ++i) {
-            refs.push_back("FJS/Q4XP/" + cdu + "/text_line_" + std::to_string(i));
-            refs.push_back("FJS/Q4XP/" + cdu + "/style_line_" + std::to_string(i));
-        }
+        std::vector<std::string> refs = lineRefs(
+            kScreenLines, [&cdu](int line) {
+                return "FJS/Q4XP/" + cdu + "/text_line_" + std::to_string(line);
+            },
+            [&cdu](int line) {
+                return "FJS/Q4XP/" + cdu + "/style_line_" + std::to_string(line);
+            });
         it = cache.emplace(product->deviceVariant, std::move(refs)).first;
     }
     return it->second;
@@ -244,7 +247,6 @@ void Q4XPFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    const std::string cdu = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "cdu1" : "cdu2";
 
     // Replace unicode symbols with single-byte placeholders
     const std::vector<std::pair<std::string, unsigned char>> symbols = {
@@ -261,18 +263,15 @@ void Q4XPFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
         {"\u27E6", '['},  {"\u27E7", ']'},
     };
 
-    static constexpr int ScreenLines = 11;
-
-    for (int lineNum = 0; lineNum < ScreenLines; ++lineNum) {
-        std::string textDataref = "FJS/Q4XP/" + cdu + "/text_line_" + std::to_string(lineNum);
-        std::string styleDataref = "FJS/Q4XP/" + cdu + "/style_line_" + std::to_string(lineNum);
-
-        std::string text = datarefManager->getCached<std::string>(textDataref.c_str());
+    std::string text;
+    for (int lineNum = 0; lineNum < kScreenLines; ++lineNum) {
+        auto [textRef, styleRef] = lineIds(lineNum);
+        text.assign(datarefManager->getCachedString(textRef));
         if (text.empty()) {
             continue;
         }
 
-        std::vector<unsigned char> styleBytes = datarefManager->getCached<std::vector<unsigned char>>(styleDataref.c_str());
+        std::span<const unsigned char> styleBytes = datarefManager->getCachedArray<unsigned char>(styleRef);
 
         for (const auto &symbol : symbols) {
             size_t pos = 0;
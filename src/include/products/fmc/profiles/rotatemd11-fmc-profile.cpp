@@ -25,7 +25,7 @@ RotateMD11FMCProfile::RotateMD11FMCProfile(ProductFMC *product) : FMCAircraftPro
         uint8_t target = hasPower ? static_cast<uint8_t>(brightness * 255) : 0;
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>("Rotate/aircraft/controls/instr_panel_lts", [product](float brightness) {
         bool hasPower = Dataref::getInstance()->get<bool>("Rotate/aircraft/systems/elec_ac_bus_1_pwrd") ||
@@ -33,41 +33,41 @@ RotateMD11FMCProfile::RotateMD11FMCProfile(ProductFMC *product) : FMCAircraftPro
         uint8_t target = hasPower ? static_cast<uint8_t>(brightness * 255) : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // Monitor both power buses and re-trigger brightness callbacks when either changes
     Dataref::getInstance()->monitorExistingDataref<bool>("Rotate/aircraft/systems/elec_ac_bus_1_pwrd", [brtDataref](bool) {
         Dataref::getInstance()->executeChangedCallbacksForDataref(brtDataref.c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/controls/instr_panel_lts");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("Rotate/aircraft/systems/elec_emer_ac_bus_l_pwrd", [brtDataref](bool) {
         Dataref::getInstance()->executeChangedCallbacksForDataref(brtDataref.c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/controls/instr_panel_lts");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<int>>("Rotate/aircraft/systems/mcdu_msg_lt", [product, idx](const std::vector<int> &lights) {
         bool on = idx < static_cast<int>(lights.size()) && lights[idx] > 0;
         product->setLedBrightness(FMCLed::PFP_MSG, on ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_MCDU, on ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<int>>("Rotate/aircraft/systems/mcdu_dspy_lt", [product, idx](const std::vector<int> &lights) {
         bool on = idx < static_cast<int>(lights.size()) && lights[idx] > 0;
         product->setLedBrightness(FMCLed::PFP_CALL_DISPLAY, on ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_IND, on ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<int>>("Rotate/aircraft/systems/mcdu_fail_lt", [product, idx](const std::vector<int> &lights) {
         bool on = idx < static_cast<int>(lights.size()) && lights[idx] > 0;
         product->setLedBrightness(FMCLed::MCDU_FAIL, on ? 1 : 0);
         product->setLedBrightness(FMCLed::PFP_FAIL, on ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // OFST light
     Dataref::getInstance()->monitorExistingDataref<std::vector<int>>("Rotate/aircraft/systems/mcdu_ofst_lt", [product, idx](const std::vector<int> &lights) {
@@ -75,7 +75,7 @@ RotateMD11FMCProfile::RotateMD11FMCProfile(ProductFMC *product) : FMCAircraftPro
         product->setLedBrightness(FMCLed::PFP_OFST, on ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_STATUS, on ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // Trigger initialization
     Dataref::getInstance()->executeChangedCallbacksForDataref(brtDataref.c_str());
@@ -100,38 +100,18 @@ const std::vector<std::string> &RotateMD11FMCProfile::displayDatarefs() const {
                                                                                                                                                   : "cdu_0";
     static std::unordered_map<FMCDeviceVariant, std::vector<std::string>> cache;
 
-    return cache.try_emplace(product->deviceVariant,
-                    std::vector<std::string>{
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_0_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_0_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_1_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_1_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_2_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_2_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_3_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_3_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_4_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_4_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_5_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_5_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_6_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_6_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_7_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_7_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_8_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_8_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_9_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_9_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_10_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_10_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_11_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_11_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_12_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_12_style",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_13_content",
-                        "Rotate/aircraft/controls/" + cdu + "/mcdu_line_13_style",
-                    })
-        .first->second;
+    auto it = cache.find(product->deviceVariant);
+    if (it == cache.end()) {
+        std::vector<std::string> refs = lineRefs(
+            ProductFMC::PageLines, [&cdu](int line) {
+                return "Rotate/aircraft/controls/" + cdu + "/mcdu_line_" + std::to_string(line) + "_content";
+            },
+            [&cdu](int line) {
+                return "Rotate/aircraft/controls/" + cdu + "/mcdu_line_" + std::to_string(line) + "_style";
+            });
+        it = cache.emplace(product->deviceVariant, std::move(refs)).first;
+    }
+    return it->second;
 }
 
 const std::vector<FMCButtonDef> &RotateMD11FMCProfile::buttonDefs() const {
@@ -278,7 +258,7 @@ const std::map<char, FMCTextColor> &RotateMD11FMCProfile::colorMap() const {
     return colMap;
 }
 
-std::string RotateMD11FMCProfile::processUTF8Arrows(const std::string &input) {
+std::string RotateMD11FMCProfile::processUTF8Arrows(std::string_view input) {
     // Replace UTF-8 arrow sequences with single-byte ASCII codes
     std::string output;
 
@@ -368,22 +348,17 @@ void RotateMD11FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    const std::string cdu =
-        product->deviceVariant == FMCDeviceVariant::VARIANT_FIRSTOFFICER ? "cdu_1" : product->deviceVariant == FMCDeviceVariant::VARIANT_OBSERVER ? "cdu_2"
-                                                                                                                                                  : "cdu_0";
 
     for (int line = 0; line < ProductFMC::PageLines; ++line) {
-        std::string contentRef = "Rotate/aircraft/controls/" + cdu + "/mcdu_line_" + std::to_string(line) + "_content";
-        std::string styleRef = "Rotate/aircraft/controls/" + cdu + "/mcdu_line_" + std::to_string(line) + "_style";
-
-        std::string contentStr = datarefManager->getCached<std::string>(contentRef.c_str());
+        auto [contentRef, styleRef] = lineIds(line);
+        std::string_view contentStr = datarefManager->getCachedString(contentRef);
         if (contentStr.empty()) {
             continue;
         }
 
         std::string processedContent = processUTF8Arrows(contentStr);
 
-        std::vector<unsigned char> styleBytes = datarefManager->getCached<std::vector<unsigned char>>(styleRef.c_str());
+        std::span<const unsigned char> styleBytes = datarefManager->getCachedArray<unsigned char>(styleRef);
 
         for (int pos = 0; pos < ProductFMC::PageCharsPerLine && pos < processedContent.length(); ++pos) {
             unsigned char c = static_cast<unsigned char>(processedContent[pos]);
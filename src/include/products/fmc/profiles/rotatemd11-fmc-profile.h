@@ -5,7 +5,7 @@
 
 class RotateMD11FMCProfile : public FMCAircraftProfile {
     private:
-        std::string processUTF8Arrows(const std::string &input);
+        std::string processUTF8Arrows(std::string_view input);
 
     public:
         RotateMD11FMCProfile(ProductFMC *product);
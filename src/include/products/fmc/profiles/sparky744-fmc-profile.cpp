@@ -16,7 +16,7 @@ SparkyB744FMCProfile::SparkyB744FMCProfile(ProductFMC *product) : FMCAircraftPro
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/radios/indicators/fms_exec_light_pilot", [product](bool lit) {
         if (product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN) {
@@ -53,15 +53,22 @@ const std::vector<std::string> &SparkyB744FMCProfile::displayDatarefs() const {
                           : product->deviceVariant == FMCDeviceVariant::VARIANT_OBSERVER ? "fms1"
                                                                                          : "fms2";
 
-    std::vector<std::string> refs;
-    refs.reserve(28);
-    for (int i = 1; i <= 14; ++i) {
-        char buf[4];
-        snprintf(buf, sizeof(buf), "%02d", i);
-        refs.push_back("laminar/B747/" + fms + "/Line" + buf + "_L");
-        refs.push_back("laminar/B747/" + fms + "/Line" + buf + "_S");
+    auto it = cache.find(product->deviceVariant);
+    if (it == cache.end()) {
+        std::vector<std::string> refs = lineRefs(
+            ProductFMC::PageLines, [&fms](int line) {
+                char buf[4];
+                snprintf(buf, sizeof(buf), "%02d", line + 1);
+                return "laminar/B747/" + fms + "/Line" + buf + "_L";
+            },
+            [&fms](int line) {
+                char buf[4];
+                snprintf(buf, sizeof(buf), "%02d", line + 1);
+                return "laminar/B747/" + fms + "/Line" + buf + "_S";
+            });
+        it = cache.emplace(product->deviceVariant, std::move(refs)).first;
     }
-    return cache.try_emplace(product->deviceVariant, std::move(refs)).first->second;
+    return it->second;
 }
 
 const std::vector<FMCButtonDef> &SparkyB744FMCProfile::buttonDefs() const {
@@ -226,20 +233,13 @@ void SparkyB744FMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto dm = Dataref::getInstance();
-    // Display lines: captain=fms3 (observer FMS), FO=fms2, observer=fms1 — B747 quirk
-    const std::string fms = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN  ? "fms3"
-                          : product->deviceVariant == FMCDeviceVariant::VARIANT_OBSERVER ? "fms1"
-                                                                                         : "fms2";
-    const std::string base = "laminar/B747/" + fms + "/Line";
-
+    std::string text;
     for (int lineNum = 1; lineNum <= (int) ProductFMC::PageLines; ++lineNum) {
-        char buf[4];
-        snprintf(buf, sizeof(buf), "%02d", lineNum);
         int lineIndex = lineNum - 1;
 
+        auto [largeRef, smallRef] = lineIds(lineIndex);
         for (bool fontSmall : {false, true}) {
-            const std::string ref = base + buf + (fontSmall ? "_S" : "_L");
-            std::string text = dm->getCached<std::string>(ref.c_str());
+            text.assign(dm->getCachedString(fontSmall ? smallRef : largeRef));
             if (text.empty()) {
                 continue;
             }
@@ -16,10 +16,10 @@ Strato77WFMCProfile::Strato77WFMCProfile(ProductFMC *product) : FMCAircraftProfi
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // FMC activity (EXEC light) — array: [0]=left, [1]=right, [2]=center
-    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("Strato/777/cdu_fmc_act", [product](std::vector<float> act) {
+    Dataref::getInstance()->monitorExistingDataref<std::span<const float>>("Strato/777/cdu_fmc_act", [product](std::span<const float> act) {
         int idx = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN      ? 0
                 : product->deviceVariant == FMCDeviceVariant::VARIANT_FIRSTOFFICER ? 1
                                                                                    : 2;
@@ -27,7 +27,7 @@ Strato77WFMCProfile::Strato77WFMCProfile(ProductFMC *product) : FMCAircraftProfi
         product->setLedBrightness(FMCLed::PFP_EXEC, active ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_STATUS, active ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool Strato77WFMCProfile::IsEligible() {
@@ -43,14 +43,17 @@ const std::vector<std::string> &Strato77WFMCProfile::displayDatarefs() const {
 
     auto it = cache.find(product->deviceVariant);
     if (it == cache.end()) {
-        std::vector<std::string> refs;
-        refs.reserve(28);
-        for (int i = 1; i <= 14; ++i) {
-            char buf[4];
-            snprintf(buf, sizeof(buf), "%02d", i);
-            refs.push_back("Strato/B777/" + fms + "/Line" + buf + "_L");
-            refs.push_back("Strato/B777/" + fms + "/Line" + buf + "_S");
-        }
+        std::vector<std::string> refs = lineRefs(
+            ProductFMC::PageLines, [&fms](int line) {
+                char buf[4];
+                snprintf(buf, sizeof(buf), "%02d", line + 1);
+                return "Strato/B777/" + fms + "/Line" + buf + "_L";
+            },
+            [&fms](int line) {
+                char buf[4];
+                snprintf(buf, sizeof(buf), "%02d", line + 1);
+                return "Strato/B777/" + fms + "/Line" + buf + "_S";
+            });
         it = cache.emplace(product->deviceVariant, std::move(refs)).first;
     }
     return it->second;
@@ -214,20 +217,13 @@ void Strato77WFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto dm = Dataref::getInstance();
-    // Captain display reads come from fms3, observer from fms1 — same quirk as Sparky744
-    const std::string fms = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN  ? "fms3"
-                          : product->deviceVariant == FMCDeviceVariant::VARIANT_OBSERVER ? "fms1"
-                                                                                         : "fms2";
-    const std::string base = "Strato/B777/" + fms + "/Line";
-
+    std::string text;
     for (int lineNum = 1; lineNum <= (int) ProductFMC::PageLines; ++lineNum) {
-        char buf[4];
-        snprintf(buf, sizeof(buf), "%02d", lineNum);
         int lineIndex = lineNum - 1;
 
+        auto [largeRef, smallRef] = lineIds(lineIndex);
         for (bool fontSmall : {false, true}) {
-            const std::string ref = base + buf + (fontSmall ? "_S" : "_L");
-            std::string text = dm->getCached<std::string>(ref.c_str());
+            text.assign(dm->getCachedString(fontSmall ? smallRef : largeRef));
             if (text.empty()) {
                 continue;
             }
@@ -10,6 +10,7 @@
 TolissFMCProfile::TolissFMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     datarefRegex = std::regex("AirbusFBW/MCDU(1|2)([s]{0,1})([a-zA-Z]+)([0-6]{0,1})([L]{0,1})([a-z]{1})");
     isSelfTest = false;
+    vertSlewKeysRef = Dataref::getInstance()->intern(product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "AirbusFBW/MCDU1VertSlewKeys" : "AirbusFBW/MCDU2VertSlewKeys");
 
     product->setAllLedsEnabled(false);
     product->setFont(FontVariant::FontAirbus);
@@ -23,7 +24,7 @@ TolissFMCProfile::TolissFMCProfile(ProductFMC *product) : FMCAircraftProfile(pro
         uint8_t backlightBrightness = hasPower ? brightness[product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? 0 : 1] * 255 : 0;
         product->setLedBrightness(FMCLed::BACKLIGHT, backlightBrightness);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/DUBrightness", [product](const std::vector<float> &brightness) {
         if (brightness.size() < 8) {
@@ -53,24 +54,24 @@ TolissFMCProfile::TolissFMCProfile(ProductFMC *product) : FMCAircraftProfile(pro
 
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, screenBrightness);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/DUBrightness");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/MCDUIntegBrightness_Raw");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/radios/actuators/com1_power", [product](bool enabled) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/DUBrightness");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/MCDUIntegBrightness_Raw");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("AirbusFBW/AnnunMode", [this, product](int annunMode) {
         product->setAllLedsEnabled(annunMode == 2);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/DUSelfTestTimeLeft", [this, product](const std::vector<float> &selfTestSecondsRemaining) {
         if (selfTestSecondsRemaining.size() < 8) {
@@ -475,7 +476,10 @@ void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    for (const auto &ref : displayDatarefs()) {
+    const auto &refs = displayDatarefs();
+    const auto &ids = displayDatarefIds();
+    for (size_t index = 0; index < refs.size(); ++index) {
+        const std::string &ref = refs[index];
         bool isScratchpad = (ref.size() >= 3 && (ref.substr(ref.size() - 3) == "spw" || ref.substr(ref.size() - 3) == "spa"));
 
         std::smatch match;
@@ -488,7 +492,7 @@ void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
         char color = match[6].str()[0];
         bool fontSmall = match[2] == "s" || (type == "label" && match[5] != "L") || color == 's';
 
-        std::string text = datarefManager->getCached<std::string>(ref.c_str());
+        std::string_view text = datarefManager->getCachedString(ids[index]);
 
         if (text.empty()) {
             continue;
@@ -560,7 +564,7 @@ void TolissFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
         }
     }
 
-    int vertSlewType = Dataref::getInstance()->getCached<int>(product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "AirbusFBW/MCDU1VertSlewKeys" : "AirbusFBW/MCDU2VertSlewKeys");
+    int vertSlewType = Dataref::getInstance()->getCached<int>(vertSlewKeysRef);
     if (scratchpad.length() || vertSlewType > 0) {
         if (scratchpad != "CLR") {
             scratchpadPaddingActive = false;
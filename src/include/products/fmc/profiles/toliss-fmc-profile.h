@@ -11,6 +11,7 @@ class TolissFMCProfile : public FMCAircraftProfile {
         bool scratchpadPaddingActive;
         bool isSelfTest;
         unsigned char selfTestDisplayHelper;
+        DatarefId vertSlewKeysRef;
 
     public:
         TolissFMCProfile(ProductFMC *product);
@@ -12,6 +12,12 @@
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
 
+// displayDatarefs() layout: data_count, CDU_n_01 .. CDU_n_70, MessagePad, ScratchPad
+static constexpr int kDataCountRef = 0;
+static constexpr int kDataRefs = 70;
+static constexpr int kMessagePadRef = kDataRefs + 1;
+static constexpr int kScratchPadRef = kDataRefs + 2;
+
 XCraftsEjetsFMCProfile::XCraftsEjetsFMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     datarefRegex = std::regex("XCrafts/FMS/CDU_[0-9]+_([0-9]{2}|ScratchPad)");
 
@@ -26,26 +32,26 @@ XCraftsEjetsFMCProfile::XCraftsEjetsFMCProfile(ProductFMC *product) : FMCAircraf
         bool powered = Dataref::getInstance()->getCached<bool>("XCrafts/FMS/power_stat");
         product->setLedBrightness(FMCLed::BACKLIGHT, powered ? brightness : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>(("XCrafts/FMS/WW_" + cdu + "_SCREEN_BACKLIGHT").c_str(), [this, product, brightness](int brightnessUnused) {
         bool powered = Dataref::getInstance()->getCached<bool>("XCrafts/FMS/power_stat");
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, powered ? brightness : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>(("XCrafts/FMS/WW_" + cdu + "_OVERALL_LEDS_BRIGHTNESS").c_str(), [this, product, brightness](int brightnessUnused) {
         bool powered = Dataref::getInstance()->getCached<bool>("XCrafts/FMS/power_stat");
         product->setLedBrightness(FMCLed::OVERALL_LEDS_BRIGHTNESS, powered ? brightness : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("XCrafts/FMS/power_stat", [this, cdu](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref(("XCrafts/FMS/WW_" + cdu + "_BACKLIGHT").c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref(("XCrafts/FMS/WW_" + cdu + "_SCREEN_BACKLIGHT").c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref(("XCrafts/FMS/WW_" + cdu + "_OVERALL_LEDS_BRIGHTNESS").c_str());
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>(("XCrafts/FMS/WW_" + cdu + "_EXEC").c_str(), [this, product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_EXEC, (enabled || isAnnunTest()) ? 1 : 0);
@@ -57,25 +63,25 @@ XCraftsEjetsFMCProfile::XCraftsEjetsFMCProfile(ProductFMC *product) : FMCAircraf
         product->setLedBrightness(FMCLed::PFP_CALL_DISPLAY, (enabled || isAnnunTest()) ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_MCDU, (enabled || isAnnunTest()) ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>(("XCrafts/FMS/WW_" + cdu + "_FAIL").c_str(), [this, product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_FAIL, (enabled || isAnnunTest()) ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_FAIL, (enabled || isAnnunTest()) ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>(("XCrafts/FMS/WW_" + cdu + "_MSG").c_str(), [this, product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_MSG, (enabled || isAnnunTest()) ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_FM, (enabled || isAnnunTest()) ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>(("XCrafts/FMS/WW_" + cdu + "_OFST").c_str(), [this, product](bool enabled) {
         product->setLedBrightness(FMCLed::PFP_OFST, (enabled || isAnnunTest()) ? 1 : 0);
         product->setLedBrightness(FMCLed::MCDU_IND, (enabled || isAnnunTest()) ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("XCrafts/ERJ/cockpit/annunciators_test", [cdu](bool) {
         Dataref::getInstance()->executeChangedCallbacksForDataref(("XCrafts/FMS/WW_" + cdu + "_EXEC").c_str());
@@ -84,7 +90,7 @@ XCraftsEjetsFMCProfile::XCraftsEjetsFMCProfile(ProductFMC *product) : FMCAircraf
         Dataref::getInstance()->executeChangedCallbacksForDataref(("XCrafts/FMS/WW_" + cdu + "_MSG").c_str());
         Dataref::getInstance()->executeChangedCallbacksForDataref(("XCrafts/FMS/WW_" + cdu + "_OFST").c_str());
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool XCraftsEjetsFMCProfile::IsEligible() {
@@ -100,7 +106,7 @@ const std::vector<std::string> &XCraftsEjetsFMCProfile::displayDatarefs() const
                         std::vector<std::string> datarefs;
                         datarefs.push_back("XCrafts/FMS/data_count" + cduNumber);
 
-                        for (int i = 1; i <= 70; i++) {
+                        for (int i = 1; i <= kDataRefs; i++) {
                             char buffer[32];
                             snprintf(buffer, sizeof(buffer), "XCrafts/FMS/CDU_%s_%02d", cduNumber.c_str(), i);
                             datarefs.push_back(std::string(buffer));
@@ -368,14 +374,11 @@ void XCraftsEjetsFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    const std::string cduNumber = product->deviceVariant == FMCDeviceVariant::VARIANT_CAPTAIN ? "1" : "2";
-
-    int dataCount = datarefManager->getCached<int>(("XCrafts/FMS/data_count" + cduNumber).c_str());
-    for (int i = 1; i <= std::min(dataCount, 70); i++) {
-        char datarefName[32];
-        snprintf(datarefName, sizeof(datarefName), "XCrafts/FMS/CDU_%s_%02d", cduNumber.c_str(), i);
+    const auto &ids = displayDatarefIds();
 
-        std::vector<unsigned char> text = datarefManager->getCached<std::vector<unsigned char>>(datarefName);
+    int dataCount = datarefManager->getCached<int>(ids[kDataCountRef]);
+    for (int i = 1; i <= std::min(dataCount, kDataRefs); i++) {
+        std::span<const unsigned char> text = datarefManager->getCachedArray<unsigned char>(ids[i]);
 
         if (text.empty() || text.size() < 6) {
             continue;
@@ -441,14 +444,14 @@ void XCraftsEjetsFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     }
 
     // First check for MessagePad, which overrides ScratchPad
-    std::vector<unsigned char> displayText;
-    std::vector<unsigned char> messagePadText = datarefManager->getCached<std::vector<unsigned char>>(("XCrafts/FMS/CDU_" + cduNumber + "_MessagePad").c_str());
+    std::span<const unsigned char> displayText;
+    std::span<const unsigned char> messagePadText = datarefManager->getCachedArray<unsigned char>(ids[kMessagePadRef]);
 
     if (!messagePadText.empty() && messagePadText[0] != 0x20) {
         displayText = messagePadText;
     } else {
         // Fall back to ScratchPad
-        displayText = datarefManager->getCached<std::vector<unsigned char>>(("XCrafts/FMS/CDU_" + cduNumber + "_ScratchPad").c_str());
+        displayText = datarefManager->getCachedArray<unsigned char>(ids[kScratchPadRef]);
     }
 
     if (!displayText.empty()) {
@@ -8,6 +8,8 @@
 #include <cstring>
 #include <sstream>
 
+static constexpr int kScreenLines = 16; // fms_cdu1_text_line0..15
+
 XCraftsErjFMCProfile::XCraftsErjFMCProfile(ProductFMC *product) : FMCAircraftProfile(product) {
     product->setAllLedsEnabled(false);
     product->setFont(FontVariant::Default);
@@ -20,7 +22,7 @@ XCraftsErjFMCProfile::XCraftsErjFMCProfile(ProductFMC *product) : FMCAircraftPro
         product->setLedBrightness(FMCLed::BACKLIGHT, target);
         product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, target);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     product->setLedBrightness(FMCLed::BACKLIGHT, 128);
     product->setLedBrightness(FMCLed::SCREEN_BACKLIGHT, 128);
@@ -31,27 +33,16 @@ bool XCraftsErjFMCProfile::IsEligible() {
 }
 
 const std::vector<std::string> &XCraftsErjFMCProfile::displayDatarefs() const {
-    static std::unordered_map<FMCDeviceVariant, std::vector<std::string>> cache;
-
-    return cache.try_emplace(FMCDeviceVariant::VARIANT_CAPTAIN,
-                    std::vector<std::string>{
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line0",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line1",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line2",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line3",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line4",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line5",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line6",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line7",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line8",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line9",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line10",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line11",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line12",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line13",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line14",
-                        "sim/cockpit2/radios/indicators/fms_cdu1_text_line15"})
-        .first->second;
+    // Text and style for lines 0-15
+    static const std::vector<std::string> datarefs = lineRefs(
+        kScreenLines, [](int line) {
+            return "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(line);
+        },
+        [](int line) {
+            return "sim/cockpit2/radios/indicators/fms_cdu1_style_line" + std::to_string(line);
+        });
+
+    return datarefs;
 }
 
 const std::vector<FMCButtonDef> &XCraftsErjFMCProfile::buttonDefs() const {
@@ -213,16 +204,15 @@ void XCraftsErjFMCProfile::updatePage(std::vector<std::vector<char>> &page) {
     page = std::vector<std::vector<char>>(ProductFMC::PageLines, std::vector<char>(ProductFMC::PageCharsPerLine * ProductFMC::PageBytesPerChar, ' '));
 
     auto datarefManager = Dataref::getInstance();
-    for (int lineNum = 0; lineNum < std::min(ProductFMC::PageLines, (unsigned int) 16); ++lineNum) {
-        std::string textDataref = "sim/cockpit2/radios/indicators/fms_cdu1_text_line" + std::to_string(lineNum);
-        std::string styleDataref = "sim/cockpit2/radios/indicators/fms_cdu1_style_line" + std::to_string(lineNum);
-
-        std::string text = datarefManager->getCached<std::string>(textDataref.c_str());
+    std::string text;
+    for (int lineNum = 0; lineNum < std::min(static_cast<int>(ProductFMC::PageLines), kScreenLines); ++lineNum) {
+        auto [textRef, styleRef] = lineIds(lineNum);
+        text.assign(datarefManager->getCachedString(textRef));
         if (text.empty()) {
             continue;
         }
 
-        std::vector<unsigned char> styleBytes = datarefManager->getCached<std::vector<unsigned char>>(styleDataref.c_str());
+        std::span<const unsigned char> styleBytes = datarefManager->getCachedArray<unsigned char>(styleRef);
 
         const std::vector<std::pair<std::string, unsigned char>> symbols = {
             {"◀", '<'},
@@ -3,16 +3,25 @@
 #include "appstate.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/toliss-joystick-profile.h"
 #include "profiles/zibo-joystick-profile.h"
 
 #include <algorithm>
 #include <cmath>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using JoystickProfiles = ProfileRegistry<ProductJoystick, JoystickAircraftProfile,
+    TolissJoystickProfile,
+    ZiboJoystickProfile>;
+
 ProductJoystick::ProductJoystick(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, unsigned char identifierByte, unsigned char motorCode) : USBDevice(hidDevice, vendorId, productId, vendorName, productName), identifierByte(identifierByte), motorCode(motorCode) {
     profile = nullptr;
     menuItemId = -1;
 
+    // Buttons and axes reach X-Plane through its joystick support; the plugin
+    // reads nothing from the input reports.
+    setInputReportLayout({.buttonLength = 0});
     connect();
 }
 
@@ -47,15 +56,31 @@ const char *ProductJoystick::activeProfileName() const {
 }
 
 void ProductJoystick::setProfileForCurrentAircraft() {
-    if (TolissJoystickProfile::IsEligible()) {
-        profile = new TolissJoystickProfile(this);
-    } else if (ZiboJoystickProfile::IsEligible()) {
-        profile = new ZiboJoystickProfile(this);
-    } else {
+    profile = JoystickProfiles::create(this);
+}
+
+void ProductJoystick::unloadProfile() {
+    // The joystick stays usable without an aircraft profile, so profileReady
+    // is left alone.
+    if (profile) {
+        delete profile;
         profile = nullptr;
     }
 }
 
+void ProductJoystick::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setProfileForCurrentAircraft();
+
+    std::string lightingSetting = AppState::getInstance()->readPreference("JoystickLighting", "enabled");
+    if (lightingSetting == "enabled") {
+        setLedBrightness(128);
+    }
+}
+
 bool ProductJoystick::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -171,7 +196,7 @@ void ProductJoystick::setVibration(uint8_t vibration) {
         return;
     }
 
-    writeData({0x02, identifierByte, motorCode, 0x00, 0x00, 0x03, 0x49, 0x00, vibration, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, identifierByte, motorCode, 0x00, 0x00, 0x03, 0x49, 0x00, vibration, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(identifierByte, motorCode, 0x00));
 }
 
 void ProductJoystick::testVibration(uint8_t testIdentifier, uint8_t motorCodeTest) {
@@ -179,11 +204,11 @@ void ProductJoystick::testVibration(uint8_t testIdentifier, uint8_t motorCodeTes
 }
 
 void ProductJoystick::setLedBrightness(uint8_t brightness) {
-    if (AppState::getInstance()->readPreference("JoystickLighting", "enabled") == "disabled") {
+    if (!AppState::getInstance()->readPreferenceBool("JoystickLighting", true)) {
         brightness = 0;
     }
 
-    writeData({0x02, 0x20, 0xBB, 0x00, 0x00, 0x03, 0x49, 0x00, brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, 0x20, 0xBB, 0x00, 0x00, 0x03, 0x49, 0x00, brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(0x20, 0xBB, 0x00));
 }
 
 void ProductJoystick::loadVibrationSetting(const std::string &preference) {
@@ -22,12 +22,12 @@ FF777JoystickProfile::FF777JoystickProfile(USBDevice *product) : JoystickAircraf
             joystick->setVibration(0);
         }
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool FF777JoystickProfile::IsEligible() {
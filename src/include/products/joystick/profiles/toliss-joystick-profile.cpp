@@ -18,12 +18,12 @@ TolissJoystickProfile::TolissJoystickProfile(USBDevice *product) : JoystickAircr
             joystick->setVibration(0);
         }
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool TolissJoystickProfile::IsEligible() {
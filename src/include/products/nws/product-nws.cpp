@@ -3,14 +3,22 @@
 #include "appstate.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/toliss-nws-profile.h"
 
 #include <typeinfo>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using NWSProfiles = ProfileRegistry<ProductNWS, NWSAircraftProfile,
+    TolissNWSProfile>;
+
 ProductNWS::ProductNWS(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
 
+    // Buttons and axes reach X-Plane through its joystick support; the plugin
+    // reads nothing from the input reports.
+    setInputReportLayout({.buttonLength = 0});
     connect();
 }
 
@@ -35,15 +43,27 @@ const char *ProductNWS::activeProfileName() const {
 }
 
 void ProductNWS::setProfileForCurrentAircraft() {
-    if (TolissNWSProfile::IsEligible()) {
-        profile = new TolissNWSProfile(this);
-        profileReady = true;
-    } else {
+    profile = NWSProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductNWS::unloadProfile() {
+    profileReady = false;
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductNWS::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductNWS::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -82,6 +102,6 @@ void ProductNWS::setLedBrightness(NWSLed led, uint8_t brightness) {
     }
     lastLedBrightness[ledInt] = brightness;
 
-    writeData({0x02, ProductNWS::IdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
-    writeData({0x02, ProductNWS::IdentifierByte, 0xC9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, ProductNWS::IdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductNWS::IdentifierByte, 0xB9, static_cast<uint8_t>(led)));
+    writeData({0x02, ProductNWS::IdentifierByte, 0xC9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductNWS::IdentifierByte, 0xC9, static_cast<uint8_t>(led)));
 }
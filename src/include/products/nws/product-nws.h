@@ -29,6 +29,8 @@ class ProductNWS : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void blackout() override;
 
         void setLedBrightness(NWSLed led, uint8_t brightness);
@@ -10,12 +10,12 @@ TolissNWSProfile::TolissNWSProfile(ProductNWS *product) : NWSAircraftProfile(pro
 
         product->setLedBrightness(NWSLed::BACKLIGHT, backlightBrightness);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool TolissNWSProfile::IsEligible() {
@@ -12,6 +12,9 @@ ProductOrionThrottle::ProductOrionThrottle(HIDDeviceHandle hidDevice, uint16_t v
     profile = nullptr;
     menuItemId = -1;
 
+    // Buttons and axes reach X-Plane through its joystick support; the plugin
+    // reads nothing from the input reports.
+    setInputReportLayout({.buttonLength = 0});
     connect();
 }
 
@@ -38,6 +41,21 @@ void ProductOrionThrottle::setProfileForCurrentAircraft() {
     profile = new OrionThrottleAircraftProfile(this);
 }
 
+void ProductOrionThrottle::unloadProfile() {
+    if (profile) {
+        delete profile;
+        profile = nullptr;
+    }
+}
+
+void ProductOrionThrottle::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductOrionThrottle::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -124,8 +142,8 @@ void ProductOrionThrottle::setVibration(uint8_t vibration) {
         return;
     }
 
-    writeData({0x02, 0x01, 0xbf, 0x00, 0x00, 0x03, 0x49, 0x00, vibration, 0x00, 0x00, 0x00, 0x00, 0x00});
-    writeData({0x02, 0x01, 0xcf, 0x00, 0x00, 0x03, 0x49, 0x00, vibration, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, 0x01, 0xbf, 0x00, 0x00, 0x03, 0x49, 0x00, vibration, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(0x01, 0xbf, 0x00));
+    writeData({0x02, 0x01, 0xcf, 0x00, 0x00, 0x03, 0x49, 0x00, vibration, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(0x01, 0xcf, 0x00));
 }
 
 void ProductOrionThrottle::loadVibrationSetting(const std::string &preference) {
@@ -24,6 +24,8 @@ class ProductOrionThrottle : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
 
@@ -1,10 +1,12 @@
 #include "product-pap3-mcp.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "config.h"
 #include "dataref.h"
 #include "pap3-mcp-lcd-segments.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/ff777-pap3-mcp-profile.h"
 #include "profiles/fps748-pap3-mcp-profile.h"
 #include "profiles/laminar-737-pap3-mcp-profile.h"
@@ -16,6 +18,7 @@
 #include "profiles/zibo-pap3-mcp-profile.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <iomanip>
@@ -27,14 +30,26 @@
 
 using namespace pap3mcp::lcd;
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using PAP3MCPProfiles = ProfileRegistry<ProductPAP3MCP, PAP3MCPAircraftProfile,
+    ZiboPAP3MCPProfile,
+    XCraftsEjetsPAP3MCPProfile,
+    XCraftsErjPAP3MCPProfile,
+    Strato77WPAP3MCPProfile,
+    FF777PAP3MCPProfile,
+    RotateMD11PAP3MCPProfile,
+    FPS748PAP3MCPProfile,
+    SparkyB744PAP3MCPProfile,
+    Laminar737PAP3MCPProfile>;
+
 ProductPAP3MCP::ProductPAP3MCP(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) :
     USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     displayData = {};
-    lastUpdateCycle = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 32, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -51,37 +66,10 @@ ProductPAP3MCP::~ProductPAP3MCP() {
 }
 
 void ProductPAP3MCP::setProfileForCurrentAircraft() {
-    if (ZiboPAP3MCPProfile::IsEligible()) {
-        profile = new ZiboPAP3MCPProfile(this);
-        profileReady = true;
-    } else if (XCraftsEjetsPAP3MCPProfile::IsEligible()) {
-        profile = new XCraftsEjetsPAP3MCPProfile(this);
-        profileReady = true;
-    } else if (XCraftsErjPAP3MCPProfile::IsEligible()) {
-        profile = new XCraftsErjPAP3MCPProfile(this);
-        profileReady = true;
-    } else if (Strato77WPAP3MCPProfile::IsEligible()) {
-        profile = new Strato77WPAP3MCPProfile(this);
-        profileReady = true;
-    } else if (FF777PAP3MCPProfile::IsEligible()) {
-        profile = new FF777PAP3MCPProfile(this);
-        profileReady = true;
-    } else if (RotateMD11PAP3MCPProfile::IsEligible()) {
-        profile = new RotateMD11PAP3MCPProfile(this);
-        profileReady = true;
-    } else if (FPS748PAP3MCPProfile::IsEligible()) {
-        profile = new FPS748PAP3MCPProfile(this);
-        profileReady = true;
-    } else if (SparkyB744PAP3MCPProfile::IsEligible()) {
-        profile = new SparkyB744PAP3MCPProfile(this);
-        profileReady = true;
-    } else if (Laminar737PAP3MCPProfile::IsEligible()) {
-        profile = new Laminar737PAP3MCPProfile(this);
-        profileReady = true;
-    } else {
-        profile = nullptr;
-        profileReady = false;
-    }
+    displaySubscription.reset();
+
+    profile = PAP3MCPProfiles::create(this);
+    profileReady = profile != nullptr;
 }
 
 const char *ProductPAP3MCP::classIdentifier() {
@@ -92,6 +80,27 @@ const char *ProductPAP3MCP::activeProfileName() const {
     return profile ? typeid(*profile).name() : "none";
 }
 
+void ProductPAP3MCP::unloadProfile() {
+    profileReady = false;
+    displaySubscription.reset();
+    // No rematching against the outgoing aircraft: the identity generation
+    // moves on once the next one has loaded.
+    profileMatchGeneration = AircraftIdentity::getInstance()->getGeneration();
+
+    if (profile) {
+        delete profile;
+        profile = nullptr;
+    }
+}
+
+void ProductPAP3MCP::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductPAP3MCP::connect() {
     if (USBDevice::connect()) {
         initializeDisplays();
@@ -161,15 +170,33 @@ void ProductPAP3MCP::update() {
     }
 
     if (!profile) {
-        setProfileForCurrentAircraft();
+        // Matching again only helps once the aircraft identity has moved on
+        // (new datarefs, plugin enabled or the recheck backoff).
+        uint64_t identityGeneration = AircraftIdentity::getInstance()->getGeneration();
+        if (identityGeneration == profileMatchGeneration) {
+            return;
+        }
+
+        profileMatchGeneration = identityGeneration;
+        AppState::getInstance()->executeWithinFrameBudget("setProfile", FrameWorkPriority::LOW, this, [this]() {
+            if (!connected || profile) {
+                return;
+            }
+
+            setProfileForCurrentAircraft();
+            if (!profile) {
+                AircraftIdentity::getInstance()->scheduleRecheck();
+            }
+        });
         return;
     }
 
     USBDevice::update();
 
-    if (++displayUpdateFrameCounter >= getDisplayUpdateFrameInterval()) {
-        displayUpdateFrameCounter = 0;
-        updateDisplays(false);
+    if (isDisplayUpdateDue()) {
+        AppState::getInstance()->executeWithinFrameBudget("updateDisplays", FrameWorkPriority::NORMAL, this, [this]() {
+            updateDisplays(false);
+        });
     }
 }
 
@@ -178,14 +205,7 @@ void ProductPAP3MCP::updateDisplays(bool force) {
         return;
     }
 
-    bool shouldUpdate = force;
-    auto datarefManager = Dataref::getInstance();
-    for (const std::string &dataref : profile->displayDatarefs()) {
-        if (!lastUpdateCycle || datarefManager->getCachedLastUpdate(dataref.c_str()) > lastUpdateCycle) {
-            shouldUpdate = true;
-            break;
-        }
-    }
+    bool shouldUpdate = force || displaySubscription.hasChanges(profile->displayDatarefs());
 
     if (!shouldUpdate) {
         return;
@@ -219,7 +239,7 @@ void ProductPAP3MCP::updateDisplays(bool force) {
     }
 
     if (shouldUpdate) {
-        lastUpdateCycle = XPLMGetCycleNumber();
+        displaySubscription.acknowledge();
     }
 }
 
@@ -260,7 +280,7 @@ void ProductPAP3MCP::initializeDisplays() {
     initCmd[22] = 0x00;
     initCmd[23] = 0x00;
 
-    writeData(initCmd);
+    writeData(initCmd, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
@@ -478,69 +498,38 @@ void ProductPAP3MCP::sendRawLCDPayload(const std::array<uint8_t, 32> &payload) {
     // - Bytes 18-24: Padding (7 zero bytes to reach offset 25/0x19)
     // - Bytes 25-56: 32-byte LCD segment payload (0x19 to 0x38 inclusive)
     // - Bytes 57-63: Padding zeros to reach 64 bytes total
-    std::vector<uint8_t> data;
-    data.reserve(64);
-
-    // Header (4 bytes at offset 0-3)
-    data.push_back(0xF0);
-    data.push_back(0x00);
-    data.push_back(packetNumber);
-    data.push_back(0x38); // Opcode for LCD payload
-
-    // Preamble (14 bytes at offset 4-17)
-    data.push_back(0x0F);
-    data.push_back(0xBF);
-    data.push_back(0x00);
-    data.push_back(0x00);
-    data.push_back(0x02);
-    data.push_back(0x01);
-    data.push_back(0x00);
-    data.push_back(0x00);
-    data.push_back(0xDF);
-    data.push_back(0xA2);
-    data.push_back(0x50);
-    data.push_back(0x00);
-    data.push_back(0x00);
-    data.push_back(0xB0);
-
-    // Padding (7 bytes at offset 18-24 to reach payload start at 0x19=25)
-    for (int i = 0; i < 7; i++) {
-        data.push_back(0x00);
-    }
-
-    // Now at offset 25 (0x19) - add the 32-byte segment payload
-    data.insert(data.end(), payload.begin(), payload.end());
-
-    // Pad to 64 bytes total
-    while (data.size() < 64) {
-        data.push_back(0x00);
-    }
-
-    writeData(data);
+    // Header with the LCD payload opcode, then the preamble; the sequence
+    // byte is filled in per packet.
+    static constexpr uint8_t payloadHeader[] = {
+        0xF0, 0x00, 0x00, 0x38,
+        0x0F, 0xBF, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xDF, 0xA2, 0x50, 0x00, 0x00, 0xB0};
+    constexpr size_t payloadOffset = 0x19;
+
+    // Slots come zeroed, which covers both padding runs.
+    WritePacket *packet = reservePacket(WriteLane::INTERACTIVE);
+    if (!packet) {
+        return;
+    }
+    std::copy(std::begin(payloadHeader), std::end(payloadHeader), packet->bytes.begin());
+    packet->bytes[2] = packetNumber;
+    std::copy(payload.begin(), payload.end(), packet->bytes.begin() + payloadOffset);
+    packet->length = kWritePacketSize;
+    commitPacket(packet);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
 
     // Send two empty frames (opcode 0x38 with no payload)
     for (int i = 0; i < 2; i++) {
-        std::vector<uint8_t> emptyFrame(64, 0x00);
-        emptyFrame[0] = 0xF0;
-        emptyFrame[1] = 0x00;
-        emptyFrame[2] = packetNumber;
-        emptyFrame[3] = 0x38; // Same opcode
-
-        writeData(emptyFrame);
+        std::array<uint8_t, kWritePacketSize> emptyFrame = {0xF0, 0x00, packetNumber, 0x38};
+        writeData(emptyFrame, WriteLane::INTERACTIVE);
         if (++packetNumber == 0) {
             packetNumber = 1;
         }
     }
 
     // Send commit frame (opcode 0x2A)
-    std::vector<uint8_t> commitFrame(64, 0x00);
-    commitFrame[0] = 0xF0;
-    commitFrame[1] = 0x00;
-    commitFrame[2] = packetNumber;
-    commitFrame[3] = 0x2A; // Commit opcode
+    std::array<uint8_t, kWritePacketSize> commitFrame = {0xF0, 0x00, packetNumber, 0x2A}; // Commit opcode
 
     // Add commit constants at specific offsets (from working code)
     commitFrame[0x1D] = 0x0F;
@@ -551,7 +540,7 @@ void ProductPAP3MCP::sendRawLCDPayload(const std::array<uint8_t, 32> &payload) {
     commitFrame[0x26] = 0xA2;
     commitFrame[0x27] = 0x50;
 
-    writeData(commitFrame);
+    writeData(commitFrame, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
@@ -572,7 +561,7 @@ void ProductPAP3MCP::setLedBrightness(PAP3MCPLed led, uint8_t brightness) {
 
     // 14-byte command structure for both dimming and LED control:
     // [0]=0x02 [1]=0x0F [2]=0xBF [3-4]=0x00 [5]=0x03 [6]=0x49 [7]=selector [8]=value [9-13]=0x00
-    std::vector<uint8_t> data = {
+    std::array<uint8_t, 14> data = {
         0x02, // Report ID
         0x0F, // Header byte 1
         0xBF, // Header byte 2
@@ -596,11 +585,11 @@ void ProductPAP3MCP::setLedBrightness(PAP3MCPLed led, uint8_t brightness) {
         data[8] = (brightness > 0) ? 0x01 : 0x00;
     }
 
-    writeData(data);
+    writeData(data, USBWriteQueue::SlotKey(data[1], data[2], data[7]));
 }
 
 void ProductPAP3MCP::setATSolenoid(bool engaged) {
-    std::vector<uint8_t> data = {
+    std::array<uint8_t, 14> data = {
         0x02,
         0x0F,
         0xBF,
@@ -616,7 +605,7 @@ void ProductPAP3MCP::setATSolenoid(bool engaged) {
         0x00,
         0x00};
 
-    writeData(data);
+    writeData(data, USBWriteQueue::SlotKey(data[1], data[2], data[7]));
 }
 
 void ProductPAP3MCP::loadATSwitchType(const std::string &value) {
@@ -625,7 +614,7 @@ void ProductPAP3MCP::loadATSwitchType(const std::string &value) {
 }
 
 void ProductPAP3MCP::forceStateSync() {
-    pressedButtonIndices.clear();
+    pressedButtonIndices.reset();
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
 
@@ -654,18 +643,13 @@ void ProductPAP3MCP::didReceiveData(int reportId, uint8_t *report, int reportLen
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int byteIndex = 1; byteIndex <= 6 && byteIndex < reportLength; byteIndex++) {
-        uint8_t buttonByte = report[byteIndex];
-
-        for (int bitIndex = 0; bitIndex < 8; bitIndex++) {
-            int hardwareButtonIndex = (byteIndex - 1) * 8 + bitIndex;
-            bool pressed = (buttonByte & (1 << bitIndex)) != 0;
-            didReceiveButton(hardwareButtonIndex, pressed);
-        }
-    }
+    // Buttons and switches are bytes 1-6 (indices 0-47)
+    constexpr uint64_t buttonMask = (uint64_t(1) << 48) - 1;
+    didReceiveButtons(buttonsLo & buttonMask, previousLo & buttonMask);
 }
 
 void ProductPAP3MCP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -684,13 +668,13 @@ void ProductPAP3MCP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed
     // line (40) so the spring-back can't disarm. Magnetic uses the routing below.
     if (atSwitchType == ATSwitchType::Standard && (hardwareButtonIndex == 40 || hardwareButtonIndex == 41)) {
         if (hardwareButtonIndex == 40) {
-            bool wasPressed = pressedButtonIndices.count(hardwareButtonIndex) > 0;
+            bool wasPressed = pressedButtonIndices[hardwareButtonIndex];
             if (pressed && !wasPressed) {
-                pressedButtonIndices.insert(hardwareButtonIndex);
+                pressedButtonIndices.set(hardwareButtonIndex);
                 standardModeATArmed = !standardModeATArmed;
                 profile->handleSwitchChanged(0x06, standardModeATArmed ? 0x01 : 0x02, true);
             } else if (!pressed && wasPressed) {
-                pressedButtonIndices.erase(hardwareButtonIndex);
+                pressedButtonIndices.reset(hardwareButtonIndex);
             }
         }
         return;
@@ -698,7 +682,7 @@ void ProductPAP3MCP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed
 
     // Maintained switches: not in buttonDefs, routed to handleSwitchChanged.
     // pressedButtonIndices tracks the last known state so this is edge-triggered
-    // on both macOS (IOHIDQueue) and Windows/Linux (raw report button loop).
+    // on both macOS (IOHIDQueue) and Windows/Linux (raw report decoding).
     static const struct {
             uint16_t idx;
             uint8_t byteOffset;
@@ -714,12 +698,12 @@ void ProductPAP3MCP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed
 
     for (const auto &sw : switchDefs) {
         if (hardwareButtonIndex == sw.idx) {
-            bool wasPressed = pressedButtonIndices.count(hardwareButtonIndex) > 0;
+            bool wasPressed = pressedButtonIndices[hardwareButtonIndex];
             if (pressed && !wasPressed) {
-                pressedButtonIndices.insert(hardwareButtonIndex);
+                pressedButtonIndices.set(hardwareButtonIndex);
                 profile->handleSwitchChanged(sw.byteOffset, sw.bitMask, true);
             } else if (!pressed && wasPressed) {
-                pressedButtonIndices.erase(hardwareButtonIndex);
+                pressedButtonIndices.reset(hardwareButtonIndex);
                 profile->handleSwitchChanged(sw.byteOffset, sw.bitMask, false);
             }
             return;
@@ -729,13 +713,13 @@ void ProductPAP3MCP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed
     // Bank angle rotary (byte 0x05, bits 1-5 → indices 33-37).
     // Only act on the rising edge (the newly active position).
     if (hardwareButtonIndex >= 33 && hardwareButtonIndex <= 37) {
-        bool wasPressed = pressedButtonIndices.count(hardwareButtonIndex) > 0;
+        bool wasPressed = pressedButtonIndices[hardwareButtonIndex];
         if (pressed && !wasPressed) {
-            pressedButtonIndices.insert(hardwareButtonIndex);
+            pressedButtonIndices.set(hardwareButtonIndex);
             uint8_t bit = static_cast<uint8_t>(1u << (hardwareButtonIndex - 32));
             profile->handleBankAngleSwitch(bit);
         } else if (!pressed && wasPressed) {
-            pressedButtonIndices.erase(hardwareButtonIndex);
+            pressedButtonIndices.reset(hardwareButtonIndex);
         }
         return;
     }
@@ -752,14 +736,14 @@ void ProductPAP3MCP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
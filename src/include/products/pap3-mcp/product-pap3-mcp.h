@@ -1,12 +1,12 @@
 #ifndef PRODUCT_PAP3MCP_H
 #define PRODUCT_PAP3MCP_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 #include "usbdevice.h"
 
 #include <array>
 #include <map>
-#include <set>
 #include <vector>
 
 class ProductPAP3MCP : public USBDevice {
@@ -22,9 +22,9 @@ class ProductPAP3MCP : public USBDevice {
         PAP3MCPAircraftProfile *profile;
         int menuItemId;
         PAP3MCPDisplayData displayData;
-        int lastUpdateCycle;
-        int displayUpdateFrameCounter = 0;
-        std::set<int> pressedButtonIndices;
+        DatarefSubscription displaySubscription;
+        uint64_t profileMatchGeneration = 0;
+        ButtonStates pressedButtonIndices;
 
         uint64_t lastButtonStateLo = 0;
         uint32_t lastButtonStateHi = 0;
@@ -44,6 +44,8 @@ class ProductPAP3MCP : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
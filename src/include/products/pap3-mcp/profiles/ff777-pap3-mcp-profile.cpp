@@ -10,7 +10,23 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<FF777PAP3MCPProfile::DisplayRefs> FF777PAP3MCPProfile::displayRefTable[] = {
+    {"sim/cockpit2/autopilot/autopilot_has_power", &DisplayRefs::autopilotHasPower},
+    {"1-sim/ckpt/lights/glareshield"},
+    {"1-sim/output/mcp/spd", &DisplayRefs::mcpSpd},
+    {"1-sim/output/mcp/hdg", &DisplayRefs::mcpHdg},
+    {"1-sim/output/mcp/alt", &DisplayRefs::mcpAlt},
+    {"1-sim/output/mcp/vs", &DisplayRefs::mcpVs},
+    {"1-sim/output/mcp/isSpdOpen", &DisplayRefs::isSpdOpen},
+    {"1-sim/output/mcp/isVsOpen", &DisplayRefs::isVsOpen},
+    {"1-sim/output/mcp/isMachTrg", &DisplayRefs::isMachTrg},
+    {"sim/cockpit/radios/nav1_obs_degm", &DisplayRefs::nav1ObsDegm},
+    {"sim/cockpit/radios/nav2_obs_degm", &DisplayRefs::nav2ObsDegm},
+};
+
 FF777PAP3MCPProfile::FF777PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     // Monitor power and brightness
     Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/lights/glareshield", [product](float brightness) {
         bool hasPower = Dataref::getInstance()->getCached<bool>("1-sim/output/mcp/ok");
@@ -27,7 +43,7 @@ FF777PAP3MCPProfile::FF777PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircr
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // We abuse the GPU hatch dataref to trigger an update when the UI is closed.
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/anim/hatchGPU", [product](bool gpuHatchOpen) {
@@ -38,12 +54,12 @@ FF777PAP3MCPProfile::FF777PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircr
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/autopilot_has_power", [](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lights/glareshield");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/output/mcp/ok", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lights/glareshield");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // Monitor LEDs - FlightFactor 777 lamp glow datarefs
     Dataref::getInstance()->monitorExistingDataref<float>("1-sim/ckpt/lampsGlow/mcpVNAV", [product](float status) {
@@ -97,19 +113,7 @@ bool FF777PAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &FF777PAP3MCPProfile::displayDatarefs() const {
-    static std::vector<std::string> datarefs = {
-        "sim/cockpit2/autopilot/autopilot_has_power",
-        "1-sim/ckpt/lights/glareshield",
-        "1-sim/output/mcp/spd",
-        "1-sim/output/mcp/hdg",
-        "1-sim/output/mcp/alt",
-        "1-sim/output/mcp/vs",
-        "1-sim/output/mcp/isSpdOpen",
-        "1-sim/output/mcp/isVsOpen",
-        "1-sim/output/mcp/isMachTrg",
-        "sim/cockpit/radios/nav1_obs_degm",
-        "sim/cockpit/radios/nav2_obs_degm",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -167,25 +171,25 @@ void FF777PAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     data.showDashesWhenInactive = false; // FF777 doesn't show dashes when inactive
     data.showLabelsWhenInactive = true;  // FF777 shows labels even when displays are inactive
     data.showCourse = false;             // 777 doesn't have course on MCP (it's on EFIS panel)
-    bool hasPower = dataref->getCached<bool>("sim/cockpit2/autopilot/autopilot_has_power");
+    bool hasPower = dataref->getCached<bool>(displayRefs.autopilotHasPower);
     data.displayEnabled = hasPower;
 
     if (!hasPower) {
         return;
     }
 
-    data.speed = dataref->getCached<float>("1-sim/output/mcp/spd");
-    data.heading = dataref->getCached<int>("1-sim/output/mcp/hdg");
-    data.altitude = dataref->getCached<int>("1-sim/output/mcp/alt");
-    data.verticalSpeed = dataref->getCached<float>("1-sim/output/mcp/vs");
-    data.speedVisible = dataref->getCached<bool>("1-sim/output/mcp/isSpdOpen");
-    data.verticalSpeedVisible = dataref->getCached<bool>("1-sim/output/mcp/isVsOpen");
+    data.speed = dataref->getCached<float>(displayRefs.mcpSpd);
+    data.heading = dataref->getCached<int>(displayRefs.mcpHdg);
+    data.altitude = dataref->getCached<int>(displayRefs.mcpAlt);
+    data.verticalSpeed = dataref->getCached<float>(displayRefs.mcpVs);
+    data.speedVisible = dataref->getCached<bool>(displayRefs.isSpdOpen);
+    data.verticalSpeedVisible = dataref->getCached<bool>(displayRefs.isVsOpen);
     // MACH flag; without it a mach value renders through the IAS path as "01".
-    data.spdMach = dataref->getCached<bool>("1-sim/output/mcp/isMachTrg");
+    data.spdMach = dataref->getCached<bool>(displayRefs.isMachTrg);
 
     // 777 doesn't have course on MCP (it's on EFIS panel), but we read standard X-Plane datarefs for reference
-    data.crsCapt = dataref->getCached<int>("sim/cockpit/radios/nav1_obs_degm");
-    data.crsFo = dataref->getCached<int>("sim/cockpit/radios/nav2_obs_degm");
+    data.crsCapt = dataref->getCached<int>(displayRefs.nav1ObsDegm);
+    data.crsFo = dataref->getCached<int>(displayRefs.nav2ObsDegm);
 
     // FF777 doesn't have special digit flags
     data.digitA = false;
@@ -1,6 +1,7 @@
 #ifndef FF777_PAP3MCP_PROFILE_H
 #define FF777_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <map>
@@ -17,6 +18,20 @@ class FF777PAP3MCPProfile : public PAP3MCPAircraftProfile {
         bool hwATLeftOn = false;
         bool hwATRightOn = false;
         bool hwApDiscEngaged = false;
+        struct DisplayRefs {
+                DatarefId autopilotHasPower;
+                DatarefId mcpSpd;
+                DatarefId mcpHdg;
+                DatarefId mcpAlt;
+                DatarefId mcpVs;
+                DatarefId isSpdOpen;
+                DatarefId isVsOpen;
+                DatarefId isMachTrg;
+                DatarefId nav1ObsDegm;
+                DatarefId nav2ObsDegm;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FF777PAP3MCPProfile(ProductPAP3MCP *product);
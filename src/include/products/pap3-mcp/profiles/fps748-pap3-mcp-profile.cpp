@@ -7,11 +7,27 @@
 #include <cmath>
 #include <XPLMUtilities.h>
 
+// Names starting with '/' get the variant's prefix, see displayDatarefs().
+const DisplayRef<FPS748PAP3MCPProfile::DisplayRefs> FPS748PAP3MCPProfile::displayRefTable[] = {
+    {"/Elec/bus_1_powered", &DisplayRefs::bus1Powered},
+    {"/B748/MCP/mcp_ias_mach_act", &DisplayRefs::mcpIasMachAct},
+    {"/B748/MCP/mcp_ias_co_act", &DisplayRefs::mcpIasCoAct},
+    {"/B748/mcp/speed_is_blank", &DisplayRefs::speedIsBlank},
+    {"/B748/MCP/mcp_heading_bug_act", &DisplayRefs::mcpHeadingBugAct},
+    {"/B748/MCP/mcp_alt_target_act", &DisplayRefs::mcpAltTargetAct},
+    {"/B748/MCP/mcp_vs_target_act", &DisplayRefs::mcpVsTargetAct},
+    {"/B748/mcp/vs_is_blank", &DisplayRefs::vsIsBlank},
+    {"/B748/MCP/mcp_plt_course_act", &DisplayRefs::mcpPltCourseAct},
+    {"/B748/MCP/mcp_cplt_course_act", &DisplayRefs::mcpCpltCourseAct},
+};
+
 FPS748PAP3MCPProfile::FPS748PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
     bool isSSG = IsSSGVersion();
     std::string prefix = isSSG ? "SSG" : "FPS";
     std::string altPrefix = isSSG ? "ssg" : "FPS";
 
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<float>((altPrefix + "/LGT/glaresheld_sw").c_str(), [product, altPrefix](float brightness) {
         bool hasPower = Dataref::getInstance()->getCached<bool>((altPrefix + "/Elec/bus_1_powered").c_str());
         uint8_t backlight = hasPower ? static_cast<uint8_t>(brightness * 255) : 0;
@@ -20,12 +36,12 @@ FPS748PAP3MCPProfile::FPS748PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAir
         product->setLedBrightness(PAP3MCPLed::OVERALL_LED_BRIGHTNESS, hasPower ? 180 : 0);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>((altPrefix + "/Elec/bus_1_powered").c_str(), [altPrefix](bool) {
         Dataref::getInstance()->executeChangedCallbacksForDataref((altPrefix + "/LGT/glaresheld_sw").c_str());
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // MCP mode LEDs — use _ann (annunciator) datarefs, not _act
     Dataref::getInstance()->monitorExistingDataref<float>((prefix + "/B748/MCP/mcp_n1_ann").c_str(), [product](float v) {
@@ -112,22 +128,21 @@ bool FPS748PAP3MCPProfile::IsEligible() {
 
 const std::vector<std::string> &FPS748PAP3MCPProfile::displayDatarefs() const {
     bool isSSG = IsSSGVersion();
-    std::string prefix = isSSG ? "SSG" : "FPS";
-    std::string altPrefix = isSSG ? "ssg" : "FPS";
     static std::unordered_map<bool, std::vector<std::string>> cache;
 
-    return cache.try_emplace(isSSG, std::vector<std::string>{
-                                        altPrefix + "/Elec/bus_1_powered",
-                                        prefix + "/B748/MCP/mcp_ias_mach_act",
-                                        prefix + "/B748/MCP/mcp_ias_co_act",
-                                        prefix + "/B748/mcp/speed_is_blank",
-                                        prefix + "/B748/MCP/mcp_heading_bug_act",
-                                        prefix + "/B748/MCP/mcp_alt_target_act",
-                                        prefix + "/B748/MCP/mcp_vs_target_act",
-                                        prefix + "/B748/mcp/vs_is_blank",
-                                        prefix + "/B748/MCP/mcp_plt_course_act",
-                                        prefix + "/B748/MCP/mcp_cplt_course_act"})
-        .first->second;
+    auto it = cache.find(isSSG);
+    if (it == cache.end()) {
+        std::vector<std::string> refs = displayRefNames(displayRefTable, [isSSG](const char *name) {
+            if (name[0] != '/') {
+                return std::string(name);
+            }
+            // The electrical refs use a lower-case "ssg" prefix
+            bool elec = std::string_view(name).starts_with("/Elec/");
+            return std::string(isSSG ? (elec ? "ssg" : "SSG") : "FPS") + name;
+        });
+        it = cache.emplace(isSSG, std::move(refs)).first;
+    }
+    return it->second;
 }
 
 const std::unordered_map<uint16_t, PAP3MCPButtonDef> &FPS748PAP3MCPProfile::buttonDefs() const {
@@ -189,35 +204,31 @@ const std::vector<PAP3MCPEncoderDef> &FPS748PAP3MCPProfile::encoderDefs() const
 }
 
 void FPS748PAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
-    bool isSSG = IsSSGVersion();
-    std::string prefix = isSSG ? "SSG" : "FPS";
-    std::string altPrefix = isSSG ? "ssg" : "FPS";
-
     auto dm = Dataref::getInstance();
 
-    data.displayEnabled = dm->getCached<bool>((altPrefix + "/Elec/bus_1_powered").c_str());
+    data.displayEnabled = dm->getCached<bool>(displayRefs.bus1Powered);
     data.displayTest = false;
     data.showLabels = true;
 
     // mcp_ias_co_act is the authoritative MCP speed-window mode: 1 = MACH, 0 = IAS.
     // (Not MCPSPD_spdmach, which only tracks the autothrottle mode and does not
     // flip on the ground.)
-    bool isMach = dm->getCached<float>((prefix + "/B748/MCP/mcp_ias_co_act").c_str()) > 0.5f;
+    bool isMach = dm->getCached<float>(displayRefs.mcpIasCoAct) > 0.5f;
     data.spdMach = isMach;
     data.machDigits = 3;
-    data.speed = dm->getCached<float>((prefix + "/B748/MCP/mcp_ias_mach_act").c_str());
-    data.speedVisible = dm->getCached<float>((prefix + "/B748/mcp/speed_is_blank").c_str()) < 0.5f;
+    data.speed = dm->getCached<float>(displayRefs.mcpIasMachAct);
+    data.speedVisible = dm->getCached<float>(displayRefs.speedIsBlank) < 0.5f;
 
-    data.heading = static_cast<int>(dm->getCached<float>((prefix + "/B748/MCP/mcp_heading_bug_act").c_str()));
+    data.heading = static_cast<int>(dm->getCached<float>(displayRefs.mcpHeadingBugAct));
     data.headingVisible = true;
 
-    data.altitude = static_cast<int>(dm->getCached<float>((prefix + "/B748/MCP/mcp_alt_target_act").c_str()));
+    data.altitude = static_cast<int>(dm->getCached<float>(displayRefs.mcpAltTargetAct));
 
-    data.verticalSpeed = dm->getCached<float>((prefix + "/B748/MCP/mcp_vs_target_act").c_str());
-    data.verticalSpeedVisible = dm->getCached<float>((prefix + "/B748/mcp/vs_is_blank").c_str()) < 0.5f;
+    data.verticalSpeed = dm->getCached<float>(displayRefs.mcpVsTargetAct);
+    data.verticalSpeedVisible = dm->getCached<float>(displayRefs.vsIsBlank) < 0.5f;
 
-    data.crsCapt = static_cast<int>(dm->getCached<float>((prefix + "/B748/MCP/mcp_plt_course_act").c_str()));
-    data.crsFo = static_cast<int>(dm->getCached<float>((prefix + "/B748/MCP/mcp_cplt_course_act").c_str()));
+    data.crsCapt = static_cast<int>(dm->getCached<float>(displayRefs.mcpPltCourseAct));
+    data.crsFo = static_cast<int>(dm->getCached<float>(displayRefs.mcpCpltCourseAct));
     data.showCourse = false;
 }
 
@@ -1,6 +1,7 @@
 #ifndef FPS748_PAP3MCP_PROFILE_H
 #define FPS748_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <string>
@@ -14,6 +15,20 @@ class FPS748PAP3MCPProfile : public PAP3MCPAircraftProfile {
         bool hwFDFoOn = false;
         bool hwATOn = false;
         bool hwApDiscEngaged = false;
+        struct DisplayRefs {
+                DatarefId bus1Powered;
+                DatarefId mcpIasCoAct;
+                DatarefId mcpIasMachAct;
+                DatarefId speedIsBlank;
+                DatarefId mcpHeadingBugAct;
+                DatarefId mcpAltTargetAct;
+                DatarefId mcpVsTargetAct;
+                DatarefId vsIsBlank;
+                DatarefId mcpPltCourseAct;
+                DatarefId mcpCpltCourseAct;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         FPS748PAP3MCPProfile(ProductPAP3MCP *product);
@@ -10,7 +10,19 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<Laminar737PAP3MCPProfile::DisplayRefs> Laminar737PAP3MCPProfile::displayRefTable[] = {
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit2/autopilot/altitude_dial_ft", &DisplayRefs::altitudeDialFt},
+    {"sim/cockpit2/autopilot/vvi_dial_fpm", &DisplayRefs::vviDialFpm},
+    {"sim/cockpit/radios/nav1_obs_degm", &DisplayRefs::nav1ObsDegm},
+    {"sim/cockpit/radios/nav2_obs_degm", &DisplayRefs::nav2ObsDegm},
+    {"sim/cockpit2/autopilot/autopilot_has_power", &DisplayRefs::autopilotHasPower},
+};
+
 Laminar737PAP3MCPProfile::Laminar737PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/electrical/instrument_brightness_ratio_manual", [product](const std::vector<float> &brightness) {
         if (brightness.size() >= 16) {
             bool hasPower = Dataref::getInstance()->get<bool>("sim/cockpit2/autopilot/autopilot_has_power");
@@ -20,12 +32,12 @@ Laminar737PAP3MCPProfile::Laminar737PAP3MCPProfile(ProductPAP3MCP *product) : PA
             product->forceStateSync();
         }
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/autopilot_has_power", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio_manual");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool Laminar737PAP3MCPProfile::IsEligible() {
@@ -33,13 +45,7 @@ bool Laminar737PAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &Laminar737PAP3MCPProfile::displayDatarefs() const {
-    static std::vector<std::string> datarefs = {
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit2/autopilot/altitude_dial_ft",
-        "sim/cockpit2/autopilot/vvi_dial_fpm",
-        "sim/cockpit/radios/nav1_obs_degm",
-        "sim/cockpit/radios/nav2_obs_degm"};
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -91,19 +97,19 @@ const std::vector<PAP3MCPEncoderDef> &Laminar737PAP3MCPProfile::encoderDefs() co
 void Laminar737PAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     // Use getCached() for performance
     auto dataref = Dataref::getInstance();
-    data.speed = dataref->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
-    data.heading = static_cast<int>(dataref->getCached<float>("sim/cockpit/autopilot/heading_mag"));
-    data.altitude = static_cast<int>(dataref->getCached<float>("sim/cockpit2/autopilot/altitude_dial_ft"));
-    data.verticalSpeed = dataref->getCached<float>("sim/cockpit2/autopilot/vvi_dial_fpm");
+    data.speed = dataref->getCached<float>(displayRefs.airspeedDialKtsMach);
+    data.heading = static_cast<int>(dataref->getCached<float>(displayRefs.headingMag));
+    data.altitude = static_cast<int>(dataref->getCached<float>(displayRefs.altitudeDialFt));
+    data.verticalSpeed = dataref->getCached<float>(displayRefs.vviDialFpm);
     data.verticalSpeedVisible = true; // Always show for Laminar
-    data.crsCapt = static_cast<int>(dataref->getCached<float>("sim/cockpit/radios/nav1_obs_degm"));
-    data.crsFo = static_cast<int>(dataref->getCached<float>("sim/cockpit/radios/nav2_obs_degm"));
+    data.crsCapt = static_cast<int>(dataref->getCached<float>(displayRefs.nav1ObsDegm));
+    data.crsFo = static_cast<int>(dataref->getCached<float>(displayRefs.nav2ObsDegm));
 
     data.digitA = false;
     data.digitB = false;
 
     // Check if displays should be enabled based on power
-    data.displayEnabled = dataref->getCached<bool>("sim/cockpit2/autopilot/autopilot_has_power");
+    data.displayEnabled = dataref->getCached<bool>(displayRefs.autopilotHasPower);
 }
 
 void Laminar737PAP3MCPProfile::buttonPressed(const PAP3MCPButtonDef *button, XPLMCommandPhase phase) {
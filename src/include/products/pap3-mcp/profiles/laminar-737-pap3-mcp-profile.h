@@ -1,6 +1,7 @@
 #ifndef LAMINAR737_PAP3MCP_PROFILE_H
 #define LAMINAR737_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <map>
@@ -8,6 +9,19 @@
 #include <vector>
 
 class Laminar737PAP3MCPProfile : public PAP3MCPAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitudeDialFt;
+                DatarefId vviDialFpm;
+                DatarefId nav1ObsDegm;
+                DatarefId nav2ObsDegm;
+                DatarefId autopilotHasPower;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         Laminar737PAP3MCPProfile(ProductPAP3MCP *product);
 
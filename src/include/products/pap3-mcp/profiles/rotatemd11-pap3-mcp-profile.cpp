@@ -10,7 +10,25 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<RotateMD11PAP3MCPProfile::DisplayRefs> RotateMD11PAP3MCPProfile::displayRefTable[] = {
+    {"Rotate/aircraft/systems/elec_dc_batt_bus_pwrd", &DisplayRefs::elecDcBattBusPwrd},
+    {"Rotate/aircraft/systems/light_fgs_panel_brt_ratio"},
+    {"Rotate/aircraft/systems/gcp_spd_presel_ias", &DisplayRefs::gcpSpdPreselIas},
+    {"Rotate/aircraft/systems/gcp_spd_presel_mach", &DisplayRefs::gcpSpdPreselMach},
+    {"Rotate/aircraft/systems/gcp_active_ias_mach_mode", &DisplayRefs::gcpActiveIasMachMode},
+    {"Rotate/aircraft/systems/gcp_hdg_presel_deg", &DisplayRefs::gcpHdgPreselDeg},
+    {"Rotate/aircraft/systems/gcp_alt_presel_ft", &DisplayRefs::gcpAltPreselFt},
+    {"Rotate/aircraft/systems/gcp_vs_sel_fpm", &DisplayRefs::gcpVsSelFpm},
+    {"Rotate/aircraft/systems/afs_fms_spd_engaged", &DisplayRefs::afsFmsSpdEngaged},
+    {"Rotate/aircraft/systems/afs_roll_mode"},
+    {"Rotate/aircraft/systems/gcp_hdg_trk_presel_set", &DisplayRefs::gcpHdgTrkPreselSet},
+    {"sim/cockpit/radios/nav1_obs_degm", &DisplayRefs::nav1ObsDegm},
+    {"sim/cockpit/radios/nav2_obs_degm", &DisplayRefs::nav2ObsDegm},
+};
+
 RotateMD11PAP3MCPProfile::RotateMD11PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     // Monitor power and brightness - MD-11 specific behavior
     Dataref::getInstance()->monitorExistingDataref<bool>("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd", [this, product](bool hasPower) {
         if (hasPower) {
@@ -38,12 +56,12 @@ RotateMD11PAP3MCPProfile::RotateMD11PAP3MCPProfile(ProductPAP3MCP *product) : PA
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("Rotate/aircraft/systems/light_fgs_panel_brt_ratio", [](float panelLights) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // MD-11 MCP has NO LED annunciators - all LEDs disabled by not setting up monitors
     // The real MD-11 uses a different display system (not LED buttons)
@@ -54,21 +72,7 @@ bool RotateMD11PAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &RotateMD11PAP3MCPProfile::displayDatarefs() const {
-    static std::vector<std::string> datarefs = {
-        "Rotate/aircraft/systems/elec_dc_batt_bus_pwrd",
-        "Rotate/aircraft/systems/light_fgs_panel_brt_ratio",
-        "Rotate/aircraft/systems/gcp_spd_presel_ias",
-        "Rotate/aircraft/systems/gcp_spd_presel_mach",
-        "Rotate/aircraft/systems/gcp_active_ias_mach_mode",
-        "Rotate/aircraft/systems/gcp_hdg_presel_deg",
-        "Rotate/aircraft/systems/gcp_alt_presel_ft",
-        "Rotate/aircraft/systems/gcp_vs_sel_fpm",
-        "Rotate/aircraft/systems/afs_fms_spd_engaged",
-        "Rotate/aircraft/systems/afs_roll_mode",
-        "Rotate/aircraft/systems/gcp_hdg_trk_presel_set",
-        "sim/cockpit/radios/nav1_obs_degm",
-        "sim/cockpit/radios/nav2_obs_degm",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -129,7 +133,7 @@ void RotateMD11PAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     data.showDashesWhenInactive = true; // Show dashes (---) when displays are inactive
     data.showLabelsWhenInactive = true; // Show labels even when displays are inactive
     data.showCourse = false;            // MD-11 doesn't have CRS displays on the MCP
-    bool hasPower = dataref->getCached<bool>("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd");
+    bool hasPower = dataref->getCached<bool>(displayRefs.elecDcBattBusPwrd);
     data.displayEnabled = hasPower;
 
     if (!hasPower) {
@@ -137,42 +141,42 @@ void RotateMD11PAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     }
 
     // Speed - check if IAS or MACH mode
-    int iasMachMode = dataref->getCached<int>("Rotate/aircraft/systems/gcp_active_ias_mach_mode");
+    int iasMachMode = dataref->getCached<int>(displayRefs.gcpActiveIasMachMode);
     if (iasMachMode == 0) {
         // IAS mode
-        data.speed = dataref->getCached<float>("Rotate/aircraft/systems/gcp_spd_presel_ias");
+        data.speed = dataref->getCached<float>(displayRefs.gcpSpdPreselIas);
     } else {
         // MACH mode
-        data.speed = dataref->getCached<float>("Rotate/aircraft/systems/gcp_spd_presel_mach");
+        data.speed = dataref->getCached<float>(displayRefs.gcpSpdPreselMach);
     }
     data.spdMach = (iasMachMode != 0);
 
     // Control SPD LCD visibility based on FMS SPD engagement
     // When FMS SPD is engaged (value = 1), hide the SPD display
-    int fmsSpdEngaged = dataref->getCached<int>("Rotate/aircraft/systems/afs_fms_spd_engaged");
+    int fmsSpdEngaged = dataref->getCached<int>(displayRefs.afsFmsSpdEngaged);
     data.speedVisible = (fmsSpdEngaged != 1);
 
     // Heading
-    int hdgRaw = dataref->getCached<int>("Rotate/aircraft/systems/gcp_hdg_presel_deg");
+    int hdgRaw = dataref->getCached<int>(displayRefs.gcpHdgPreselDeg);
     data.heading = hdgRaw % 360;
     if (data.heading < 0) {
         data.heading += 360;
     }
 
     // Control HDG LCD visibility
-    int hdgTrkSel = dataref->getCached<int>("Rotate/aircraft/systems/gcp_hdg_trk_presel_set");
+    int hdgTrkSel = dataref->getCached<int>(displayRefs.gcpHdgTrkPreselSet);
     data.headingVisible = (hdgTrkSel == 1);
 
     // Altitude
-    data.altitude = dataref->getCached<int>("Rotate/aircraft/systems/gcp_alt_presel_ft");
+    data.altitude = dataref->getCached<int>(displayRefs.gcpAltPreselFt);
 
     // Vertical speed - only show when V/S is non-zero
-    data.verticalSpeed = dataref->getCached<float>("Rotate/aircraft/systems/gcp_vs_sel_fpm");
+    data.verticalSpeed = dataref->getCached<float>(displayRefs.gcpVsSelFpm);
     data.verticalSpeedVisible = (std::abs(data.verticalSpeed) > 0.5f);
 
     // Course - MD-11 doesn't have CRS displays on the MCP (using standard datarefs for reference)
-    data.crsCapt = dataref->getCached<int>("sim/cockpit/radios/nav1_obs_degm");
-    data.crsFo = dataref->getCached<int>("sim/cockpit/radios/nav2_obs_degm");
+    data.crsCapt = dataref->getCached<int>(displayRefs.nav1ObsDegm);
+    data.crsFo = dataref->getCached<int>(displayRefs.nav2ObsDegm);
 
     // MD-11 doesn't have special digit flags
     data.digitA = false;
@@ -1,6 +1,7 @@
 #ifndef ROTATEMD11_PAP3MCP_PROFILE_H
 #define ROTATEMD11_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <map>
@@ -11,6 +12,21 @@ class RotateMD11PAP3MCPProfile : public PAP3MCPAircraftProfile {
     private:
         bool backlightInitialized = false;
         bool hdgTrkSelInitialized = false;
+        struct DisplayRefs {
+                DatarefId elecDcBattBusPwrd;
+                DatarefId gcpActiveIasMachMode;
+                DatarefId gcpSpdPreselIas;
+                DatarefId gcpSpdPreselMach;
+                DatarefId afsFmsSpdEngaged;
+                DatarefId gcpHdgPreselDeg;
+                DatarefId gcpHdgTrkPreselSet;
+                DatarefId gcpAltPreselFt;
+                DatarefId gcpVsSelFpm;
+                DatarefId nav1ObsDegm;
+                DatarefId nav2ObsDegm;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         RotateMD11PAP3MCPProfile(ProductPAP3MCP *product);
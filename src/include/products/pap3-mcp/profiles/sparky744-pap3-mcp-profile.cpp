@@ -7,7 +7,21 @@
 #include <cmath>
 #include <XPLMUtilities.h>
 
+const DisplayRef<SparkyB744PAP3MCPProfile::DisplayRefs> SparkyB744PAP3MCPProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/avionics_on", &DisplayRefs::avionicsOn},
+    {"laminar/B747/autopilot/ias_dial_value", &DisplayRefs::iasDialValue},
+    {"laminar/B747/autopilot/ias_mach/window_open", &DisplayRefs::iasMachWindowOpen},
+    {"laminar/B747/autopilot/heading/degrees", &DisplayRefs::headingDegrees},
+    {"laminar/B747/autopilot/heading/altitude_dial_ft", &DisplayRefs::altitudeDialFt},
+    {"laminar/B747/cockpit2/autopilot/vvi_dial_fpm", &DisplayRefs::vviDialFpm},
+    {"laminar/B747/autopilot/vert_spd/window_open", &DisplayRefs::vertSpdWindowOpen},
+    {"sim/cockpit2/autopilot/nav1_obs_deg_mag_pilot", &DisplayRefs::nav1ObsDegMagPilot},
+    {"sim/cockpit2/autopilot/nav2_obs_deg_mag_pilot", &DisplayRefs::nav2ObsDegMagPilot},
+};
+
 SparkyB744PAP3MCPProfile::SparkyB744PAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [product](bool powered) {
         uint8_t backlight = powered ? 200 : 0;
         product->setLedBrightness(PAP3MCPLed::BACKLIGHT, backlight);
@@ -15,7 +29,7 @@ SparkyB744PAP3MCPProfile::SparkyB744PAP3MCPProfile(ProductPAP3MCP *product) : PA
         product->setLedBrightness(PAP3MCPLed::OVERALL_LED_BRIGHTNESS, powered ? 180 : 0);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // MCP mode LEDs
     Dataref::getInstance()->monitorExistingDataref<double>("laminar/B747/autopilot/FMA/active_pitch_mode", [product](double v) {
@@ -83,18 +97,8 @@ bool SparkyB744PAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &SparkyB744PAP3MCPProfile::displayDatarefs() const {
-    static const std::vector<std::string> refs = {
-        "sim/cockpit/electrical/avionics_on",
-        "laminar/B747/autopilot/ias_dial_value",
-        "laminar/B747/autopilot/ias_mach/window_open",
-        "laminar/B747/autopilot/heading/degrees",
-        "laminar/B747/autopilot/heading/altitude_dial_ft",
-        "laminar/B747/cockpit2/autopilot/vvi_dial_fpm",
-        "laminar/B747/autopilot/vert_spd/window_open",
-        "sim/cockpit2/autopilot/nav1_obs_deg_mag_pilot",
-        "sim/cockpit2/autopilot/nav2_obs_deg_mag_pilot",
-    };
-    return refs;
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
+    return datarefs;
 }
 
 const std::unordered_map<uint16_t, PAP3MCPButtonDef> &SparkyB744PAP3MCPProfile::buttonDefs() const {
@@ -148,24 +152,24 @@ const std::vector<PAP3MCPEncoderDef> &SparkyB744PAP3MCPProfile::encoderDefs() co
 void SparkyB744PAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     auto dm = Dataref::getInstance();
 
-    data.displayEnabled = dm->getCached<bool>("sim/cockpit/electrical/avionics_on");
+    data.displayEnabled = dm->getCached<bool>(displayRefs.avionicsOn);
     data.displayTest = false;
     data.showLabels = false;
 
     data.digitA = false;
-    data.speed = static_cast<float>(dm->getCached<double>("laminar/B747/autopilot/ias_dial_value"));
-    data.speedVisible = dm->getCached<double>("laminar/B747/autopilot/ias_mach/window_open") > 0.5;
+    data.speed = static_cast<float>(dm->getCached<double>(displayRefs.iasDialValue));
+    data.speedVisible = dm->getCached<double>(displayRefs.iasMachWindowOpen) > 0.5;
 
-    data.heading = static_cast<int>(dm->getCached<double>("laminar/B747/autopilot/heading/degrees"));
+    data.heading = static_cast<int>(dm->getCached<double>(displayRefs.headingDegrees));
     data.headingVisible = true;
 
-    data.altitude = static_cast<int>(dm->getCached<double>("laminar/B747/autopilot/heading/altitude_dial_ft"));
+    data.altitude = static_cast<int>(dm->getCached<double>(displayRefs.altitudeDialFt));
 
-    data.verticalSpeed = static_cast<float>(dm->getCached<double>("laminar/B747/cockpit2/autopilot/vvi_dial_fpm"));
-    data.verticalSpeedVisible = dm->getCached<double>("laminar/B747/autopilot/vert_spd/window_open") > 0.5;
+    data.verticalSpeed = static_cast<float>(dm->getCached<double>(displayRefs.vviDialFpm));
+    data.verticalSpeedVisible = dm->getCached<double>(displayRefs.vertSpdWindowOpen) > 0.5;
 
-    data.crsCapt = static_cast<int>(dm->getCached<float>("sim/cockpit2/autopilot/nav1_obs_deg_mag_pilot"));
-    data.crsFo = static_cast<int>(dm->getCached<float>("sim/cockpit2/autopilot/nav2_obs_deg_mag_pilot"));
+    data.crsCapt = static_cast<int>(dm->getCached<float>(displayRefs.nav1ObsDegMagPilot));
+    data.crsFo = static_cast<int>(dm->getCached<float>(displayRefs.nav2ObsDegMagPilot));
     data.showCourse = true;
 }
 
@@ -1,6 +1,7 @@
 #ifndef SPARKYB744_PAP3MCP_PROFILE_H
 #define SPARKYB744_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <string>
@@ -13,6 +14,19 @@ class SparkyB744PAP3MCPProfile : public PAP3MCPAircraftProfile {
         bool hwFDFoOn = false;
         bool hwATOn = false;
         bool hwApDiscEngaged = false;
+        struct DisplayRefs {
+                DatarefId avionicsOn;
+                DatarefId iasDialValue;
+                DatarefId iasMachWindowOpen;
+                DatarefId headingDegrees;
+                DatarefId altitudeDialFt;
+                DatarefId vviDialFpm;
+                DatarefId vertSpdWindowOpen;
+                DatarefId nav1ObsDegMagPilot;
+                DatarefId nav2ObsDegMagPilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         SparkyB744PAP3MCPProfile(ProductPAP3MCP *product);
@@ -9,14 +9,27 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<Strato77WPAP3MCPProfile::DisplayRefs> Strato77WPAP3MCPProfile::displayRefTable[] = {
+    {"sim/cockpit2/autopilot/autopilot_has_power", &DisplayRefs::autopilotHasPower},
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"sim/cockpit/autopilot/altitude", &DisplayRefs::altitude},
+    {"sim/cockpit/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"Strato/777/mcp/vshold", &DisplayRefs::vsHold},
+    {"sim/cockpit2/autopilot/nav1_obs_deg_mag_pilot", &DisplayRefs::nav1ObsDegMagPilot},
+    {"sim/cockpit2/autopilot/nav2_obs_deg_mag_pilot", &DisplayRefs::nav2ObsDegMagPilot},
+};
+
 Strato77WPAP3MCPProfile::Strato77WPAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit2/autopilot/autopilot_has_power", [product](bool powered) {
         product->setLedBrightness(PAP3MCPLed::BACKLIGHT, powered ? 200 : 0);
         product->setLedBrightness(PAP3MCPLed::LCD_BACKLIGHT, powered ? 180 : 0);
         product->setLedBrightness(PAP3MCPLed::OVERALL_LED_BRIGHTNESS, powered ? 180 : 0);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("Strato/777/mcp/ap_on", [product](int engaged) {
         product->setLedBrightness(PAP3MCPLed::CMD_A, engaged ? 1 : 0);
@@ -64,16 +77,7 @@ bool Strato77WPAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &Strato77WPAP3MCPProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "sim/cockpit2/autopilot/autopilot_has_power",
-        "sim/cockpit2/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/heading_mag",
-        "sim/cockpit/autopilot/altitude",
-        "sim/cockpit/autopilot/vertical_velocity",
-        "Strato/777/mcp/vshold",
-        "sim/cockpit2/autopilot/nav1_obs_deg_mag_pilot",
-        "sim/cockpit2/autopilot/nav2_obs_deg_mag_pilot",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -130,7 +134,7 @@ const std::vector<PAP3MCPEncoderDef> &Strato77WPAP3MCPProfile::encoderDefs() con
 void Strato77WPAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     auto dm = Dataref::getInstance();
 
-    bool hasPower = dm->getCached<bool>("sim/cockpit2/autopilot/autopilot_has_power");
+    bool hasPower = dm->getCached<bool>(displayRefs.autopilotHasPower);
     data.displayEnabled = hasPower;
     data.displayTest = false;
     data.showLabels = true;
@@ -144,23 +148,23 @@ void Strato77WPAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
         return;
     }
 
-    data.speed = dm->getCached<float>("sim/cockpit2/autopilot/airspeed_dial_kts_mach");
+    data.speed = dm->getCached<float>(displayRefs.airspeedDialKtsMach);
     data.speedVisible = true;
 
-    float heading = dm->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float heading = dm->getCached<float>(displayRefs.headingMag);
     data.heading = static_cast<int>(std::round(heading)) % 360;
     data.headingVisible = true;
 
-    float altitude = dm->getCached<float>("sim/cockpit/autopilot/altitude");
+    float altitude = dm->getCached<float>(displayRefs.altitude);
     data.altitude = (altitude >= 0 && altitude < 100000)
                       ? static_cast<int>(std::round(altitude / 100.0f) * 100)
                       : 0;
 
-    data.verticalSpeed = dm->getCached<float>("sim/cockpit/autopilot/vertical_velocity");
-    data.verticalSpeedVisible = dm->getCached<bool>("Strato/777/mcp/vshold");
+    data.verticalSpeed = dm->getCached<float>(displayRefs.verticalVelocity);
+    data.verticalSpeedVisible = dm->getCached<bool>(displayRefs.vsHold);
 
-    data.crsCapt = static_cast<int>(dm->getCached<float>("sim/cockpit2/autopilot/nav1_obs_deg_mag_pilot"));
-    data.crsFo = static_cast<int>(dm->getCached<float>("sim/cockpit2/autopilot/nav2_obs_deg_mag_pilot"));
+    data.crsCapt = static_cast<int>(dm->getCached<float>(displayRefs.nav1ObsDegMagPilot));
+    data.crsFo = static_cast<int>(dm->getCached<float>(displayRefs.nav2ObsDegMagPilot));
 }
 
 void Strato77WPAP3MCPProfile::buttonPressed(const PAP3MCPButtonDef *button, XPLMCommandPhase phase) {
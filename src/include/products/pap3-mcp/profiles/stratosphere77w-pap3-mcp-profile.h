@@ -1,6 +1,7 @@
 #ifndef STRATOSPHERE77W_PAP3MCP_PROFILE_H
 #define STRATOSPHERE77W_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <string>
@@ -14,6 +15,18 @@ class Strato77WPAP3MCPProfile : public PAP3MCPAircraftProfile {
         bool hwFDFoOn = false;
         bool hwATOn = false;
         bool hwApDiscEngaged = false;
+        struct DisplayRefs {
+                DatarefId autopilotHasPower;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId vsHold;
+                DatarefId nav1ObsDegMagPilot;
+                DatarefId nav2ObsDegMagPilot;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         Strato77WPAP3MCPProfile(ProductPAP3MCP *product);
@@ -7,7 +7,25 @@
 #include <cstring>
 #include <XPLMUtilities.h>
 
+const DisplayRef<XCraftsEjetsPAP3MCPProfile::DisplayRefs> XCraftsEjetsPAP3MCPProfile::displayRefTable[] = {
+    {"XCrafts/ERJ/autopilot/airspeed_dial_kts_mach", &DisplayRefs::airspeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"sim/cockpit/autopilot/heading_mag", &DisplayRefs::headingMag},
+    {"XCrafts/ERJ/autopilot/altitude", &DisplayRefs::altitude},
+    {"XCrafts/ERJ/autopilot/vertical_velocity", &DisplayRefs::verticalVelocity},
+    {"sim/cockpit/radios/nav1_obs_degm", &DisplayRefs::nav1ObsDegm},
+    {"sim/cockpit/radios/nav2_obs_degm", &DisplayRefs::nav2ObsDegm},
+    {"sim/cockpit/autopilot/autopilot_mode", &DisplayRefs::autopilotMode},
+    {"XCrafts/ERJ/autothrottle_armed", &DisplayRefs::autothrottleArmed},
+    {"XCrafts/ERJ/autopilot/autothrottle_system_active", &DisplayRefs::autothrottleSystemActive},
+    {"sim/cockpit2/autopilot/st55_nav", &DisplayRefs::st55Nav},
+    {"XCrafts/ERJ/VNAV_armed", &DisplayRefs::vnavArmed},
+    {"XCrafts/ERJ/cockpit/annunciators_test", &DisplayRefs::annunciatorsTest},
+};
+
 XCraftsEjetsPAP3MCPProfile::XCraftsEjetsPAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
     Dataref::getInstance()->monitorExistingDataref<float>("XCrafts/panel_brt_1", [product](float brightness) {
         uint8_t target = static_cast<uint8_t>(brightness * 255);
         product->setLedBrightness(PAP3MCPLed::BACKLIGHT, target);
@@ -15,7 +33,7 @@ XCraftsEjetsPAP3MCPProfile::XCraftsEjetsPAP3MCPProfile(ProductPAP3MCP *product)
         product->setLedBrightness(PAP3MCPLed::OVERALL_LED_BRIGHTNESS, target);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>("sim/cockpit/autopilot/autopilot_mode", [product](int mode) {
         bool engaged = (mode == 2);
@@ -50,21 +68,7 @@ bool XCraftsEjetsPAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &XCraftsEjetsPAP3MCPProfile::displayDatarefs() const {
-    static const std::vector<std::string> datarefs = {
-        "XCrafts/ERJ/autopilot/airspeed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "sim/cockpit/autopilot/heading_mag",
-        "XCrafts/ERJ/autopilot/altitude",
-        "XCrafts/ERJ/autopilot/vertical_velocity",
-        "sim/cockpit/radios/nav1_obs_degm",
-        "sim/cockpit/radios/nav2_obs_degm",
-        "sim/cockpit/autopilot/autopilot_mode",
-        "XCrafts/ERJ/autothrottle_armed",
-        "XCrafts/ERJ/autopilot/autothrottle_system_active",
-        "sim/cockpit2/autopilot/st55_nav",
-        "XCrafts/ERJ/VNAV_armed",
-        "XCrafts/ERJ/cockpit/annunciators_test",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -116,12 +120,12 @@ void XCraftsEjetsPAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     auto dr = Dataref::getInstance();
 
     data.displayEnabled = true;
-    data.displayTest = dr->getCached<bool>("XCrafts/ERJ/cockpit/annunciators_test");
+    data.displayTest = dr->getCached<bool>(displayRefs.annunciatorsTest);
     data.showLabels = false;
     data.showCourse = true;
 
-    bool isMach = dr->getCached<bool>("sim/cockpit/autopilot/airspeed_is_mach");
-    float speedRaw = dr->getCached<float>("XCrafts/ERJ/autopilot/airspeed_dial_kts_mach");
+    bool isMach = dr->getCached<bool>(displayRefs.airspeedIsMach);
+    float speedRaw = dr->getCached<float>(displayRefs.airspeedDialKtsMach);
 
     if (isMach && speedRaw > 0) {
         int machHundredths = static_cast<int>(std::round(speedRaw * 100));
@@ -131,29 +135,29 @@ void XCraftsEjetsPAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     }
     data.spdMach = isMach;
 
-    float headingRaw = dr->getCached<float>("sim/cockpit/autopilot/heading_mag");
+    float headingRaw = dr->getCached<float>(displayRefs.headingMag);
     data.heading = (static_cast<int>(headingRaw) % 360 + 360) % 360;
 
-    float altRaw = dr->getCached<float>("XCrafts/ERJ/autopilot/altitude");
+    float altRaw = dr->getCached<float>(displayRefs.altitude);
     data.altitude = (static_cast<int>(altRaw) / 100) * 100;
 
-    float vsRaw = dr->getCached<float>("XCrafts/ERJ/autopilot/vertical_velocity");
+    float vsRaw = dr->getCached<float>(displayRefs.verticalVelocity);
     data.verticalSpeed = static_cast<float>((static_cast<int>(vsRaw) / 100) * 100);
 
-    data.crsCapt = static_cast<int>(dr->getCached<float>("sim/cockpit/radios/nav1_obs_degm"));
-    data.crsFo = static_cast<int>(dr->getCached<float>("sim/cockpit/radios/nav2_obs_degm"));
+    data.crsCapt = static_cast<int>(dr->getCached<float>(displayRefs.nav1ObsDegm));
+    data.crsFo = static_cast<int>(dr->getCached<float>(displayRefs.nav2ObsDegm));
 
     data.speedVisible = true;
     data.headingVisible = true;
     data.verticalSpeedVisible = true;
 
-    bool apEngaged = dr->getCached<int>("sim/cockpit/autopilot/autopilot_mode") == 2;
+    bool apEngaged = dr->getCached<int>(displayRefs.autopilotMode) == 2;
     data.ledCmdA = apEngaged;
     data.ledCmdB = apEngaged;
-    data.ledATArm = dr->getCached<int>("XCrafts/ERJ/autothrottle_armed") == 1 ||
-                    dr->getCached<int>("XCrafts/ERJ/autopilot/autothrottle_system_active") == 1;
-    data.ledLNAV = dr->getCached<int>("sim/cockpit2/autopilot/st55_nav") == 1;
-    data.ledVNAV = dr->getCached<int>("XCrafts/ERJ/VNAV_armed") == 1;
+    data.ledATArm = dr->getCached<int>(displayRefs.autothrottleArmed) == 1 ||
+                    dr->getCached<int>(displayRefs.autothrottleSystemActive) == 1;
+    data.ledLNAV = dr->getCached<int>(displayRefs.st55Nav) == 1;
+    data.ledVNAV = dr->getCached<int>(displayRefs.vnavArmed) == 1;
 }
 
 void XCraftsEjetsPAP3MCPProfile::buttonPressed(const PAP3MCPButtonDef *button, XPLMCommandPhase phase) {
@@ -1,12 +1,32 @@
 #ifndef XCRAFTS_PAP3MCP_PROFILE_H
 #define XCRAFTS_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <string>
 #include <vector>
 
 class XCraftsEjetsPAP3MCPProfile : public PAP3MCPAircraftProfile {
+    private:
+        struct DisplayRefs {
+                DatarefId annunciatorsTest;
+                DatarefId airspeedIsMach;
+                DatarefId airspeedDialKtsMach;
+                DatarefId headingMag;
+                DatarefId altitude;
+                DatarefId verticalVelocity;
+                DatarefId nav1ObsDegm;
+                DatarefId nav2ObsDegm;
+                DatarefId autopilotMode;
+                DatarefId autothrottleArmed;
+                DatarefId autothrottleSystemActive;
+                DatarefId st55Nav;
+                DatarefId vnavArmed;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
+
     public:
         XCraftsEjetsPAP3MCPProfile(ProductPAP3MCP *product);
 
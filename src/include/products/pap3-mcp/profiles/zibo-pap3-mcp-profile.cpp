@@ -10,8 +10,28 @@
 #include <iomanip>
 #include <XPLMUtilities.h>
 
+const DisplayRef<ZiboPAP3MCPProfile::DisplayRefs> ZiboPAP3MCPProfile::displayRefTable[] = {
+    {"sim/cockpit/electrical/avionics_on", &DisplayRefs::avionicsOn},
+    {"laminar/B738/electric/panel_brightness"},
+    {"laminar/B738/electric/main_bus"},
+    {"laminar/B738/autopilot/mcp_speed_dial_kts_mach", &DisplayRefs::mcpSpeedDialKtsMach},
+    {"sim/cockpit/autopilot/airspeed_is_mach", &DisplayRefs::airspeedIsMach},
+    {"laminar/B738/autopilot/mcp_hdg_dial", &DisplayRefs::mcpHdgDial},
+    {"laminar/B738/autopilot/mcp_alt_dial", &DisplayRefs::mcpAltDial},
+    {"sim/cockpit2/autopilot/vvi_dial_fpm", &DisplayRefs::vviDialFpm},
+    {"laminar/B738/autopilot/vvi_dial_show", &DisplayRefs::vviDialShow},
+    {"laminar/B738/autopilot/show_ias", &DisplayRefs::showIas},
+    {"laminar/B738/autopilot/course_pilot", &DisplayRefs::coursePilot},
+    {"laminar/B738/autopilot/course_copilot", &DisplayRefs::courseCopilot},
+    {"laminar/B738/mcp/digit_A", &DisplayRefs::digitA},
+    {"laminar/B738/mcp/digit_8", &DisplayRefs::digit8},
+    {"laminar/B738/dspl_light_test", &DisplayRefs::dsplLightTest},
+};
+
 ZiboPAP3MCPProfile::ZiboPAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraftProfile(product) {
-    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/electric/panel_brightness", [this, product](std::vector<float> panelBrightness) {
+    displayRefs = internDisplayRefs(displayRefTable, displayDatarefs());
+
+    Dataref::getInstance()->monitorExistingDataref<std::span<const float>>("laminar/B738/electric/panel_brightness", [this, product](std::span<const float> panelBrightness) {
         if (panelBrightness.size() < 1) {
             return;
         }
@@ -30,16 +50,16 @@ ZiboPAP3MCPProfile::ZiboPAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraf
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
 
         product->setLedBrightness(PAP3MCPLed::LCD_BACKLIGHT, hasPower ? 180 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
-    Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/dspl_light_test", [this](std::vector<float> displayTest) {
+    Dataref::getInstance()->monitorExistingDataref<std::span<const float>>("laminar/B738/dspl_light_test", [this](std::span<const float> displayTest) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
 
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/autopilot/n1_status1");
@@ -60,12 +80,12 @@ ZiboPAP3MCPProfile::ZiboPAP3MCPProfile(ProductPAP3MCP *product) : PAP3MCPAircraf
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/autopilot/master_capt_status");
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/autopilot/master_fo_status");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/B738/electric/main_bus", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/avionics_on");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("laminar/B738/autopilot/n1_status1", [this, product](float status) {
         product->setLedBrightness(PAP3MCPLed::N1, status > 0.5f || isDisplayTestMode() ? 1 : 0);
@@ -163,23 +183,7 @@ bool ZiboPAP3MCPProfile::IsEligible() {
 }
 
 const std::vector<std::string> &ZiboPAP3MCPProfile::displayDatarefs() const {
-    static std::vector<std::string> datarefs = {
-        "sim/cockpit/electrical/avionics_on",
-        "laminar/B738/electric/panel_brightness",
-        "laminar/B738/electric/main_bus",
-        "laminar/B738/autopilot/mcp_speed_dial_kts_mach",
-        "sim/cockpit/autopilot/airspeed_is_mach",
-        "laminar/B738/autopilot/mcp_hdg_dial",
-        "laminar/B738/autopilot/mcp_alt_dial",
-        "sim/cockpit2/autopilot/vvi_dial_fpm",
-        "laminar/B738/autopilot/vvi_dial_show",
-        "laminar/B738/autopilot/show_ias",
-        "laminar/B738/autopilot/course_pilot",
-        "laminar/B738/autopilot/course_copilot",
-        "laminar/B738/mcp/digit_A",
-        "laminar/B738/mcp/digit_8",
-        "laminar/B738/dspl_light_test",
-    };
+    static const std::vector<std::string> datarefs = displayRefNames(displayRefTable);
     return datarefs;
 }
 
@@ -253,28 +257,28 @@ const std::vector<PAP3MCPEncoderDef> &ZiboPAP3MCPProfile::encoderDefs() const {
 void ZiboPAP3MCPProfile::updateDisplayData(PAP3MCPDisplayData &data) {
     auto dataref = Dataref::getInstance();
     data.showLabels = false; // Zibo MCP does not have labels on the display
-    data.speed = dataref->getCached<float>("laminar/B738/autopilot/mcp_speed_dial_kts_mach");
+    data.speed = dataref->getCached<float>(displayRefs.mcpSpeedDialKtsMach);
     // MCP speed window mode. laminar/B738/mcp/digit_A is the 'A' glyph, NOT the
     // IAS/MACH selector; use the authoritative airspeed_is_mach flag so a mach
     // value (e.g. 0.78) is rendered as ".78" rather than rounded to IAS "01".
-    data.spdMach = dataref->getCached<int>("sim/cockpit/autopilot/airspeed_is_mach") != 0;
-    data.heading = dataref->getCached<int>("laminar/B738/autopilot/mcp_hdg_dial");
-    data.altitude = dataref->getCached<int>("laminar/B738/autopilot/mcp_alt_dial");
-    data.verticalSpeed = dataref->getCached<float>("sim/cockpit2/autopilot/vvi_dial_fpm");
-    data.verticalSpeedVisible = dataref->getCached<bool>("laminar/B738/autopilot/vvi_dial_show");
-    data.speedVisible = dataref->getCached<bool>("laminar/B738/autopilot/show_ias");
-    data.crsCapt = dataref->getCached<int>("laminar/B738/autopilot/course_pilot");
-    data.crsFo = dataref->getCached<int>("laminar/B738/autopilot/course_copilot");
+    data.spdMach = dataref->getCached<int>(displayRefs.airspeedIsMach) != 0;
+    data.heading = dataref->getCached<int>(displayRefs.mcpHdgDial);
+    data.altitude = dataref->getCached<int>(displayRefs.mcpAltDial);
+    data.verticalSpeed = dataref->getCached<float>(displayRefs.vviDialFpm);
+    data.verticalSpeedVisible = dataref->getCached<bool>(displayRefs.vviDialShow);
+    data.speedVisible = dataref->getCached<bool>(displayRefs.showIas);
+    data.crsCapt = dataref->getCached<int>(displayRefs.coursePilot);
+    data.crsFo = dataref->getCached<int>(displayRefs.courseCopilot);
 
     // Special display digits
-    data.digitA = dataref->getCached<bool>("laminar/B738/mcp/digit_A");
-    data.digitB = dataref->getCached<bool>("laminar/B738/mcp/digit_8");
+    data.digitA = dataref->getCached<bool>(displayRefs.digitA);
+    data.digitB = dataref->getCached<bool>(displayRefs.digit8);
 
     // Display test mode (all segments lit when test mode is 1, no segments when 2)
-    std::vector<float> displayTest = dataref->getCached<std::vector<float>>("laminar/B738/dspl_light_test");
+    std::span<const float> displayTest = dataref->getCachedArray<float>(displayRefs.dsplLightTest);
     uint8_t displayTestMode = static_cast<uint8_t>(displayTest.size() > 0 ? displayTest[0] : 0.0f);
     data.displayTest = displayTestMode >= 1;
-    data.displayEnabled = displayTestMode != 2 && dataref->getCached<bool>("sim/cockpit/electrical/avionics_on");
+    data.displayEnabled = displayTestMode != 2 && dataref->getCached<bool>(displayRefs.avionicsOn);
 }
 
 void ZiboPAP3MCPProfile::buttonPressed(const PAP3MCPButtonDef *button, XPLMCommandPhase phase) {
@@ -426,7 +430,7 @@ void ZiboPAP3MCPProfile::handleSwitchChanged(uint8_t byteOffset, uint8_t bitMask
 }
 
 bool ZiboPAP3MCPProfile::isDisplayTestMode() {
-    std::vector<float> displayTest = Dataref::getInstance()->getCached<std::vector<float>>("laminar/B738/dspl_light_test");
+    std::span<const float> displayTest = Dataref::getInstance()->getCachedArray<float>("laminar/B738/dspl_light_test");
     uint8_t displayTestMode = static_cast<uint8_t>(displayTest.size() > 0 ? displayTest[0] : 0.0f);
     return displayTestMode > 0;
 }
@@ -1,6 +1,7 @@
 #ifndef ZIBO_PAP3MCP_PROFILE_H
 #define ZIBO_PAP3MCP_PROFILE_H
 
+#include "dataref.h"
 #include "pap3-mcp-aircraft-profile.h"
 
 #include <map>
@@ -19,6 +20,23 @@ class ZiboPAP3MCPProfile : public PAP3MCPAircraftProfile {
         bool hwFDFoOn = false;
         bool hwATOn = false;
         bool hwApDiscEngaged = false;
+        struct DisplayRefs {
+                DatarefId mcpSpeedDialKtsMach;
+                DatarefId airspeedIsMach;
+                DatarefId mcpHdgDial;
+                DatarefId mcpAltDial;
+                DatarefId vviDialFpm;
+                DatarefId vviDialShow;
+                DatarefId showIas;
+                DatarefId coursePilot;
+                DatarefId courseCopilot;
+                DatarefId digitA;
+                DatarefId digit8;
+                DatarefId dsplLightTest;
+                DatarefId avionicsOn;
+        };
+        DisplayRefs displayRefs;
+        static const DisplayRef<DisplayRefs> displayRefTable[];
 
     public:
         ZiboPAP3MCPProfile(ProductPAP3MCP *product);
@@ -3,6 +3,7 @@
 #include "appstate.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/ff777-pdc-profile.h"
 #include "profiles/fps748-pdc-profile.h"
 #include "profiles/xcrafts-ejets-pdc-profile.h"
@@ -12,13 +13,22 @@
 #include <algorithm>
 #include <cmath>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using PDCProfiles = ProfileRegistry<ProductPDC, PDCAircraftProfile,
+    FPS748PDCProfile,
+    XCraftsErjPDCProfile,
+    XCraftsEjetsPDCProfile,
+    ZiboPDCProfile,
+    FF777PDCProfile>;
+
 ProductPDC::ProductPDC(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName, PDCDeviceVariant variant, unsigned char identifierByte) : USBDevice(hidDevice, vendorId, productId, vendorName, productName), identifierByte(identifierByte), deviceVariant(variant) {
     profile = nullptr;
     menuItemId = -1;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -43,27 +53,29 @@ const char *ProductPDC::activeProfileName() const {
 }
 
 void ProductPDC::setProfileForCurrentAircraft() {
-    if (FPS748PDCProfile::IsEligible()) {
-        profile = new FPS748PDCProfile(this);
-        profileReady = true;
-    } else if (XCraftsErjPDCProfile::IsEligible()) {
-        profile = new XCraftsErjPDCProfile(this);
-        profileReady = true;
-    } else if (XCraftsEjetsPDCProfile::IsEligible()) {
-        profile = new XCraftsEjetsPDCProfile(this);
-        profileReady = true;
-    } else if (ZiboPDCProfile::IsEligible()) {
-        profile = new ZiboPDCProfile(this);
-        profileReady = true;
-    } else if (FF777PDCProfile::IsEligible()) {
-        profile = new FF777PDCProfile(this);
-        profileReady = true;
-    } else {
+    profile = PDCProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductPDC::unloadProfile() {
+    profileReady = false;
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductPDC::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(PDCLed::BACKLIGHT, 128);
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductPDC::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -95,7 +107,7 @@ void ProductPDC::blackout() {
 }
 
 void ProductPDC::setLedBrightness(PDCLed led, uint8_t brightness) {
-    writeData({0x02, identifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, identifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(identifierByte, 0xBB, static_cast<uint8_t>(led)));
 }
 
 void ProductPDC::update() {
@@ -140,20 +152,13 @@ void ProductPDC::didReceiveData(int reportId, uint8_t *report, int reportLength)
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductPDC::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -183,14 +188,14 @@ void ProductPDC::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, ui
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
@@ -4,8 +4,6 @@
 #include "pdc-aircraft-profile.h"
 #include "usbdevice.h"
 
-#include <set>
-
 enum class PDCLed : int {
     BACKLIGHT = 0
 };
@@ -16,7 +14,7 @@ class ProductPDC : public USBDevice {
         int menuItemId;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
-        std::set<int> pressedButtonIndices;
+        ButtonStates pressedButtonIndices;
 
         void setProfileForCurrentAircraft();
 
@@ -30,6 +28,8 @@ class ProductPDC : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
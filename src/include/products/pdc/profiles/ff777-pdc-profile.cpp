@@ -15,7 +15,7 @@ FF777PDCProfile::FF777PDCProfile(ProductPDC *product) : PDCAircraftProfile(produ
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // We abuse the GPU hatch dataref to trigger an update when the UI is closed.
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/anim/hatchGPU", [product](bool gpuHatchOpen) {
@@ -26,12 +26,12 @@ FF777PDCProfile::FF777PDCProfile(ProductPDC *product) : PDCAircraftProfile(produ
     Dataref::getInstance()->monitorExistingDataref<bool>("1-sim/output/mcp/ok", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/ckpt/lights/glareshield");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("1-sim/ckpt/indLightTestSwitch/anim", [this, product](int isTest) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("1-sim/output/mcp/ok");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool FF777PDCProfile::IsEligible() {
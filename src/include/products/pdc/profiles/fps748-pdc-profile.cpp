@@ -17,12 +17,12 @@ FPS748PDCProfile::FPS748PDCProfile(ProductPDC *product) : PDCAircraftProfile(pro
         product->setLedBrightness(PDCLed::BACKLIGHT, backlight);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>((altPrefix + "/Elec/bus_1_powered").c_str(), [altPrefix](bool) {
         Dataref::getInstance()->executeChangedCallbacksForDataref((altPrefix + "/LGT/glaresheld_sw").c_str());
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool FPS748PDCProfile::IsSSGVersion() {
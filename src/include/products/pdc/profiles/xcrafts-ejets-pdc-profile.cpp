@@ -14,7 +14,7 @@ XCraftsEjetsPDCProfile::XCraftsEjetsPDCProfile(ProductPDC *product) : PDCAircraf
         product->setLedBrightness(PDCLed::BACKLIGHT, target);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool XCraftsEjetsPDCProfile::IsEligible() {
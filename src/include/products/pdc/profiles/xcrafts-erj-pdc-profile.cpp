@@ -17,7 +17,7 @@ XCraftsErjPDCProfile::XCraftsErjPDCProfile(ProductPDC *product) : PDCAircraftPro
         product->setLedBrightness(PDCLed::BACKLIGHT, target);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 }
 
 bool XCraftsErjPDCProfile::IsEligible() {
@@ -3,6 +3,7 @@
 #include "appstate.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/ff777-rmp-profile.h"
 #include "profiles/toliss-rmp-profile.h"
 #include "profiles/zibo-rmp-profile.h"
@@ -11,14 +12,20 @@
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using RMPProfiles = ProfileRegistry<ProductRMP, RMPAircraftProfile,
+    ZiboRMPProfile,
+    TolissRMPProfile,
+    FF777RMPProfile>;
+
 ProductRMP::ProductRMP(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
-    pressedButtonIndices = {};
-    lastUpdateCycle = 0;
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -67,27 +74,41 @@ const char *ProductRMP::activeProfileName() const {
 }
 
 void ProductRMP::setProfileForCurrentAircraft() {
-    if (ZiboRMPProfile::IsEligible()) {
-        profile = new ZiboRMPProfile(this);
-        profileReady = true;
-    } else if (TolissRMPProfile::IsEligible()) {
-        profile = new TolissRMPProfile(this);
-        profileReady = true;
-    } else if (FF777RMPProfile::IsEligible()) {
-        profile = new FF777RMPProfile(this);
-        profileReady = true;
-    } else {
+    displaySubscription.reset();
+
+    profile = RMPProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductRMP::unloadProfile() {
+    profileReady = false;
+    displaySubscription.reset();
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductRMP::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(RMPLed::BACKLIGHT, 128);
+    setLedBrightness(RMPLed::LCD_BRIGHTNESS, 128);
+    setLedBrightness(RMPLed::OVERALL_LEDS_BRIGHTNESS, 255);
+    setAllLedsEnabled(false);
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductRMP::connect() {
     if (!USBDevice::connect()) {
         return false;
     }
 
-    lastUpdateCycle = 0;
+    displaySubscription.reset();
     lastLedBrightness.clear();
 
     setLedBrightness(RMPLed::BACKLIGHT, 128);
@@ -171,8 +192,7 @@ void ProductRMP::update() {
 
     USBDevice::update();
 
-    if (++displayUpdateFrameCounter >= getDisplayUpdateFrameInterval(12)) {
-        displayUpdateFrameCounter = 0;
+    if (isDisplayUpdateDue(std::chrono::milliseconds(200))) {
         updateDisplays(false);
     }
 }
@@ -182,21 +202,14 @@ void ProductRMP::updateDisplays(bool force) {
         return;
     }
 
-    bool shouldUpdate = force;
-    auto datarefManager = Dataref::getInstance();
-    for (const std::string &dataref : profile->displayDatarefs()) {
-        if (!lastUpdateCycle || datarefManager->getCachedLastUpdate(dataref.c_str()) > lastUpdateCycle) {
-            shouldUpdate = true;
-            break;
-        }
-    }
+    bool shouldUpdate = force || displaySubscription.hasChanges(profile->displayDatarefs());
 
     if (!shouldUpdate) {
         return;
     }
 
     profile->updateDisplays();
-    lastUpdateCycle = XPLMGetCycleNumber();
+    displaySubscription.acknowledge();
 }
 
 void ProductRMP::setDeviceVariant(RMPDeviceVariant variant) {
@@ -248,7 +261,7 @@ void ProductRMP::setLedBrightness(RMPLed led, uint8_t brightness) {
     }
     lastLedBrightness[ledInt] = brightness;
 
-    writeData({0x02, ProductRMP::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, ProductRMP::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductRMP::IdentifierByte, 0xBB, static_cast<uint8_t>(led)));
 }
 
 void ProductRMP::parseSegment(const std::string &text, int expectedLength, std::string &outDigits, uint16_t &colonMask, int digitOffset) {
@@ -319,20 +332,20 @@ void ProductRMP::setDisplayText(const std::string &active, const std::string &st
         packet[digitIndex + byteOffset] = charMask;
     }
 
-    writeData(packet);
+    writeData(packet, WriteLane::INTERACTIVE);
 
     std::vector<uint8_t> commitPacket = {
         0xF0, 0x00, packetNumber, 0x11, ProductRMP::IdentifierByte,
         0xBB, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00};
     commitPacket.resize(64, 0x00);
-    writeData(commitPacket);
+    writeData(commitPacket, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
 }
 
 void ProductRMP::forceStateSync() {
-    pressedButtonIndices.clear();
+    pressedButtonIndices.reset();
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
 
@@ -361,20 +374,13 @@ void ProductRMP::didReceiveData(int reportId, uint8_t *report, int reportLength)
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductRMP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -400,14 +406,14 @@ void ProductRMP::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, ui
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
@@ -1,10 +1,10 @@
 #ifndef PRODUCT_RMP_H
 #define PRODUCT_RMP_H
 
+#include "dataref.h"
 #include "rmp-aircraft-profile.h"
 #include "usbdevice.h"
 
-#include <set>
 #include <string>
 #include <unordered_map>
 
@@ -41,13 +41,12 @@ class ProductRMP : public USBDevice {
     private:
         RMPAircraftProfile *profile;
         int menuItemId;
-        int displayUpdateFrameCounter = 0;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
-        std::set<int> pressedButtonIndices;
+        ButtonStates pressedButtonIndices;
         uint8_t packetNumber = 1;
 
-        int lastUpdateCycle = 0;
+        DatarefSubscription displaySubscription;
         std::unordered_map<int, uint8_t> lastLedBrightness;
         std::string cachedActiveDisplay;
         std::string cachedStbyDisplay;
@@ -67,6 +66,8 @@ class ProductRMP : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void updateDisplays(bool force = false);
         void blackout() override;
@@ -69,7 +69,7 @@ FF777RMPProfile::FF777RMPProfile(ProductRMP *product) : RMPAircraftProfile(produ
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         updateDisplays();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 }
 
 bool FF777RMPProfile::IsEligible() {
@@ -61,18 +61,18 @@ TolissRMPProfile::TolissRMPProfile(ProductRMP *product) : RMPAircraftProfile(pro
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<int>(rmpAvailRef.c_str(), [](int available) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         updateDisplays();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     std::string lightsRef = std::string("AirbusFBW/") + rmpName() + "Lights_Raw";
 
@@ -99,12 +99,12 @@ TolissRMPProfile::TolissRMPProfile(ProductRMP *product) : RMPAircraftProfile(pro
     std::string activeRef = std::string("AirbusFBW/") + rmpName() + "/ActiveWindowString";
     std::string stbyRef = std::string("AirbusFBW/") + rmpName() + "/StandbyWindowString";
 
-    Dataref::getInstance()->monitorExistingDataref<std::string>(activeRef.c_str(), [this](std::string s) {
+    Dataref::getInstance()->monitorExistingDataref<std::string_view>(activeRef.c_str(), [this](std::string_view s) {
         updateDisplays();
     },
         this);
 
-    Dataref::getInstance()->monitorExistingDataref<std::string>(stbyRef.c_str(), [this](std::string s) {
+    Dataref::getInstance()->monitorExistingDataref<std::string_view>(stbyRef.c_str(), [this](std::string_view s) {
         updateDisplays();
     },
         this);
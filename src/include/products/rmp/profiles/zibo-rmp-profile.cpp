@@ -72,13 +72,13 @@ ZiboRMPProfile::ZiboRMPProfile(ProductRMP *product) : RMPAircraftProfile(product
 
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
         updateDisplays();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     // Button LEDs driven by the selected-mode status datarefs on this panel.
     std::vector<std::pair<RMPLed, std::string>> ledRefs = {
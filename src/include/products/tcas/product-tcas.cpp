@@ -4,6 +4,7 @@
 #include "config.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/fps748-tcas-profile.h"
 #include "profiles/pa28-tcas-profile.h"
 #include "profiles/rotatemd11-tcas-profile.h"
@@ -19,13 +20,24 @@
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using TCASProfiles = ProfileRegistry<ProductTCAS, TCASAircraftProfile,
+    FPS748TCASProfile,
+    RotateMD11TCASProfile,
+    SparkyB744TCASProfile,
+    XCraftsERJTCASProfile,
+    ZiboTCASProfile,
+    TolissTCASProfile,
+    PA28TCASProfile>;
+
 ProductTCAS::ProductTCAS(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -50,33 +62,35 @@ const char *ProductTCAS::activeProfileName() const {
 }
 
 void ProductTCAS::setProfileForCurrentAircraft() {
-    if (FPS748TCASProfile::IsEligible()) {
-        profile = new FPS748TCASProfile(this);
-        profileReady = true;
-    } else if (RotateMD11TCASProfile::IsEligible()) {
-        profile = new RotateMD11TCASProfile(this);
-        profileReady = true;
-    } else if (SparkyB744TCASProfile::IsEligible()) {
-        profile = new SparkyB744TCASProfile(this);
-        profileReady = true;
-    } else if (XCraftsERJTCASProfile::IsEligible()) {
-        profile = new XCraftsERJTCASProfile(this);
-        profileReady = true;
-    } else if (ZiboTCASProfile::IsEligible()) {
-        profile = new ZiboTCASProfile(this);
-        profileReady = true;
-    } else if (TolissTCASProfile::IsEligible()) {
-        profile = new TolissTCASProfile(this);
-        profileReady = true;
-    } else if (PA28TCASProfile::IsEligible()) {
-        profile = new PA28TCASProfile(this);
-        profileReady = true;
-    } else {
+    displaySubscription.reset();
+
+    profile = TCASProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductTCAS::unloadProfile() {
+    profileReady = false;
+    displaySubscription.reset();
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductTCAS::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(TCASLed::BACKLIGHT, 128);
+    setLedBrightness(TCASLed::LCD_BRIGHTNESS, 128);
+    setLedBrightness(TCASLed::OVERALL_LEDS_BRIGHTNESS, 255);
+    setAllLedsEnabled(false);
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductTCAS::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -122,8 +136,7 @@ void ProductTCAS::update() {
 
     USBDevice::update();
 
-    if (++displayUpdateFrameCounter >= getDisplayUpdateFrameInterval(12)) {
-        displayUpdateFrameCounter = 0;
+    if (isDisplayUpdateDue(std::chrono::milliseconds(200))) {
         updateDisplays();
     }
 }
@@ -133,21 +146,14 @@ void ProductTCAS::updateDisplays(bool force) {
         return;
     }
 
-    bool shouldUpdate = force;
-    auto datarefManager = Dataref::getInstance();
-    for (const std::string &dataref : profile->displayDatarefs()) {
-        if (!lastUpdateCycle || datarefManager->getCachedLastUpdate(dataref.c_str()) > lastUpdateCycle) {
-            shouldUpdate = true;
-            break;
-        }
-    }
+    bool shouldUpdate = force || displaySubscription.hasChanges(profile->displayDatarefs());
 
     if (!shouldUpdate) {
         return;
     }
 
     profile->updateDisplays();
-    lastUpdateCycle = XPLMGetCycleNumber();
+    displaySubscription.acknowledge();
 }
 
 void ProductTCAS::setAllLedsEnabled(bool enable) {
@@ -161,7 +167,7 @@ void ProductTCAS::setAllLedsEnabled(bool enable) {
 }
 
 void ProductTCAS::setLedBrightness(TCASLed led, uint8_t brightness) {
-    writeData({0x02, ProductTCAS::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, ProductTCAS::IdentifierByte, 0xBB, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductTCAS::IdentifierByte, 0xBB, static_cast<uint8_t>(led)));
 }
 
 void ProductTCAS::setLCDText(const std::string &squawkCode) {
@@ -190,13 +196,13 @@ void ProductTCAS::setLCDText(const std::string &squawkCode) {
         }
     }
 
-    writeData(packet);
+    writeData(packet, WriteLane::INTERACTIVE);
 
     std::vector<uint8_t> commitPacket = {
         0xF0, 0x00, packetNumber, 0x11, ProductTCAS::IdentifierByte,
         0xBB, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00};
     commitPacket.resize(64, 0x00);
-    writeData(commitPacket);
+    writeData(commitPacket, WriteLane::INTERACTIVE);
     if (++packetNumber == 0) {
         packetNumber = 1;
     }
@@ -224,20 +230,13 @@ void ProductTCAS::didReceiveData(int reportId, uint8_t *report, int reportLength
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductTCAS::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -263,14 +262,14 @@ void ProductTCAS::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, u
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
@@ -1,11 +1,10 @@
 #ifndef PRODUCT_TCAS_H
 #define PRODUCT_TCAS_H
 
+#include "dataref.h"
 #include "tcas-aircraft-profile.h"
 #include "usbdevice.h"
 
-#include <set>
-
 enum class TCASLed : int {
     BACKLIGHT = 0,
     LCD_BRIGHTNESS = 1,
@@ -20,12 +19,11 @@ class ProductTCAS : public USBDevice {
     private:
         TCASAircraftProfile *profile;
         int menuItemId;
-        int displayUpdateFrameCounter = 0;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
-        std::set<int> pressedButtonIndices;
+        ButtonStates pressedButtonIndices;
         uint8_t packetNumber = 1;
-        uint64_t lastUpdateCycle = 0;
+        DatarefSubscription displaySubscription;
 
         void setProfileForCurrentAircraft();
 
@@ -38,6 +36,8 @@ class ProductTCAS : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
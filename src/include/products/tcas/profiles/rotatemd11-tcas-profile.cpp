@@ -17,12 +17,12 @@ RotateMD11TCASProfile::RotateMD11TCASProfile(ProductTCAS *product) : TCASAircraf
         product->setLedBrightness(TCASLed::LCD_BRIGHTNESS, hasPower ? 255 : 0);
         product->setLedBrightness(TCASLed::OVERALL_LEDS_BRIGHTNESS, hasPower ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("Rotate/aircraft/systems/light_fgs_panel_brt_ratio", [](float) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("Rotate/aircraft/systems/elec_dc_batt_bus_pwrd");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool RotateMD11TCASProfile::IsEligible() {
@@ -94,7 +94,7 @@ void RotateMD11TCASProfile::updateDisplays() {
         return;
     }
 
-    auto code = Dataref::getInstance()->getCached<std::vector<int>>("Rotate/aircraft/systems/atc_active_code");
+    std::span<const int> code = Dataref::getInstance()->getCachedArray<int>("Rotate/aircraft/systems/atc_active_code");
     if (code.empty()) {
         product->setLCDText("0000");
         return;
@@ -13,7 +13,7 @@ SparkyB744TCASProfile::SparkyB744TCASProfile(ProductTCAS *product) : TCASAircraf
         product->setLedBrightness(TCASLed::LCD_BRIGHTNESS, powered ? 255 : 0);
         product->setLedBrightness(TCASLed::OVERALL_LEDS_BRIGHTNESS, powered ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/avionics_on");
 }
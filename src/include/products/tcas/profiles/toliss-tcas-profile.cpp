@@ -1,5 +1,6 @@
 #include "toliss-tcas-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-tcas.h"
@@ -36,7 +37,7 @@ TolissTCASProfile::TolissTCASProfile(ProductTCAS *product) : TCASAircraftProfile
         {23, {"TCAS MODE TA/RA", "AirbusFBW/XPDRPower", TCASDatarefType::SET_VALUE, 4}},
     };
 
-    std::string icao = Dataref::getInstance()->getCached<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
     if (icao == "A339" || icao == "A346") {
         buttons[11] = {"XPDR AUTO", "AirbusFBW/XPDRPower", TCASDatarefType::SET_VALUE, 1};
         buttons[12] = {"XPDR ON", "AirbusFBW/XPDRPower", TCASDatarefType::SET_VALUE, 2};
@@ -59,19 +60,19 @@ TolissTCASProfile::TolissTCASProfile(ProductTCAS *product) : TCASAircraftProfile
         product->setLedBrightness(TCASLed::LCD_BRIGHTNESS, hasEssentialBusPower ? 255 : 0);
         product->setLedBrightness(TCASLed::OVERALL_LEDS_BRIGHTNESS, hasEssentialBusPower ? 255 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("AirbusFBW/FCUAvail", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/AnnunMode");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [](bool poweredOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/PanelBrightnessLevel");
         Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/AnnunMode");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<int>("AirbusFBW/AnnunMode", [this, product](int annunMode) {
         // Dataref::getInstance()->executeChangedCallbacksForDataref("AirbusFBW/OHPLightsATA32_Raw");
@@ -79,7 +80,7 @@ TolissTCASProfile::TolissTCASProfile(ProductTCAS *product) : TCASAircraftProfile
         product->setLedBrightness(TCASLed::ATC_FAIL, isAnnunTest() ? 255 : 0);
         updateDisplays();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     // Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("AirbusFBW/OHPLightsATA32_Raw", [this, product](const std::vector<float> &panelLights) {
     //     if (panelLights.size() < 18) {
@@ -3,6 +3,7 @@
 #include "appstate.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "profiles/ff777-ursa-minor-throttle-profile.h"
 #include "profiles/pa28-ursa-minor-throttle-profile.h"
 #include "profiles/rotatemd11-ursa-minor-throttle-profile.h"
@@ -15,13 +16,24 @@
 #include <algorithm>
 #include <cmath>
 
+// Aircraft profiles in priority order; the first eligible one wins.
+using UrsaMinorThrottleProfiles = ProfileRegistry<ProductUrsaMinorThrottle, UrsaMinorThrottleAircraftProfile,
+    TolissUrsaMinorThrottleProfile,
+    RotateMD11UrsaMinorThrottleProfile,
+    XCraftsErjUrsaMinorThrottleProfile,
+    XCraftsEjetsUrsaMinorThrottleProfile,
+    FF777UrsaMinorThrottleProfile,
+    ZiboUrsaMinorThrottleProfile,
+    PA28UrsaMinorThrottleProfile>;
+
 ProductUrsaMinorThrottle::ProductUrsaMinorThrottle(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) : USBDevice(hidDevice, vendorId, productId, vendorName, productName) {
     profile = nullptr;
     menuItemId = -1;
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
-    pressedButtonIndices = {};
+    pressedButtonIndices.reset();
 
+    setInputReportLayout({.reportId = 1, .minLength = 13, .buttonOffset = 1, .buttonLength = 12});
     connect();
 }
 
@@ -46,33 +58,31 @@ const char *ProductUrsaMinorThrottle::activeProfileName() const {
 }
 
 void ProductUrsaMinorThrottle::setProfileForCurrentAircraft() {
-    if (TolissUrsaMinorThrottleProfile::IsEligible()) {
-        profile = new TolissUrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else if (RotateMD11UrsaMinorThrottleProfile::IsEligible()) {
-        profile = new RotateMD11UrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else if (XCraftsErjUrsaMinorThrottleProfile::IsEligible()) {
-        profile = new XCraftsErjUrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else if (XCraftsEjetsUrsaMinorThrottleProfile::IsEligible()) {
-        profile = new XCraftsEjetsUrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else if (FF777UrsaMinorThrottleProfile::IsEligible()) {
-        profile = new FF777UrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else if (ZiboUrsaMinorThrottleProfile::IsEligible()) {
-        profile = new ZiboUrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else if (PA28UrsaMinorThrottleProfile::IsEligible()) {
-        profile = new PA28UrsaMinorThrottleProfile(this);
-        profileReady = true;
-    } else {
+    profile = UrsaMinorThrottleProfiles::create(this);
+    profileReady = profile != nullptr;
+}
+
+void ProductUrsaMinorThrottle::unloadProfile() {
+    profileReady = false;
+
+    if (profile) {
+        delete profile;
         profile = nullptr;
-        profileReady = false;
     }
 }
 
+void ProductUrsaMinorThrottle::loadProfileForCurrentAircraft() {
+    if (profile) {
+        return;
+    }
+
+    setLedBrightness(UrsaMinorThrottleLed::BACKLIGHT, 128);
+    setLedBrightness(UrsaMinorThrottleLed::OVERALL_LEDS_AND_LCD_BRIGHTNESS, 255);
+    setAllLedsEnabled(false);
+
+    setProfileForCurrentAircraft();
+}
+
 bool ProductUrsaMinorThrottle::connect() {
     if (!USBDevice::connect()) {
         return false;
@@ -177,10 +187,10 @@ void ProductUrsaMinorThrottle::setAllLedsEnabled(bool enable) {
 }
 
 void ProductUrsaMinorThrottle::setLedBrightness(UrsaMinorThrottleLed led, uint8_t brightness) {
-    writeData({0x02, ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+    writeData({0x02, ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, static_cast<uint8_t>(led)));
 
     if (led < UrsaMinorThrottleLed::_START) {
-        writeData({0x02, ProductUrsaMinorThrottle::PACIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00});
+        writeData({0x02, ProductUrsaMinorThrottle::PACIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, static_cast<uint8_t>(led), brightness, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductUrsaMinorThrottle::PACIdentifierByte, 0xB9, static_cast<uint8_t>(led)));
     }
 }
 
@@ -190,11 +200,11 @@ void ProductUrsaMinorThrottle::setVibration(uint8_t vibration, bool leftSide, bo
     }
 
     if (leftSide) {
-        writeData({0x02, ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, 0x0E, vibration, 0x00, 0x00, 0x00, 0x00, 0x00});
+        writeData({0x02, ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, 0x0E, vibration, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x0E));
     }
 
     if (rightSide) {
-        writeData({0x02, ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, 0x10, vibration, 0x00, 0x00, 0x00, 0x00, 0x00});
+        writeData({0x02, ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x00, 0x00, 0x03, 0x49, 0x10, vibration, 0x00, 0x00, 0x00, 0x00, 0x00}, USBWriteQueue::SlotKey(ProductUrsaMinorThrottle::ThrottleIdentifierByte, 0xB9, 0x10));
     }
 }
 
@@ -276,13 +286,13 @@ void ProductUrsaMinorThrottle::setLCDText(const std::string &text) {
         }
     }
 
-    writeData(packet);
+    writeData(packet, WriteLane::INTERACTIVE);
 
     std::vector<uint8_t> commitPacket = {
         0xF0, 0x00, packetNumber, 0x11, 0x01, 0xB9,
         0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00};
     commitPacket.resize(64, 0x00);
-    writeData(commitPacket);
+    writeData(commitPacket, WriteLane::INTERACTIVE);
 
     if (++packetNumber == 0) {
         packetNumber = 1;
@@ -290,7 +300,7 @@ void ProductUrsaMinorThrottle::setLCDText(const std::string &text) {
 }
 
 void ProductUrsaMinorThrottle::forceStateSync() {
-    pressedButtonIndices.clear();
+    pressedButtonIndices.reset();
     lastButtonStateLo = 0;
     lastButtonStateHi = 0;
 
@@ -327,20 +337,13 @@ void ProductUrsaMinorThrottle::didReceiveData(int reportId, uint8_t *report, int
         return;
     }
 
+    uint64_t previousLo = lastButtonStateLo;
+    uint32_t previousHi = lastButtonStateHi;
     lastButtonStateLo = buttonsLo;
     lastButtonStateHi = buttonsHi;
 
-    for (int i = 0; i < 96; ++i) {
-        bool pressed;
-
-        if (i < 64) {
-            pressed = (buttonsLo >> i) & 1;
-        } else {
-            pressed = (buttonsHi >> (i - 64)) & 1;
-        }
-
-        didReceiveButton(i, pressed);
-    }
+    didReceiveButtons(buttonsLo, previousLo);
+    didReceiveButtons(buttonsHi, previousHi, 64);
 }
 
 void ProductUrsaMinorThrottle::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count) {
@@ -365,14 +368,14 @@ void ProductUrsaMinorThrottle::didReceiveButton(uint16_t hardwareButtonIndex, bo
         return;
     }
 
-    bool pressedButtonIndexExists = pressedButtonIndices.find(hardwareButtonIndex) != pressedButtonIndices.end();
+    bool pressedButtonIndexExists = pressedButtonIndices[hardwareButtonIndex];
     if (pressed && !pressedButtonIndexExists) {
-        pressedButtonIndices.insert(hardwareButtonIndex);
+        pressedButtonIndices.set(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandBegin);
     } else if (pressed && pressedButtonIndexExists) {
         profile->buttonPressed(buttonDef, xplm_CommandContinue);
     } else if (!pressed && pressedButtonIndexExists) {
-        pressedButtonIndices.erase(hardwareButtonIndex);
+        pressedButtonIndices.reset(hardwareButtonIndex);
         profile->buttonPressed(buttonDef, xplm_CommandEnd);
     }
 }
@@ -4,8 +4,6 @@
 #include "ursa-minor-throttle-aircraft-profile.h"
 #include "usbdevice.h"
 
-#include <set>
-
 enum class UrsaMinorThrottleLed : int {
     BACKLIGHT = 0,
     OVERALL_LEDS_AND_LCD_BRIGHTNESS = 2,
@@ -24,7 +22,7 @@ class ProductUrsaMinorThrottle : public USBDevice {
         int menuItemId;
         uint64_t lastButtonStateLo;
         uint32_t lastButtonStateHi;
-        std::set<int> pressedButtonIndices;
+        ButtonStates pressedButtonIndices;
         uint8_t packetNumber = 1;
 
         int lastVibration = 0;
@@ -44,6 +42,8 @@ class ProductUrsaMinorThrottle : public USBDevice {
         const char *classIdentifier() override;
         const char *activeProfileName() const override;
         bool connect() override;
+        void unloadProfile() override;
+        void loadProfileForCurrentAircraft() override;
         void update() override;
         void blackout() override;
         void didReceiveData(int reportId, uint8_t *report, int reportLength) override;
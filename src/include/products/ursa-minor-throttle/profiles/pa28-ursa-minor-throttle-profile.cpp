@@ -1,5 +1,6 @@
 #include "pa28-ursa-minor-throttle-profile.h"
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "dataref.h"
 #include "product-ursa-minor-throttle.h"
@@ -30,19 +31,19 @@ PA28UrsaMinorThrottleProfile::PA28UrsaMinorThrottleProfile(ProductUrsaMinorThrot
         product->setLedBrightness(UrsaMinorThrottleLed::BACKLIGHT, backlight);
         product->setLedBrightness(UrsaMinorThrottleLed::OVERALL_LEDS_AND_LCD_BRIGHTNESS, screens);
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/battery_on", [](bool batteryOn) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Logger::getInstance()->info("Ursa Minor Throttle: PA28 profile active\n");
     Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit2/electrical/instrument_brightness_ratio");
 }
 
 bool PA28UrsaMinorThrottleProfile::IsEligible() {
-    std::string icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    const std::string &icao = AircraftIdentity::getInstance()->getICAO();
     return icao.starts_with("P28");
 }
 
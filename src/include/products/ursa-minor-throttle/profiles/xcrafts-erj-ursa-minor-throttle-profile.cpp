@@ -17,7 +17,7 @@ XCraftsErjUrsaMinorThrottleProfile::XCraftsErjUrsaMinorThrottleProfile(ProductUr
         product->setLedBrightness(UrsaMinorThrottleLed::OVERALL_LEDS_AND_LCD_BRIGHTNESS, target);
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("sim/cockpit2/annunciators/engine_fires", [product](const std::vector<float> &fires) {
         if (fires.size() < 2) {
@@ -26,7 +26,7 @@ XCraftsErjUrsaMinorThrottleProfile::XCraftsErjUrsaMinorThrottleProfile(ProductUr
         product->setLedBrightness(UrsaMinorThrottleLed::ENG_1_FIRE, fires[0] > std::numeric_limits<float>::epsilon() ? 1 : 0);
         product->setLedBrightness(UrsaMinorThrottleLed::ENG_2_FIRE, fires[1] > std::numeric_limits<float>::epsilon() ? 1 : 0);
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>("sim/flightmodel/controls/vstab2_rud1def", [this](float) {
         updateDisplays();
@@ -24,7 +24,7 @@ ZiboUrsaMinorThrottleProfile::ZiboUrsaMinorThrottleProfile(ProductUrsaMinorThrot
         updateDisplays();
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_5, kBacklightFilter);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("sim/cockpit/electrical/avionics_on", [this, product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
@@ -32,17 +32,17 @@ ZiboUrsaMinorThrottleProfile::ZiboUrsaMinorThrottleProfile(ProductUrsaMinorThrot
         updateDisplays();
         product->forceStateSync();
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<std::vector<float>>("laminar/B738/dspl_light_test", [this](const std::vector<float> &displayTest) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("laminar/B738/electric/panel_brightness");
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<bool>("laminar/B738/electric/main_bus", [product](bool hasPower) {
         Dataref::getInstance()->executeChangedCallbacksForDataref("sim/cockpit/electrical/avionics_on");
     },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     Dataref::getInstance()->monitorExistingDataref<float>("sim/flightmodel/controls/vstab2_rud1def", [this, product](float trimPosition) {
         updateDisplays();
@@ -53,13 +53,13 @@ ZiboUrsaMinorThrottleProfile::ZiboUrsaMinorThrottleProfile(ProductUrsaMinorThrot
         product->setLedBrightness(UrsaMinorThrottleLed::ENG_1_FAULT, 0);
         product->setLedBrightness(UrsaMinorThrottleLed::ENG_1_FIRE, brightness > std::numeric_limits<float>::epsilon());
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 
     Dataref::getInstance()->monitorExistingDataref<float>("laminar/B738/annunciator/engine2_fire", [this, product](float brightness) {
         product->setLedBrightness(UrsaMinorThrottleLed::ENG_2_FAULT, 0);
         product->setLedBrightness(UrsaMinorThrottleLed::ENG_2_FIRE, brightness > std::numeric_limits<float>::epsilon());
     },
-        this);
+        this, DatarefPollRate::HZ_5);
 }
 
 bool ZiboUrsaMinorThrottleProfile::IsEligible() {
@@ -0,0 +1,72 @@
+#include "aircraft-identity.h"
+
+#include "appstate.h"
+#include "dataref.h"
+
+#include <algorithm>
+
+namespace {
+    constexpr int kInitialRecheckDelayMilliseconds = 1000;
+    constexpr int kMaxRecheckDelayMilliseconds = 30000;
+}
+
+AircraftIdentity *AircraftIdentity::getInstance() {
+    static AircraftIdentity instance;
+    return &instance;
+}
+
+void AircraftIdentity::invalidate() {
+    AppState::getInstance()->cancelTasksForOwner(this);
+    recheckScheduled = false;
+    recheckDelayMilliseconds = kInitialRecheckDelayMilliseconds;
+    recheck();
+}
+
+void AircraftIdentity::recheck() {
+    Dataref::getInstance()->clearExistenceCache();
+    icao.clear();
+    author.clear();
+    descriptionLoaded = false;
+    generation++;
+}
+
+uint64_t AircraftIdentity::getGeneration() const {
+    return generation;
+}
+
+void AircraftIdentity::loadDescription() {
+    if (descriptionLoaded) {
+        return;
+    }
+
+    icao = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_ICAO");
+    author = Dataref::getInstance()->get<std::string>("sim/aircraft/view/acf_author");
+    descriptionLoaded = true;
+}
+
+const std::string &AircraftIdentity::getICAO() {
+    loadDescription();
+    return icao;
+}
+
+const std::string &AircraftIdentity::getAuthor() {
+    loadDescription();
+    return author;
+}
+
+void AircraftIdentity::scheduleRecheck() {
+    if (recheckScheduled) {
+        return;
+    }
+
+    if (recheckDelayMilliseconds <= 0) {
+        recheckDelayMilliseconds = kInitialRecheckDelayMilliseconds;
+    }
+
+    recheckScheduled = true;
+    AppState::getInstance()->executeAfter(recheckDelayMilliseconds, this, [this]() {
+        recheckScheduled = false;
+        recheckDelayMilliseconds = std::min(recheckDelayMilliseconds * 2, kMaxRecheckDelayMilliseconds);
+        recheck();
+    });
+}
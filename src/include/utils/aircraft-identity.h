@@ -0,0 +1,47 @@
+#ifndef AIRCRAFT_IDENTITY_H
+#define AIRCRAFT_IDENTITY_H
+
+#include <cstdint>
+#include <string>
+
+// Decides when the user's aircraft has to be identified again. Profiles'
+// IsEligible() checks go through Dataref::exists(), whose answers are cached,
+// and read the ICAO code and author from here. Both are re-evaluated only when the plane
+// is loaded, a plugin is enabled or registers datarefs, or a backoff timer
+// fires while some product is still without a profile.
+//
+// Products remember the generation of their last failed profile match and
+// only try again once getGeneration() moves on, instead of walking their
+// IsEligible() chain every frame.
+class AircraftIdentity {
+    private:
+        AircraftIdentity() = default;
+
+        uint64_t generation = 1;
+        std::string icao;
+        std::string author;
+        bool descriptionLoaded = false;
+        bool recheckScheduled = false;
+        int recheckDelayMilliseconds = 0;
+
+        void recheck();
+        void loadDescription();
+
+    public:
+        static AircraftIdentity *getInstance();
+
+        // Call on plane load, plugin enable and dataref registration. Drops
+        // every cached lookup and restarts the recheck backoff.
+        void invalidate();
+        uint64_t getGeneration() const;
+        const std::string &getICAO();
+        const std::string &getAuthor();
+
+        // Called by a product whose profile match failed. The identity is
+        // re-evaluated after a delay that doubles with every round that
+        // brings no event, up to 30 seconds; calls from several products
+        // within one round share the same timer.
+        void scheduleRecheck();
+};
+
+#endif
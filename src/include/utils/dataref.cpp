@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <iterator>
+#include <utility>
 #include <XPLMDisplay.h>
 #include <XPLMProcessing.h>
 #include <XPLMUtilities.h>
@@ -18,10 +20,231 @@ int handleCommandCallback(XPLMCommandRef inCommand, XPLMCommandPhase inPhase, vo
     return Dataref::getInstance()->_commandCallback(inCommand, inPhase, inRefcon);
 }
 
+template<typename T, typename Raw, Raw (*Getter)(XPLMDataRef)>
+static void readScalar(XPLMDataRef handle, T &out) {
+    Raw raw = Getter(handle);
+    if constexpr (std::is_same_v<T, bool>) {
+        out = raw > std::numeric_limits<Raw>::epsilon();
+    } else {
+        out = static_cast<T>(raw);
+    }
+}
+
+// The array readers resize into the caller's buffer, which only allocates when
+// the dataref grows beyond the capacity of a previous read.
+static void readIntArray(XPLMDataRef handle, std::vector<int> &out) {
+    int size = XPLMGetDatavi(handle, nullptr, 0, 0);
+    out.resize(std::max(size, 0));
+    int count = XPLMGetDatavi(handle, out.data(), 0, size);
+    if (count < size) {
+        out.resize(std::max(count, 0));
+    }
+}
+
+static void readFloatArray(XPLMDataRef handle, std::vector<float> &out) {
+    int size = XPLMGetDatavf(handle, nullptr, 0, 0);
+    out.resize(std::max(size, 0));
+    int count = XPLMGetDatavf(handle, out.data(), 0, size);
+    if (count < size) {
+        out.resize(std::max(count, 0));
+    }
+}
+
+static void readBytes(XPLMDataRef handle, std::vector<unsigned char> &out) {
+    int size = XPLMGetDatab(handle, nullptr, 0, 0);
+    out.resize(std::max(size, 0));
+    int count = XPLMGetDatab(handle, out.data(), 0, size);
+    if (count < size) {
+        out.resize(std::max(count, 0));
+    }
+}
+
+static void readString(XPLMDataRef handle, std::string &out) {
+    int size = XPLMGetDatab(handle, nullptr, 0, 0);
+    out.resize(std::max(size, 0));
+    int count = XPLMGetDatab(handle, out.data(), 0, size);
+    out.resize(std::clamp(count, 0, static_cast<int>(out.size())));
+    out.resize(strnlen(out.data(), out.size()));
+}
+
+template<typename T>
+static DatarefReader<T> readerFor(XPLMDataTypeID refType) {
+    if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
+                  std::is_same_v<T, double>) {
+        if ((refType & xplmType_Float) == xplmType_Float) {
+            return readScalar<T, float, XPLMGetDataf>;
+        } else if ((refType & xplmType_Double) == xplmType_Double) {
+            return readScalar<T, double, XPLMGetDatad>;
+        } else {
+            return readScalar<T, int, XPLMGetDatai>;
+        }
+    } else if constexpr (std::is_same_v<T, std::vector<int>>) {
+        return readIntArray;
+    } else if constexpr (std::is_same_v<T, std::vector<float>>) {
+        return readFloatArray;
+    } else if constexpr (std::is_same_v<T, std::vector<unsigned char>>) {
+        return readBytes;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return readString;
+    }
+}
+
+template<typename T>
+static bool hasChanged(const T &cached, const T &value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::fabs(cached - value) > std::numeric_limits<T>::epsilon();
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        return cached != value;
+    } else {
+        // Bitwise compare for arrays and strings: cheaper than element-wise
+        // operator==, and a float array holding NaN no longer reads as
+        // changed on every single frame.
+        return cached.size() != value.size() ||
+               memcmp(cached.data(), value.data(), value.size() * sizeof(typename T::value_type)) != 0;
+    }
+}
+
+static double quantise(double value, const DatarefFilter &filter) {
+    return filter.quantum > 0.0 ? std::round(value / filter.quantum) * filter.quantum : value;
+}
+
+// Ordered so that std::min() of element results gives the array's result.
+enum class FilterResult : unsigned char {
+    PASSED,
+    SUPPRESSED, // Held back, although it would have changed the delivered value
+    UNCHANGED   // Rounds back onto the delivered value
+};
+
+template<typename E>
+static FilterResult filterElement(E &delivered, E reading, signed char &moving, const DatarefFilter &filter, bool force) {
+    E quantised = static_cast<E>(quantise(static_cast<double>(reading), filter));
+    if (force) {
+        moving = 0;
+        delivered = quantised;
+        return FilterResult::PASSED;
+    }
+
+    double delta = static_cast<double>(reading) - static_cast<double>(delivered);
+    signed char direction = delta > 0.0 ? 1 : -1;
+    bool passed = moving == direction ? std::fabs(delta) > filter.exit : std::fabs(delta) > filter.enter;
+    if (!passed) {
+        if (moving != direction) {
+            // Turned back (or never moved): settled until a reading leaves the enter band
+            moving = 0;
+        }
+        return quantised != delivered ? FilterResult::SUPPRESSED : FilterResult::UNCHANGED;
+    }
+
+    moving = direction;
+    if (quantised == delivered) {
+        return FilterResult::UNCHANGED;
+    }
+    delivered = quantised;
+    return FilterResult::PASSED;
+}
+
+// Moves the monitor's delivered value towards the cached one. Arrays pass when
+// any element does; they only count as suppressed when no element passed.
+static FilterResult filterForMonitor(MonitorFilterState &state, const DataRefValueType &value, bool force) {
+    if (state.delivered.index() != value.index()) {
+        force = true;
+        state.delivered = value;
+    }
+    force = force || !state.primed;
+    state.primed = true;
+    return std::visit(
+        [&](const auto &reading) {
+            using T = std::decay_t<decltype(reading)>;
+            if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+                if (force) {
+                    state.moving.assign(1, 0);
+                }
+                return filterElement(std::get<T>(state.delivered), reading, state.moving[0], state.filter, force);
+            } else if constexpr (std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<float>>) {
+                T &delivered = std::get<T>(state.delivered);
+                if (force || delivered.size() != reading.size()) {
+                    force = true;
+                    delivered.resize(reading.size());
+                    state.moving.assign(reading.size(), 0);
+                }
+                FilterResult result = force ? FilterResult::PASSED : FilterResult::UNCHANGED;
+                for (size_t i = 0; i < reading.size(); ++i) {
+                    result = std::min(result, filterElement(delivered[i], reading[i], state.moving[i], state.filter, force));
+                }
+                return result;
+            } else {
+                state.delivered = reading;
+                return FilterResult::PASSED;
+            }
+        },
+        value);
+}
+
+template<typename T>
+static T cachedValueAs(const DataRefValueType &value) {
+    if (!std::holds_alternative<T>(value)) {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (std::holds_alternative<int>(value)) {
+                return std::get<int>(value) > 0;
+            } else if (std::holds_alternative<double>(value)) {
+                return std::get<double>(value) > std::numeric_limits<double>::epsilon();
+            } else if (std::holds_alternative<float>(value)) {
+                return std::get<float>(value) > std::numeric_limits<float>::epsilon();
+            }
+
+            return false;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return "";
+        } else if constexpr (std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<float>> ||
+                             std::is_same_v<T, std::vector<unsigned char>>) {
+            return {};
+        } else {
+            return 0;
+        }
+    }
+
+    return std::get<T>(value);
+}
+
+template<typename T>
+struct MonitoredStorage {
+        using type = T;
+};
+
+template<typename E>
+struct MonitoredStorage<std::span<const E>> {
+        using type = std::vector<E>;
+};
+
+template<>
+struct MonitoredStorage<std::string_view> {
+        using type = std::string;
+};
+
+static bool isMonitorCallbackLive(const DatarefSlot &slot, uint64_t callbackId) {
+    if (!slot.changeCallbacks) {
+        return false;
+    }
+
+    return std::any_of(slot.changeCallbacks->begin(), slot.changeCallbacks->end(), [callbackId](const TaggedMonitorCallback &tc) {
+        return tc.id == callbackId;
+    });
+}
+
 Dataref::Dataref() {
-    cachedValues = {};
-    refs = {};
+    slotIds = {};
+    slots = {};
+    nextCallbackId = 1;
+    pollPlansDirty = false;
+    pollStats = {};
+    snapshotsEnabled = false;
     mainThreadId = std::this_thread::get_id();
+
+    const double tierPeriods[kPolledTierCount] = {0.0, 1.0 / 20.0, 1.0 / 5.0, 1.0};
+    for (size_t i = 0; i < kPolledTierCount; ++i) {
+        pollTiers[i].periodSeconds = tierPeriods[i];
+        pollTiers[i].phase = 0.0;
+    }
 }
 
 Dataref::~Dataref() {
@@ -36,6 +259,31 @@ Dataref *Dataref::getInstance() {
     return instance;
 }
 
+DatarefId Dataref::intern(const char *ref) {
+    auto it = slotIds.find(ref);
+    if (it != slotIds.end()) {
+        return it->second;
+    }
+
+    DatarefId id = static_cast<DatarefId>(slots.size());
+    slots.push_back({
+        .name = ref,
+        .handle = nullptr,
+        .refType = xplmType_Unknown,
+        .polled = false,
+        .pollRate = DatarefPollRate::EVERY_FRAME,
+        .firstPollPending = false,
+        .refreshedCycleNumber = 0,
+        .cache = {},
+        .changeCallbacks = nullptr,
+        .callbackGeneration = 0,
+        .groups = {},
+        .snapshotPending = false,
+    });
+    slotIds.emplace(ref, id);
+    return id;
+}
+
 template void Dataref::createDataref<int>(
     const char *ref, int *value, bool writable = false, DatarefShouldChangeCallback<int> changeCallback = nullptr);
 template void Dataref::createDataref<bool>(
@@ -55,6 +303,11 @@ template<typename T>
 void Dataref::createDataref(const char *ref, T *value, bool writable, DatarefShouldChangeCallback<T> changeCallback) {
     unbind(ref);
 
+    auto existing = existenceCache.find(std::string_view(ref));
+    if (existing != existenceCache.end()) {
+        existenceCache.erase(existing);
+    }
+
     XPLMDataRef handle = nullptr;
     boundRefs[ref] = {handle, value, {{nullptr, [changeCallback](DataRefValueType newValue) -> bool {
                                            if (!changeCallback) {
@@ -223,31 +476,90 @@ void Dataref::createDataref(const char *ref, T *value, bool writable, DatarefSho
     boundRefs[ref].handle = handle;
 }
 
-template void Dataref::monitorExistingDataref<int>(const char *ref, DatarefMonitorChangedCallback<int> changeCallback, void *owner);
+template void Dataref::monitorExistingDataref<int>(const char *ref, DatarefMonitorChangedCallback<int> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 template void Dataref::monitorExistingDataref<bool>(
-    const char *ref, DatarefMonitorChangedCallback<bool> changeCallback, void *owner);
+    const char *ref, DatarefMonitorChangedCallback<bool> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 template void Dataref::monitorExistingDataref<float>(
-    const char *ref, DatarefMonitorChangedCallback<float> changeCallback, void *owner);
+    const char *ref, DatarefMonitorChangedCallback<float> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 template void Dataref::monitorExistingDataref<double>(
-    const char *ref, DatarefMonitorChangedCallback<double> changeCallback, void *owner);
+    const char *ref, DatarefMonitorChangedCallback<double> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 template void Dataref::monitorExistingDataref<std::string>(
-    const char *ref, DatarefMonitorChangedCallback<std::string> changeCallback, void *owner);
+    const char *ref, DatarefMonitorChangedCallback<std::string> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 template void Dataref::monitorExistingDataref<std::vector<float>>(
-    const char *ref, DatarefMonitorChangedCallback<std::vector<float>> changeCallback, void *owner);
+    const char *ref, DatarefMonitorChangedCallback<std::vector<float>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 template void Dataref::monitorExistingDataref<std::vector<int>>(
-    const char *ref, DatarefMonitorChangedCallback<std::vector<int>> changeCallback, void *owner);
+    const char *ref, DatarefMonitorChangedCallback<std::vector<int>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::span<const float>>(
+    const char *ref, DatarefMonitorChangedCallback<std::span<const float>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::span<const int>>(
+    const char *ref, DatarefMonitorChangedCallback<std::span<const int>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::span<const unsigned char>>(
+    const char *ref, DatarefMonitorChangedCallback<std::span<const unsigned char>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::string_view>(
+    const char *ref, DatarefMonitorChangedCallback<std::string_view> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+
+template void Dataref::monitorExistingDataref<int>(DatarefId id, DatarefMonitorChangedCallback<int> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<bool>(
+    DatarefId id, DatarefMonitorChangedCallback<bool> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<float>(
+    DatarefId id, DatarefMonitorChangedCallback<float> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<double>(
+    DatarefId id, DatarefMonitorChangedCallback<double> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::string>(
+    DatarefId id, DatarefMonitorChangedCallback<std::string> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::vector<float>>(
+    DatarefId id, DatarefMonitorChangedCallback<std::vector<float>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::vector<int>>(
+    DatarefId id, DatarefMonitorChangedCallback<std::vector<int>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::span<const float>>(
+    DatarefId id, DatarefMonitorChangedCallback<std::span<const float>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::span<const int>>(
+    DatarefId id, DatarefMonitorChangedCallback<std::span<const int>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::span<const unsigned char>>(
+    DatarefId id, DatarefMonitorChangedCallback<std::span<const unsigned char>> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
+template void Dataref::monitorExistingDataref<std::string_view>(
+    DatarefId id, DatarefMonitorChangedCallback<std::string_view> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter);
 
 template<typename T>
-void Dataref::monitorExistingDataref(const char *ref, DatarefMonitorChangedCallback<T> changeCallback, void *owner) {
+void Dataref::monitorExistingDataref(
+    const char *ref, DatarefMonitorChangedCallback<T> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter) {
+    monitorExistingDataref<T>(intern(ref), changeCallback, owner, pollRate, filter);
+}
+
+template<typename T>
+void Dataref::monitorExistingDataref(
+    DatarefId id, DatarefMonitorChangedCallback<T> changeCallback, void *owner, DatarefPollRate pollRate, DatarefFilter filter) {
+    if (id >= slots.size()) {
+        return;
+    }
+
     // Prime the cache with a default so update() starts polling this ref and
     // delivers the live value to every subscriber on the next tick. Do not
     // write the cache through set(): that fired all existing subscribers with
     // a fabricated default (blanking LEDs and crashing vector callbacks that
     // index an empty array), and bailed out entirely for datarefs the
     // aircraft plugin has not registered yet, so those monitors never fired.
-    cachedValues[ref] = {.value = T{}, .lastUpdateCycleNumber = XPLMGetCycleNumber()};
+    DatarefSlot &slot = slots[id];
+    using Stored = typename MonitoredStorage<T>::type;
+    // A ref that is already polled with this type keeps its cache: resetting
+    // it would refire every other subscriber, and getCached() readers would
+    // see the default until the next poll. Only the rate can go up.
+    bool keepCache = slot.polled && std::holds_alternative<Stored>(slot.cache.value);
+    if (slot.polled) {
+        raisePollRate(id, pollRate);
+    } else {
+        slot.pollRate = pollRate;
+    }
+    if (!keepCache) {
+        // Deliver the first value on the next tick even for slow tiers.
+        slot.firstPollPending = slot.pollRate != DatarefPollRate::EVERY_FRAME;
+        slot.polled = true;
+        slot.cache = {.value = Stored{}, .lastUpdateCycleNumber = XPLMGetCycleNumber()};
+        pollPlansDirty = true;
+        markChanged(id);
+    }
 
-    auto callback = [changeCallback](DataRefValueType newValue) -> bool {
+    auto callback = [changeCallback](const DataRefValueType &newValue) {
         if constexpr (std::is_same_v<T, bool>) {
             if (std::holds_alternative<int>(newValue)) {
                 changeCallback(std::get<int>(newValue));
@@ -258,19 +570,34 @@ void Dataref::monitorExistingDataref(const char *ref, DatarefMonitorChangedCallb
             } else if (std::holds_alternative<double>(newValue)) {
                 changeCallback(std::get<double>(newValue));
             }
-        } else {
+        } else if constexpr (std::is_same_v<T, Stored>) {
             if (std::holds_alternative<T>(newValue)) {
                 changeCallback(std::get<T>(newValue));
             }
+        } else {
+            if (std::holds_alternative<Stored>(newValue)) {
+                changeCallback(T(std::get<Stored>(newValue)));
+            }
         }
-
-        return false;
     };
 
-    if (boundRefs.find(ref) != boundRefs.end()) {
-        boundRefs[ref].changeCallbacks.push_back({owner, callback});
-    } else {
-        boundRefs[ref] = {0, nullptr, {{owner, callback}}};
+    auto callbacks = slot.changeCallbacks ? std::make_shared<std::vector<TaggedMonitorCallback>>(*slot.changeCallbacks)
+                                          : std::make_shared<std::vector<TaggedMonitorCallback>>();
+    // Only numbers have a distance to filter on
+    std::shared_ptr<MonitorFilterState> filterState;
+    bool numeric = std::is_same_v<Stored, int> || std::is_same_v<Stored, float> || std::is_same_v<Stored, double> ||
+                   std::is_same_v<Stored, std::vector<int>> || std::is_same_v<Stored, std::vector<float>>;
+    if (numeric && (filter.enter > 0.0 || filter.exit > 0.0 || filter.quantum > 0.0)) {
+        filterState = std::make_shared<MonitorFilterState>(MonitorFilterState{.filter = filter, .primed = false, .delivered = {}, .moving = {}});
+    }
+
+    uint64_t callbackId = nextCallbackId++;
+    callbacks->push_back({owner, callbackId, callback, std::move(filterState)});
+    slot.changeCallbacks = std::move(callbacks);
+    slot.callbackGeneration++;
+
+    if (keepCache) {
+        initialDeliveries.push_back({id, callbackId});
     }
 }
 
@@ -283,8 +610,13 @@ void Dataref::destroyAllBindings() {
     }
     boundRefs.clear();
 
+    for (size_t id = 0; id < slots.size(); ++id) {
+        slots[id].changeCallbacks = nullptr;
+        slots[id].callbackGeneration++;
+    }
+
     for (auto &[key, ref] : boundCommands) {
-        XPLMUnregisterCommandHandler(ref.handle, handleCommandCallback, 1, nullptr);
+        XPLMUnregisterCommandHandler(ref.handle, handleCommandCallback, 1, &ref);
     }
     boundCommands.clear();
 }
@@ -300,19 +632,52 @@ void Dataref::unbind(const char *ref) {
 
     auto it2 = boundCommands.find(ref);
     if (it2 != boundCommands.end()) {
-        XPLMUnregisterCommandHandler(it2->second.handle, handleCommandCallback, 1, nullptr);
+        XPLMUnregisterCommandHandler(it2->second.handle, handleCommandCallback, 1, &it2->second);
         boundCommands.erase(it2);
     }
 
-    refs.erase(ref);
-    cachedValues.erase(ref);
+    auto slotIt = slotIds.find(ref);
+    if (slotIt != slotIds.end()) {
+        DatarefSlot &slot = slots[slotIt->second];
+        slot.changeCallbacks = nullptr;
+        slot.callbackGeneration++;
+        releaseSlot(slotIt->second);
+    }
+}
+
+void Dataref::releaseSlot(DatarefId id) {
+    // The slot itself stays interned so ids held by callers remain valid;
+    // it just stops being polled until something reads or monitors it again.
+    DatarefSlot &slot = slots[id];
+    slot.polled = false;
+    slot.handle = nullptr;
+    slot.refType = xplmType_Unknown;
+    slot.pollRate = DatarefPollRate::EVERY_FRAME;
+    slot.firstPollPending = false;
+    slot.cache = {};
+    pollPlansDirty = true;
+    markChanged(id);
+}
+
+void Dataref::raisePollRate(DatarefId id, DatarefPollRate pollRate) {
+    DatarefSlot &slot = slots[id];
+    if (pollRate >= slot.pollRate) {
+        return;
+    }
+
+    slot.pollRate = pollRate;
+    pollPlansDirty = true;
+    // Republish: the snapshot carries only every-frame refs.
+    markChanged(id);
 }
 
 void Dataref::clearCache() {
-    cachedValues.clear();
     // Cached XPLMDataRef handles of an unloaded aircraft plugin are stale;
     // drop them so the next access re-resolves against the new aircraft.
-    refs.clear();
+    for (DatarefId id = 0; id < slots.size(); ++id) {
+        releaseSlot(id);
+    }
+    existenceCache.clear();
 }
 
 void Dataref::drainMainThreadQueue() {
@@ -326,170 +691,646 @@ void Dataref::drainMainThreadQueue() {
     }
 }
 
-void Dataref::update() {
-    drainMainThreadQueue();
+void Dataref::compilePollPlans() {
+    for (auto &tier : pollTiers) {
+        std::apply(
+            [](auto &...bucket) {
+                (bucket.clear(), ...);
+            },
+            tier.buckets);
+    }
+    unresolvedPolls.clear();
+    firstPolls.clear();
+    pollStats.onDemandRefs = 0;
 
-    std::vector<std::pair<std::string, CachedValue>> updates;
+    for (DatarefId id = 0; id < slots.size(); ++id) {
+        const DatarefSlot &slot = slots[id];
+        if (!slot.polled) {
+            continue;
+        }
+
+        if (slot.pollRate == DatarefPollRate::ON_DEMAND) {
+            pollStats.onDemandRefs++;
+            continue;
+        }
 
-    for (auto &[key, data] : cachedValues) {
+        if (!slot.handle && !findRef(id)) {
+            unresolvedPolls.push_back(id);
+            continue;
+        }
+
+        // A slow ref that was just monitored rides along with the every-frame
+        // tier once, then update() moves it to its own tier.
+        size_t tierIndex = static_cast<size_t>(slot.pollRate);
+        if (slot.firstPollPending) {
+            tierIndex = 0;
+            firstPolls.push_back(id);
+        }
         std::visit(
-            [&](auto &&value) {
+            [&](const auto &value) {
                 using T = std::decay_t<decltype(value)>;
-                T newValue = get<T>(key.c_str());
-                bool didChange = false;
-                if constexpr (std::is_floating_point_v<T>) {
-                    didChange = std::fabs(value - newValue) > std::numeric_limits<T>::epsilon();
-                } else {
-                    didChange = value != newValue;
-                }
+                std::get<std::vector<PollPlan<T>>>(pollTiers[tierIndex].buckets)
+                    .push_back({.id = id, .handle = slot.handle, .reader = readerFor<T>(slot.refType), .scratch = {}});
+            },
+            slot.cache.value);
+    }
 
-                if (didChange) {
-                    updates.emplace_back(key,
-                        CachedValue{
-                            .value = newValue,
-                            .lastUpdateCycleNumber = XPLMGetCycleNumber(),
-                        });
-                }
+    pollStats.unresolvedRefs = static_cast<int>(unresolvedPolls.size());
+    pollPlansDirty = false;
+}
+
+template<typename T>
+int Dataref::pollBucket(std::vector<PollPlan<T>> &bucket, size_t begin, size_t end, int cycleNumber) {
+    for (size_t i = begin; i < end; ++i) {
+        PollPlan<T> &plan = bucket[i];
+        DatarefSlot &slot = slots[plan.id];
+        T *cached = std::get_if<T>(&slot.cache.value);
+        if (!cached) {
+            // Cache was rewritten with another type since the plans were
+            // compiled; the recompile on the next frame picks it up.
+            continue;
+        }
+
+        plan.reader(plan.handle, plan.scratch);
+        if (!hasChanged(*cached, plan.scratch)) {
+            continue;
+        }
+
+        pollStats.deliveredChanges++;
+
+        std::swap(*cached, plan.scratch);
+        slot.cache.lastUpdateCycleNumber = cycleNumber;
+        changedPolls.push_back(plan.id);
+    }
+
+    return static_cast<int>(end - begin);
+}
+
+int Dataref::pollTier(PollTier &tier, double elapsedSeconds, int cycleNumber) {
+    if (tier.periodSeconds <= 0.0) {
+        return std::apply(
+            [&](auto &...bucket) {
+                return (pollBucket(bucket, 0, bucket.size(), cycleNumber) + ... + 0);
             },
-            data.value);
+            tier.buckets);
+    }
+
+    // Advance through the period by the time this frame took and poll the
+    // matching slice of every bucket, wrapping around at the end. Every ref
+    // is polled once per period whatever the frame rate, with the work
+    // spread evenly over the frames in between.
+    double from = tier.phase;
+    double to = from + std::min(elapsedSeconds / tier.periodSeconds, 1.0);
+    tier.phase = to >= 1.0 ? to - 1.0 : to;
+
+    auto pollSlice = [&](auto &bucket) {
+        size_t size = bucket.size();
+        size_t begin = static_cast<size_t>(from * size);
+        if (to <= 1.0) {
+            return pollBucket(bucket, begin, static_cast<size_t>(to * size), cycleNumber);
+        }
+
+        size_t wrappedEnd = std::min(static_cast<size_t>((to - 1.0) * size), begin);
+        return pollBucket(bucket, begin, size, cycleNumber) + pollBucket(bucket, 0, wrappedEnd, cycleNumber);
+    };
+
+    return std::apply(
+        [&](auto &...bucket) {
+            return (pollSlice(bucket) + ... + 0);
+        },
+        tier.buckets);
+}
+
+void Dataref::update() {
+    drainMainThreadQueue();
+    applyPendingWrites();
+
+    // Refs the aircraft plugin has not registered yet are retried every frame;
+    // findRef() flags the plans for recompilation once one resolves.
+    for (DatarefId id : unresolvedPolls) {
+        findRef(id);
+    }
+
+    if (pollPlansDirty) {
+        compilePollPlans();
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsedSeconds = 0.0;
+    if (lastPollTime.time_since_epoch().count() != 0) {
+        elapsedSeconds = std::chrono::duration<double>(now - lastPollTime).count();
+    }
+    lastPollTime = now;
+
+    int cycleNumber = XPLMGetCycleNumber();
+    changedPolls.clear();
+    for (size_t i = 0; i < kPolledTierCount; ++i) {
+        pollStats.polledLastFrame[i] = pollTier(pollTiers[i], elapsedSeconds, cycleNumber);
+    }
+
+    if (!firstPolls.empty()) {
+        for (DatarefId id : firstPolls) {
+            slots[id].firstPollPending = false;
+        }
+        firstPolls.clear();
+        pollPlansDirty = true;
     }
 
-    for (auto &[key, newData] : updates) {
-        auto it = cachedValues.find(key);
-        if (it == cachedValues.end()) {
+    // Callbacks run only after every bucket was polled, so they can freely
+    // monitor, set or unbind refs without invalidating the poll loop.
+    for (DatarefId id : changedPolls) {
+        markChanged(id);
+        if (!slots[id].polled) {
             // Unbound by a callback earlier in this loop; don't resurrect it
             continue;
         }
-        it->second = newData;
-        executeChangedCallbacksForDataref(key.c_str());
+        notifyMonitors(id, false);
     }
+
+    if (!initialDeliveries.empty()) {
+        std::vector<std::pair<DatarefId, uint64_t>> deliveries;
+        deliveries.swap(initialDeliveries);
+        for (auto [id, callbackId] : deliveries) {
+            DatarefSlot &slot = slots[id];
+            // A ref that changed this frame already reached every monitor; an
+            // unresolved one still holds the primed default, and its first
+            // real reading is delivered as a change.
+            bool delivered = std::find(changedPolls.begin(), changedPolls.end(), id) != changedPolls.end();
+            if (delivered || !slot.polled || !slot.handle || !slot.changeCallbacks) {
+                continue;
+            }
+
+            MonitorCallbackList callbacks = slot.changeCallbacks;
+            for (const auto &tc : *callbacks) {
+                if (tc.id == callbackId) {
+                    deliverToMonitor(tc, slot.cache.value, false);
+                    break;
+                }
+            }
+        }
+    }
+
+    publishSnapshot(cycleNumber);
 }
 
-XPLMDataRef Dataref::findRef(const char *ref) {
-    auto it = refs.find(ref);
-    if (it != refs.end()) {
-        return it->second;
+void Dataref::refreshOnDemand(DatarefId id) {
+    int cycleNumber = XPLMGetCycleNumber();
+    if (slots[id].refreshedCycleNumber == cycleNumber) {
+        return;
     }
 
-    XPLMDataRef handle = XPLMFindDataRef(ref);
+    XPLMDataRef handle = findRef(id);
+    DatarefSlot &slot = slots[id];
+    slot.refreshedCycleNumber = cycleNumber;
     if (!handle) {
+        return;
+    }
+
+    std::visit(
+        [&](auto &value) {
+            using T = std::decay_t<decltype(value)>;
+            T newValue{};
+            readerFor<T>(slot.refType)(handle, newValue);
+            if (!hasChanged(value, newValue)) {
+                return;
+            }
+
+            pollStats.deliveredChanges++;
+            value = std::move(newValue);
+            slot.cache.lastUpdateCycleNumber = cycleNumber;
+            markChanged(id);
+        },
+        slot.cache.value);
+}
+
+const DatarefPollStats &Dataref::getPollStats() {
+    return pollStats;
+}
+
+void Dataref::markChanged(DatarefId id) {
+    DatarefSlot &slot = slots[id];
+    for (DatarefGroupId group : slot.groups) {
+        groups[group].generation++;
+    }
+
+    if (!slot.snapshotPending && snapshotsEnabled.load(std::memory_order_relaxed)) {
+        slot.snapshotPending = true;
+        snapshotPending.push_back(id);
+    }
+}
+
+std::shared_ptr<const DatarefSnapshot> Dataref::getSnapshot() {
+    snapshotsEnabled.store(true, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    return snapshot;
+}
+
+void Dataref::publishSnapshot(int cycleNumber) {
+    // Nobody reads snapshots until a worker asks for one; skip the copies.
+    if (!snapshotsEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const std::shared_ptr<const DatarefSnapshot> &previous = publishedSnapshot;
+    bool sameSlots = previous && previous->size == slots.size();
+    if (sameSlots && snapshotPending.empty()) {
+        return;
+    }
+
+    auto next = std::make_shared<DatarefSnapshot>();
+    next->cycleNumber = cycleNumber;
+    next->size = slots.size();
+    next->ids = sameSlots ? previous->ids : std::make_shared<const std::unordered_map<std::string, DatarefId, StringViewHash, std::equal_to<>>>(slotIds);
+
+    // Start from the previous chunks and copy one the first time a value in
+    // it changes; readers may still hold the previous snapshot.
+    size_t sharedChunks = 0;
+    if (previous) {
+        next->chunks = previous->chunks;
+        sharedChunks = next->chunks.size();
+    }
+    next->chunks.resize((slots.size() + DatarefSnapshot::ChunkSize - 1) / DatarefSnapshot::ChunkSize);
+    std::vector<bool> copied(next->chunks.size(), false);
+
+    // Only refs polled every frame are as fresh as a live read; slower tiers
+    // and on-demand refs are left for get() to read live.
+    auto publishValue = [&](DatarefId id) {
+        size_t chunk = id / DatarefSnapshot::ChunkSize;
+        if (!copied[chunk]) {
+            next->chunks[chunk] = chunk < sharedChunks ? std::make_shared<DatarefSnapshot::Chunk>(*next->chunks[chunk]) : std::make_shared<DatarefSnapshot::Chunk>();
+            copied[chunk] = true;
+        }
+
+        const DatarefSlot &slot = slots[id];
+        bool current = slot.polled && slot.pollRate == DatarefPollRate::EVERY_FRAME;
+        (*next->chunks[chunk])[id % DatarefSnapshot::ChunkSize] = current ? std::make_shared<const DataRefValueType>(slot.cache.value) : nullptr;
+    };
+
+    size_t publishedSize = previous ? previous->size : 0;
+    for (DatarefId id : snapshotPending) {
+        if (id < publishedSize) {
+            publishValue(id);
+        }
+    }
+    for (DatarefId id = static_cast<DatarefId>(publishedSize); id < slots.size(); ++id) {
+        publishValue(id);
+    }
+
+    for (DatarefId id : snapshotPending) {
+        slots[id].snapshotPending = false;
+    }
+    snapshotPending.clear();
+
+    // The replaced snapshot is released outside the lock, unless a reader
+    // still holds it.
+    publishedSnapshot = next;
+    std::shared_ptr<const DatarefSnapshot> replaced;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        replaced = std::exchange(snapshot, std::move(next));
+    }
+}
+
+void Dataref::applyPendingWrites() {
+    {
+        std::lock_guard<std::mutex> lock(pendingWritesMutex);
+        if (pendingWrites.empty()) {
+            return;
+        }
+        writeBatch.swap(pendingWrites);
+    }
+
+    for (auto &write : writeBatch) {
+        std::visit(
+            [&](auto &value) {
+                set(write.ref.c_str(), std::move(value), write.setCacheOnly);
+            },
+            write.value);
+    }
+    writeBatch.clear();
+}
+
+DatarefGroupId Dataref::createSubscriptionGroup(const std::vector<std::string> &refs) {
+    DatarefGroupId group;
+    if (!freeGroups.empty()) {
+        group = freeGroups.back();
+        freeGroups.pop_back();
+    } else {
+        group = static_cast<DatarefGroupId>(groups.size());
+        groups.push_back({});
+    }
+
+    std::vector<DatarefId> members;
+    members.reserve(refs.size());
+    for (const std::string &ref : refs) {
+        DatarefId id = intern(ref.c_str());
+        slots[id].groups.push_back(group);
+        members.push_back(id);
+    }
+
+    // Generations only ever grow, so a recycled id never looks unchanged to
+    // a subscriber that still remembers the previous owner's generation.
+    groups[group].members = std::move(members);
+    groups[group].generation++;
+    groups[group].active = true;
+    return group;
+}
+
+void Dataref::destroySubscriptionGroup(DatarefGroupId group) {
+    if (group >= groups.size() || !groups[group].active) {
+        return;
+    }
+
+    for (DatarefId id : groups[group].members) {
+        std::erase(slots[id].groups, group);
+    }
+    groups[group].members.clear();
+    groups[group].active = false;
+    freeGroups.push_back(group);
+}
+
+uint64_t Dataref::getGroupGeneration(DatarefGroupId group) {
+    if (group >= groups.size()) {
+        return 0;
+    }
+
+    return groups[group].generation;
+}
+
+XPLMDataRef Dataref::findRef(const char *ref) {
+    return findRef(intern(ref));
+}
+
+XPLMDataRef Dataref::findRef(DatarefId id) {
+    if (id >= slots.size()) {
         return nullptr;
     }
 
-    return refs.emplace(ref, handle).first->second;
+    DatarefSlot &slot = slots[id];
+    if (!slot.handle) {
+        slot.handle = XPLMFindDataRef(slot.name.c_str());
+        if (!slot.handle) {
+            return nullptr;
+        }
+
+        slot.refType = XPLMGetDataRefTypes(slot.handle);
+        if (slot.polled) {
+            pollPlansDirty = true;
+        }
+    }
+
+    return slot.handle;
 }
 
 bool Dataref::exists(const char *ref) {
-    return XPLMFindDataRef(ref) != nullptr;
+    auto it = existenceCache.find(std::string_view(ref));
+    if (it != existenceCache.end()) {
+        return it->second;
+    }
+
+    bool found = XPLMFindDataRef(ref) != nullptr;
+    existenceCache.emplace(ref, found);
+    return found;
+}
+
+void Dataref::clearExistenceCache() {
+    existenceCache.clear();
 }
 
 void Dataref::executeChangedCallbacksForDataref(const char *ref) {
-    auto it = boundRefs.find(ref);
-    if (it == boundRefs.end()) {
+    auto it = slotIds.find(ref);
+    if (it == slotIds.end()) {
         return;
     }
 
-    auto cacheIt = cachedValues.find(ref);
-    if (cacheIt == cachedValues.end()) {
-        // No cached value to deliver; operator[] here used to default-insert
-        // a float{0} entry that was then polled forever with the wrong type.
+    executeChangedCallbacksForDataref(it->second);
+}
+
+void Dataref::executeChangedCallbacksForDataref(DatarefId id) {
+    notifyMonitors(id, true);
+}
+
+void Dataref::deliverToMonitor(const TaggedMonitorCallback &tc, const DataRefValueType &value, bool force) {
+    if (!tc.filter) {
+        tc.func(value);
         return;
     }
 
-    // Iterate a copy: a callback may register or unbind monitors on this ref,
-    // which would invalidate the live vector mid-iteration.
-    std::vector<TaggedCallback> callbacks = it->second.changeCallbacks;
-    DataRefValueType value = cacheIt->second.value;
-    for (auto &tc : callbacks) {
-        tc.func(value);
+    FilterResult result = filterForMonitor(*tc.filter, value, force);
+    if (result != FilterResult::PASSED && !force) {
+        pollStats.suppressedChanges += result == FilterResult::SUPPRESSED;
+        return;
+    }
+    tc.func(tc.filter->delivered);
+}
+
+void Dataref::notifyMonitors(DatarefId id, bool force) {
+    if (id >= slots.size() || !slots[id].polled) {
+        // No cached value to deliver; don't start polling a ref here with a
+        // default-typed value, it would be polled forever with the wrong type.
+        return;
+    }
+
+    // Slots never move, so the cached value can be handed out by reference.
+    // Callbacks that add or remove monitors replace the slot's list and bump
+    // its generation; until that happens nothing needs re-checking.
+    DatarefSlot &slot = slots[id];
+    if (!slot.changeCallbacks) {
+        return;
+    }
+
+    MonitorCallbackList callbacks = slot.changeCallbacks;
+    uint32_t generation = slot.callbackGeneration;
+    for (const auto &tc : *callbacks) {
+        if (slot.callbackGeneration != generation && !isMonitorCallbackLive(slot, tc.id)) {
+            // Unbound by an earlier callback of this fan-out
+            continue;
+        }
+        deliverToMonitor(tc, slot.cache.value, force);
     }
 }
 
 void Dataref::unbindAll(void *owner) {
-    for (auto it = boundRefs.begin(); it != boundRefs.end();) {
-        auto &cbs = it->second.changeCallbacks;
-        cbs.erase(std::remove_if(cbs.begin(), cbs.end(),
-                      [owner](const TaggedCallback &tc) {
-                          return tc.owner == owner;
-                      }),
-            cbs.end());
-        // Remove monitor-only entries that now have no callbacks, including
-        // their cache entries, so update() stops polling them and aircraft
-        // switches don't accrete dead refs.
-        if (cbs.empty() && !it->second.handle) {
-            cachedValues.erase(it->first);
-            refs.erase(it->first);
-            it = boundRefs.erase(it);
-        } else {
-            ++it;
+    for (DatarefId id = 0; id < slots.size(); ++id) {
+        DatarefSlot &slot = slots[id];
+        if (!slot.changeCallbacks) {
+            continue;
+        }
+
+        const auto &current = *slot.changeCallbacks;
+        bool ownsAny = std::any_of(current.begin(), current.end(), [owner](const TaggedMonitorCallback &tc) {
+            return tc.owner == owner;
+        });
+        if (!ownsAny) {
+            continue;
+        }
+
+        auto cbs = std::make_shared<std::vector<TaggedMonitorCallback>>();
+        std::copy_if(current.begin(), current.end(), std::back_inserter(*cbs), [owner](const TaggedMonitorCallback &tc) {
+            return tc.owner != owner;
+        });
+        bool empty = cbs->empty();
+        slot.changeCallbacks = empty ? nullptr : std::move(cbs);
+        slot.callbackGeneration++;
+        // Release monitor-only slots that now have no callbacks, so update()
+        // stops polling them and aircraft switches don't accrete dead refs.
+        if (empty && !boundRefs.contains(slot.name)) {
+            releaseSlot(id);
         }
     }
 
     for (auto it = boundCommands.begin(); it != boundCommands.end();) {
-        auto &cbs = it->second.callbacks;
-        cbs.erase(std::remove_if(cbs.begin(), cbs.end(),
-                      [owner](const TaggedCommandCallback &tc) {
-                          return tc.owner == owner;
-                      }),
-            cbs.end());
-        if (cbs.empty()) {
-            XPLMUnregisterCommandHandler(it->second.handle, handleCommandCallback, 1, nullptr);
+        const auto &current = *it->second.callbacks;
+        bool ownsAny = std::any_of(current.begin(), current.end(), [owner](const TaggedCommandCallback &tc) {
+            return tc.owner == owner;
+        });
+        if (!ownsAny) {
+            ++it;
+            continue;
+        }
+
+        auto cbs = std::make_shared<std::vector<TaggedCommandCallback>>();
+        std::copy_if(current.begin(), current.end(), std::back_inserter(*cbs), [owner](const TaggedCommandCallback &tc) {
+            return tc.owner != owner;
+        });
+        if (cbs->empty()) {
+            XPLMUnregisterCommandHandler(it->second.handle, handleCommandCallback, 1, &it->second);
             it = boundCommands.erase(it);
         } else {
+            it->second.callbacks = std::move(cbs);
             ++it;
         }
     }
 }
 
 int Dataref::getCachedLastUpdate(const char *ref) {
-    auto it = cachedValues.find(ref);
-    if (it == cachedValues.end()) {
+    auto it = slotIds.find(ref);
+    if (it == slotIds.end()) {
+        return 0;
+    }
+
+    return getCachedLastUpdate(it->second);
+}
+
+int Dataref::getCachedLastUpdate(DatarefId id) {
+    if (id >= slots.size() || !slots[id].polled) {
         return 0;
     }
 
-    return it->second.lastUpdateCycleNumber;
+    return slots[id].cache.lastUpdateCycleNumber;
 }
 
-template float Dataref::getCached<float>(const char *ref);
-template double Dataref::getCached<double>(const char *ref);
-template int Dataref::getCached<int>(const char *ref);
-template bool Dataref::getCached<bool>(const char *ref);
-template std::vector<int> Dataref::getCached<std::vector<int>>(const char *ref);
-template std::vector<float> Dataref::getCached<std::vector<float>>(const char *ref);
-template std::vector<unsigned char> Dataref::getCached<std::vector<unsigned char>>(const char *ref);
-template std::string Dataref::getCached<std::string>(const char *ref);
+template float Dataref::getCached<float>(const char *ref, DatarefPollRate pollRate);
+template double Dataref::getCached<double>(const char *ref, DatarefPollRate pollRate);
+template int Dataref::getCached<int>(const char *ref, DatarefPollRate pollRate);
+template bool Dataref::getCached<bool>(const char *ref, DatarefPollRate pollRate);
+template std::vector<int> Dataref::getCached<std::vector<int>>(const char *ref, DatarefPollRate pollRate);
+template std::vector<float> Dataref::getCached<std::vector<float>>(const char *ref, DatarefPollRate pollRate);
+template std::vector<unsigned char> Dataref::getCached<std::vector<unsigned char>>(const char *ref, DatarefPollRate pollRate);
+template std::string Dataref::getCached<std::string>(const char *ref, DatarefPollRate pollRate);
+
+template float Dataref::getCached<float>(DatarefId id, DatarefPollRate pollRate);
+template double Dataref::getCached<double>(DatarefId id, DatarefPollRate pollRate);
+template int Dataref::getCached<int>(DatarefId id, DatarefPollRate pollRate);
+template bool Dataref::getCached<bool>(DatarefId id, DatarefPollRate pollRate);
+template std::vector<int> Dataref::getCached<std::vector<int>>(DatarefId id, DatarefPollRate pollRate);
+template std::vector<float> Dataref::getCached<std::vector<float>>(DatarefId id, DatarefPollRate pollRate);
+template std::vector<unsigned char> Dataref::getCached<std::vector<unsigned char>>(DatarefId id, DatarefPollRate pollRate);
+template std::string Dataref::getCached<std::string>(DatarefId id, DatarefPollRate pollRate);
 
 template<typename T>
-T Dataref::getCached(const char *ref) {
-    auto it = cachedValues.find(ref);
-    if (it == cachedValues.end()) {
-        auto val = get<T>(ref);
-        cachedValues[ref] = {.value = val, .lastUpdateCycleNumber = XPLMGetCycleNumber()};
+T Dataref::getCached(const char *ref, DatarefPollRate pollRate) {
+    return getCached<T>(intern(ref), pollRate);
+}
+
+template<typename T>
+T Dataref::getCached(DatarefId id, DatarefPollRate pollRate) {
+    if (id >= slots.size()) {
+        return {};
+    }
+
+    if (!slots[id].polled) {
+        // Copy the name: get() may hop to the main thread, which can grow
+        // the slot array underneath us.
+        std::string ref = slots[id].name;
+        auto val = get<T>(ref.c_str());
+        DatarefSlot &slot = slots[id];
+        slot.polled = true;
+        slot.pollRate = pollRate;
+        slot.refreshedCycleNumber = XPLMGetCycleNumber();
+        slot.cache = {.value = val, .lastUpdateCycleNumber = slot.refreshedCycleNumber};
+        pollPlansDirty = true;
+        markChanged(id);
         return val;
     }
 
-    if (!std::holds_alternative<T>(it->second.value)) {
-        if constexpr (std::is_same_v<T, bool>) {
-            if (std::holds_alternative<int>(it->second.value)) {
-                return std::get<int>(it->second.value) > 0;
-            } else if (std::holds_alternative<double>(it->second.value)) {
-                return std::get<double>(it->second.value) > std::numeric_limits<double>::epsilon();
-            } else if (std::holds_alternative<float>(it->second.value)) {
-                return std::get<float>(it->second.value) > std::numeric_limits<float>::epsilon();
-            }
+    raisePollRate(id, pollRate);
+    if (slots[id].pollRate == DatarefPollRate::ON_DEMAND) {
+        refreshOnDemand(id);
+    }
 
-            return false;
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            return "";
-        } else if constexpr (std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<float>> ||
-                             std::is_same_v<T, std::vector<unsigned char>>) {
-            return {};
-        } else {
-            return 0;
+    return cachedValueAs<T>(slots[id].cache.value);
+}
+
+template std::span<const int> Dataref::getCachedArray<int>(const char *ref, DatarefPollRate pollRate);
+template std::span<const float> Dataref::getCachedArray<float>(const char *ref, DatarefPollRate pollRate);
+template std::span<const unsigned char> Dataref::getCachedArray<unsigned char>(const char *ref, DatarefPollRate pollRate);
+template std::span<const int> Dataref::getCachedArray<int>(DatarefId id, DatarefPollRate pollRate);
+template std::span<const float> Dataref::getCachedArray<float>(DatarefId id, DatarefPollRate pollRate);
+template std::span<const unsigned char> Dataref::getCachedArray<unsigned char>(DatarefId id, DatarefPollRate pollRate);
+
+template<typename T>
+std::span<const T> Dataref::getCachedArray(const char *ref, DatarefPollRate pollRate) {
+    return getCachedArray<T>(intern(ref), pollRate);
+}
+
+template<typename T>
+std::span<const T> Dataref::getCachedArray(DatarefId id, DatarefPollRate pollRate) {
+    if (id >= slots.size()) {
+        return {};
+    }
+
+    if (!slots[id].polled) {
+        getCached<std::vector<T>>(id, pollRate);
+    } else {
+        raisePollRate(id, pollRate);
+        if (slots[id].pollRate == DatarefPollRate::ON_DEMAND) {
+            refreshOnDemand(id);
         }
     }
 
-    return std::get<T>(it->second.value);
+    const auto *values = std::get_if<std::vector<T>>(&slots[id].cache.value);
+    if (!values) {
+        return {};
+    }
+
+    return *values;
+}
+
+std::string_view Dataref::getCachedString(const char *ref, DatarefPollRate pollRate) {
+    return getCachedString(intern(ref), pollRate);
+}
+
+std::string_view Dataref::getCachedString(DatarefId id, DatarefPollRate pollRate) {
+    if (id >= slots.size()) {
+        return {};
+    }
+
+    if (!slots[id].polled) {
+        getCached<std::string>(id, pollRate);
+    } else {
+        raisePollRate(id, pollRate);
+        if (slots[id].pollRate == DatarefPollRate::ON_DEMAND) {
+            refreshOnDemand(id);
+        }
+    }
+
+    const auto *value = std::get_if<std::string>(&slots[id].cache.value);
+    if (!value) {
+        return {};
+    }
+
+    return *value;
 }
 
 template float Dataref::get<float>(const char *ref);
@@ -504,6 +1345,17 @@ template std::string Dataref::get<std::string>(const char *ref);
 template<typename T>
 T Dataref::get(const char *ref) {
     if (std::this_thread::get_id() != mainThreadId) {
+        std::shared_ptr<const DatarefSnapshot> current = getSnapshot();
+        if (current) {
+            auto it = current->ids->find(ref);
+            const DataRefValueType *value = it != current->ids->end() ? current->value(it->second) : nullptr;
+            if (value) {
+                return cachedValueAs<T>(*value);
+            }
+        }
+
+        // Not polled every frame: read it live on the main thread, once.
+        // Going through getCached() would add it to the polled set for good.
         std::promise<T> promise;
         auto future = promise.get_future();
         std::string refStr(ref);
@@ -520,67 +1372,15 @@ T Dataref::get(const char *ref) {
         return future.get();
     }
 
-    XPLMDataRef handle = findRef(ref);
+    DatarefId id = intern(ref);
+    XPLMDataRef handle = findRef(id);
     if (!handle) {
-        if constexpr (std::is_same_v<T, std::string>) {
-            return "";
-        } else if constexpr (std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<float>> ||
-                             std::is_same_v<T, std::vector<unsigned char>>) {
-            return {};
-        } else {
-            return 0;
-        }
-    }
-
-    if constexpr (std::is_same_v<T, bool>) {
-        XPLMDataTypeID refType = XPLMGetDataRefTypes(handle);
-        if ((refType & xplmType_Float) == xplmType_Float) {
-            return XPLMGetDataf(handle) > std::numeric_limits<float>::epsilon();
-        } else if ((refType & xplmType_Double) == xplmType_Double) {
-            return XPLMGetDatad(handle) > std::numeric_limits<double>::epsilon();
-        } else {
-            return XPLMGetDatai(handle) > 0;
-        }
-    } else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>) {
-        XPLMDataTypeID refType = XPLMGetDataRefTypes(handle);
-        if ((refType & xplmType_Float) == xplmType_Float) {
-            return XPLMGetDataf(handle);
-        } else if ((refType & xplmType_Double) == xplmType_Double) {
-            return XPLMGetDatad(handle);
-        } else {
-            return XPLMGetDatai(handle);
-        }
-    } else if constexpr (std::is_same_v<T, std::vector<int>>) {
-        int size = XPLMGetDatavi(handle, nullptr, 0, 0);
-        std::vector<int> outValues(size);
-        XPLMGetDatavi(handle, outValues.data(), 0, size);
-        return outValues;
-    } else if constexpr (std::is_same_v<T, std::vector<float>>) {
-        int size = XPLMGetDatavf(handle, nullptr, 0, 0);
-        std::vector<float> outValues(size);
-        XPLMGetDatavf(handle, outValues.data(), 0, size);
-        return outValues;
-    } else if constexpr (std::is_same_v<T, std::vector<unsigned char>>) {
-        int size = XPLMGetDatab(handle, nullptr, 0, 0);
-        std::vector<unsigned char> outValues(size);
-        XPLMGetDatab(handle, outValues.data(), 0, size);
-        return outValues;
-    } else if constexpr (std::is_same_v<T, std::string>) {
-        int size = XPLMGetDatab(handle, nullptr, 0, 0);
-        std::vector<char> str(size);
-        XPLMGetDatab(handle, str.data(), 0, size);
-        auto it = std::find(str.begin(), str.end(), '\0');
-        return std::string(str.begin(), it);
-    }
-
-    if constexpr (std::is_same_v<T, std::string>) {
-        return "";
-    } else if constexpr (std::is_same_v<T, std::vector<int>> || std::is_same_v<T, std::vector<float>> ||
-                         std::is_same_v<T, std::vector<unsigned char>>) {
         return {};
-    } else {
-        return 0;
     }
+
+    T value{};
+    readerFor<T>(slots[id].refType)(handle, value);
+    return value;
 }
 
 template void Dataref::set<float>(const char *ref, float value, bool setCacheOnly);
@@ -595,14 +1395,29 @@ template void Dataref::set<std::string>(const char *ref, std::string value, bool
 
 template<typename T>
 void Dataref::set(const char *ref, T value, bool setCacheOnly) {
-    XPLMDataRef handle = findRef(ref);
+    if (std::this_thread::get_id() != mainThreadId) {
+        setAsync(ref, std::move(value), setCacheOnly);
+        return;
+    }
+
+    DatarefId id = intern(ref);
+    XPLMDataRef handle = findRef(id);
     if (!handle) {
         return;
     }
 
-    cachedValues[ref] = {.value = value, .lastUpdateCycleNumber = XPLMGetCycleNumber()};
+    DatarefSlot &slot = slots[id];
+    DataRefValueType newValue = value;
+    if (!slot.polled || slot.cache.value.index() != newValue.index()) {
+        pollPlansDirty = true;
+    }
+    slot.polled = true;
+    slot.cache = {.value = std::move(newValue), .lastUpdateCycleNumber = XPLMGetCycleNumber()};
+    markChanged(id);
 
-    executeChangedCallbacksForDataref(ref);
+    // Callbacks may intern new refs and grow the slot array
+    XPLMDataTypeID refType = slot.refType;
+    executeChangedCallbacksForDataref(id);
 
     if (setCacheOnly) {
         return;
@@ -610,7 +1425,6 @@ void Dataref::set(const char *ref, T value, bool setCacheOnly) {
 
     if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
                   std::is_same_v<T, double>) {
-        XPLMDataTypeID refType = XPLMGetDataRefTypes(handle);
         if ((refType & xplmType_Float) == xplmType_Float) {
             XPLMSetDataf(handle, value);
         } else if ((refType & xplmType_Double) == xplmType_Double) {
@@ -629,8 +1443,38 @@ void Dataref::set(const char *ref, T value, bool setCacheOnly) {
     }
 }
 
-void Dataref::executeCommand(const char *command, XPLMCommandPhase phase) {
+template void Dataref::setAsync<float>(const char *ref, float value, bool setCacheOnly);
+template void Dataref::setAsync<double>(const char *ref, double value, bool setCacheOnly);
+template void Dataref::setAsync<int>(const char *ref, int value, bool setCacheOnly);
+template void Dataref::setAsync<bool>(const char *ref, bool value, bool setCacheOnly);
+template void Dataref::setAsync<std::vector<int>>(const char *ref, std::vector<int> value, bool setCacheOnly);
+template void Dataref::setAsync<std::vector<float>>(const char *ref, std::vector<float> value, bool setCacheOnly);
+template void Dataref::setAsync<std::vector<unsigned char>>(
+    const char *ref, std::vector<unsigned char> value, bool setCacheOnly);
+template void Dataref::setAsync<std::string>(const char *ref, std::string value, bool setCacheOnly);
+
+template<typename T>
+void Dataref::setAsync(const char *ref, T value, bool setCacheOnly) {
+    std::lock_guard<std::mutex> lock(pendingWritesMutex);
+    pendingWrites.push_back({.ref = ref, .value = std::move(value), .setCacheOnly = setCacheOnly});
+}
+
+XPLMCommandRef Dataref::findCommand(const char *command) {
+    auto it = commandHandles.find(std::string_view(command));
+    if (it != commandHandles.end()) {
+        return it->second;
+    }
+
+    // Misses are not cached: the aircraft plugin may create the command later
     XPLMCommandRef handle = XPLMFindCommand(command);
+    if (handle) {
+        commandHandles.emplace(command, handle);
+    }
+    return handle;
+}
+
+void Dataref::executeCommand(const char *command, XPLMCommandPhase phase) {
+    XPLMCommandRef handle = findCommand(command);
     if (!handle) {
         Logger::getInstance()->info("Command not found: %s\n", command);
         return;
@@ -646,20 +1490,26 @@ void Dataref::executeCommand(const char *command, XPLMCommandPhase phase) {
 }
 
 void Dataref::bindExistingCommand(const char *command, CommandExecutedCallback callback, void *owner) {
-    XPLMCommandRef handle = XPLMFindCommand(command);
+    XPLMCommandRef handle = findCommand(command);
     if (!handle) {
         return;
     }
 
     auto it = boundCommands.find(command);
     if (it != boundCommands.end()) {
-        it->second.callbacks.push_back({owner, callback});
+        auto cbs = std::make_shared<std::vector<TaggedCommandCallback>>(*it->second.callbacks);
+        cbs->push_back({owner, callback});
+        it->second.callbacks = std::move(cbs);
         return;
     }
 
-    boundCommands[command] = {handle, {{owner, callback}}};
+    // Map nodes never move, so the binding's address is a stable refcon
+    BoundCommand &binding = boundCommands[command];
+    binding.handle = handle;
+    binding.callbacks = std::make_shared<const std::vector<TaggedCommandCallback>>(
+        std::vector<TaggedCommandCallback>{{owner, callback}});
 
-    XPLMRegisterCommandHandler(handle, handleCommandCallback, 1, nullptr);
+    XPLMRegisterCommandHandler(handle, handleCommandCallback, 1, &binding);
 }
 
 void Dataref::createCommand(const char *command, const char *description, CommandExecutedCallback callback) {
@@ -670,7 +1520,7 @@ void Dataref::createCommand(const char *command, const char *description, Comman
 
     auto it = boundCommands.find(command);
     if (it != boundCommands.end()) {
-        XPLMUnregisterCommandHandler(handle, handleCommandCallback, 1, nullptr);
+        XPLMUnregisterCommandHandler(handle, handleCommandCallback, 1, &it->second);
         boundCommands.erase(it);
     }
 
@@ -678,18 +1528,57 @@ void Dataref::createCommand(const char *command, const char *description, Comman
 }
 
 int Dataref::_commandCallback(XPLMCommandRef inCommand, XPLMCommandPhase inPhase, void *inRefcon) {
-    for (const auto &entry : boundCommands) {
-        XPLMCommandRef handle = entry.second.handle;
-        if (inCommand == handle) {
-            // Iterate a copy: a callback may bind or unbind commands,
-            // which would invalidate the live vector mid-iteration.
-            std::vector<TaggedCommandCallback> callbacks = entry.second.callbacks;
-            for (auto &tc : callbacks) {
-                tc.func(inPhase);
-            }
-            break;
-        }
+    auto *binding = static_cast<BoundCommand *>(inRefcon);
+    if (!binding || binding->handle != inCommand) {
+        return 1;
+    }
+
+    // Keep this list alive even if a callback unbinds the command and
+    // destroys the binding; nothing below touches the binding again.
+    std::shared_ptr<const std::vector<TaggedCommandCallback>> callbacks = binding->callbacks;
+    for (const auto &tc : *callbacks) {
+        tc.func(inPhase);
     }
 
     return 1;
 }
+
+DatarefSubscription::~DatarefSubscription() {
+    if (group != kInvalidDatarefGroupId) {
+        Dataref::getInstance()->destroySubscriptionGroup(group);
+    }
+}
+
+bool DatarefSubscription::hasChanges(const std::vector<std::string> &newRefs) {
+    Dataref *datarefManager = Dataref::getInstance();
+    if (&newRefs != refs) {
+        if (group != kInvalidDatarefGroupId) {
+            datarefManager->destroySubscriptionGroup(group);
+        }
+        group = datarefManager->createSubscriptionGroup(newRefs);
+        refs = &newRefs;
+        forced = true;
+    }
+
+    return forced || datarefManager->getGroupGeneration(group) != seenGeneration;
+}
+
+void DatarefSubscription::acknowledge() {
+    if (group == kInvalidDatarefGroupId) {
+        return;
+    }
+
+    seenGeneration = Dataref::getInstance()->getGroupGeneration(group);
+    forced = false;
+}
+
+void DatarefSubscription::reset() {
+    // A new profile may reuse the old one's address, so never trust the
+    // pointer across a reset; re-register on the next hasChanges().
+    if (group != kInvalidDatarefGroupId) {
+        Dataref::getInstance()->destroySubscriptionGroup(group);
+        group = kInvalidDatarefGroupId;
+    }
+    refs = nullptr;
+    forced = true;
+}
@@ -1,11 +1,19 @@
 #ifndef DATAREF_H
 #define DATAREF_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -16,8 +24,11 @@ using DataRefValueType = std::
     variant<float, double, int, bool, std::string, std::vector<int>, std::vector<float>, std::vector<unsigned char>>;
 template<typename T>
 using DatarefShouldChangeCallback = std::function<bool(T)>;
+// Monitors receive the cached value by reference; T may also be a
+// std::span<const E> or std::string_view to observe an array or string
+// without copying it.
 template<typename T>
-using DatarefMonitorChangedCallback = std::function<void(T)>;
+using DatarefMonitorChangedCallback = std::function<void(const T &)>;
 
 struct TaggedCallback {
         void *owner;
@@ -37,9 +48,20 @@ struct TaggedCommandCallback {
         CommandExecutedCallback func;
 };
 
+// Registered with itself as the handler refcon, so dispatch needs no lookup.
+// The callback list is replaced rather than mutated: dispatch holds on to the
+// list it started with while callbacks bind or unbind commands.
 struct BoundCommand {
         XPLMCommandRef handle;
-        std::vector<TaggedCommandCallback> callbacks;
+        std::shared_ptr<const std::vector<TaggedCommandCallback>> callbacks;
+};
+
+struct StringViewHash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view value) const {
+            return std::hash<std::string_view>{}(value);
+        }
 };
 
 struct CachedValue {
@@ -47,6 +69,183 @@ struct CachedValue {
         int lastUpdateCycleNumber;
 };
 
+// Interned dataref name. Resolve once via Dataref::intern() and keep the id
+// around on hot paths; ids stay valid for the lifetime of the plugin.
+using DatarefId = uint32_t;
+constexpr DatarefId kInvalidDatarefId = UINT32_MAX;
+
+using DatarefGroupId = uint32_t;
+constexpr DatarefGroupId kInvalidDatarefGroupId = UINT32_MAX;
+
+// How often update() refreshes a cached dataref. Slower tiers are spread over
+// their period so the per-frame cost stays flat. ON_DEMAND refs are never
+// polled: they are re-read (at most once per cycle) when getCached is called,
+// so monitors on them only fire through set().
+enum class DatarefPollRate : unsigned char {
+    EVERY_FRAME = 0,
+    HZ_20,
+    HZ_5,
+    HZ_1,
+    ON_DEMAND
+};
+
+constexpr size_t kPolledTierCount = static_cast<size_t>(DatarefPollRate::ON_DEMAND);
+
+struct DatarefPollStats {
+        std::array<int, kPolledTierCount> polledLastFrame;
+        int onDemandRefs;
+        int unresolvedRefs;
+        uint64_t deliveredChanges;  // Polled changes written to the cache since start
+        uint64_t suppressedChanges; // Deliveries a monitor's change filter held back
+};
+
+// Change filter for one monitor of a noisy numeric ref (scalars, and int/float
+// arrays per element), with hysteresis around the value last delivered to that
+// monitor. A settled value only moves once a reading is further than enter
+// from it. It then follows every reading further than exit in the same
+// direction, and settles again as soon as a reading turns back. Quantised
+// monitors get values rounded to the step.
+struct DatarefFilter {
+        double enter = 0.0;
+        double exit = 0.0;
+        double quantum = 0.0;
+};
+
+// Brightness refs only ever end up as a 0..255 LED or backlight level: follow
+// them level by level, but only turn back after a full level.
+inline constexpr DatarefFilter kBacklightFilter = {.enter = 1.0 / 255.0, .exit = 0.5 / 255.0, .quantum = 1.0 / 255.0};
+
+struct MonitorFilterState {
+        DatarefFilter filter;
+        bool primed;                     // First delivery, and forced ones, bypass the filter
+        DataRefValueType delivered;      // What the monitor was last handed
+        std::vector<signed char> moving; // Per element: 0 when settled, else the direction
+};
+
+struct TaggedMonitorCallback {
+        void *owner;
+        uint64_t id;
+        std::function<void(const DataRefValueType &)> func;
+        std::shared_ptr<MonitorFilterState> filter; // Null when unfiltered
+};
+
+// Replaced, never mutated: a fan-out keeps iterating the list it started with
+// while callbacks add or remove monitors.
+using MonitorCallbackList = std::shared_ptr<const std::vector<TaggedMonitorCallback>>;
+
+// Append-only array whose elements never move. Callbacks get references into
+// a slot's cache and may intern new refs while holding them.
+template<typename T, size_t ChunkSize = 64>
+class StableArray {
+    private:
+        std::vector<std::unique_ptr<T[]>> chunks;
+        size_t count = 0;
+
+    public:
+        size_t size() const {
+            return count;
+        }
+
+        T &operator[](size_t index) {
+            return chunks[index / ChunkSize][index % ChunkSize];
+        }
+
+        const T &operator[](size_t index) const {
+            return chunks[index / ChunkSize][index % ChunkSize];
+        }
+
+        void push_back(T value) {
+            if (count % ChunkSize == 0) {
+                chunks.push_back(std::make_unique<T[]>(ChunkSize));
+            }
+            chunks[count / ChunkSize][count % ChunkSize] = std::move(value);
+            count++;
+        }
+};
+
+struct DatarefSlot {
+        std::string name;
+        XPLMDataRef handle;
+        XPLMDataTypeID refType;
+        bool polled;
+        DatarefPollRate pollRate;
+        bool firstPollPending;
+        int refreshedCycleNumber;
+        CachedValue cache;
+        MonitorCallbackList changeCallbacks;
+        uint32_t callbackGeneration; // Bumped whenever changeCallbacks is replaced
+        std::vector<DatarefGroupId> groups; // Subscription groups this ref belongs to
+        bool snapshotPending;
+};
+
+// A set of refs whose generation is bumped whenever any member's cached value
+// changes, so a redraw check is a single comparison instead of a scan.
+struct DatarefGroup {
+        std::vector<DatarefId> members;
+        uint64_t generation;
+        bool active;
+};
+
+template<typename T>
+using DatarefReader = void (*)(XPLMDataRef handle, T &out);
+
+// Compiled once per polled slot when its handle resolves. The reader is picked
+// from the native XPLM type, so the poll loop never asks for it again; the
+// comparison is fixed by the bucket the plan lives in. Arrays and strings are
+// read into the scratch buffer, which is swapped with the cached value only
+// when the contents differ, so both buffers are reused across frames.
+template<typename T>
+struct PollPlan {
+        DatarefId id;
+        XPLMDataRef handle;
+        DatarefReader<T> reader;
+        T scratch;
+};
+
+template<typename Variant>
+struct PollBucketsFor;
+
+template<typename... Ts>
+struct PollBucketsFor<std::variant<Ts...>> {
+        using type = std::tuple<std::vector<PollPlan<Ts>>...>;
+};
+
+using PollBuckets = PollBucketsFor<DataRefValueType>::type;
+
+struct PollTier {
+        PollBuckets buckets;
+        double periodSeconds;
+        double phase; // Fraction of the current period already polled, 0..1
+};
+
+// Immutable copy of every value polled every frame, published by
+// Dataref::update() for worker threads. Values live in fixed-size chunks, and
+// chunks without a change are shared with the previous snapshot, so publishing
+// copies only the chunks that changed since the last frame.
+struct DatarefSnapshot {
+        static constexpr size_t ChunkSize = 64;
+        using Chunk = std::array<std::shared_ptr<const DataRefValueType>, ChunkSize>;
+
+        std::shared_ptr<const std::unordered_map<std::string, DatarefId, StringViewHash, std::equal_to<>>> ids;
+        std::vector<std::shared_ptr<Chunk>> chunks; // Never written once published
+        size_t size;
+        int cycleNumber;
+
+        // Null unless the ref is polled every frame
+        const DataRefValueType *value(DatarefId id) const {
+            if (id >= size) {
+                return nullptr;
+            }
+            return (*chunks[id / ChunkSize])[id % ChunkSize].get();
+        }
+};
+
+struct PendingWrite {
+        std::string ref;
+        DataRefValueType value;
+        bool setCacheOnly;
+};
+
 class Dataref {
     private:
         Dataref();
@@ -54,9 +253,48 @@ class Dataref {
         static Dataref *instance;
         std::unordered_map<std::string, BoundRef> boundRefs;
         std::unordered_map<std::string, BoundCommand> boundCommands;
-        std::unordered_map<std::string, XPLMDataRef> refs;
-        std::unordered_map<std::string, CachedValue> cachedValues;
+        std::unordered_map<std::string, XPLMCommandRef, StringViewHash, std::equal_to<>> commandHandles;
+        std::unordered_map<std::string, bool, StringViewHash, std::equal_to<>> existenceCache;
+        std::unordered_map<std::string, DatarefId, StringViewHash, std::equal_to<>> slotIds;
+        StableArray<DatarefSlot> slots;
+        uint64_t nextCallbackId;
         XPLMDataRef findRef(const char *ref);
+        XPLMDataRef findRef(DatarefId id);
+        void releaseSlot(DatarefId id);
+        // Moves a polled slot to a faster tier; a slower request is ignored,
+        // so every reader and monitor gets at least the rate it asked for.
+        void raisePollRate(DatarefId id, DatarefPollRate pollRate);
+        // Runs the monitor's change filter first, unless forced
+        void deliverToMonitor(const TaggedMonitorCallback &tc, const DataRefValueType &value, bool force);
+        void notifyMonitors(DatarefId id, bool force);
+        std::array<PollTier, kPolledTierCount> pollTiers;
+        std::vector<DatarefId> unresolvedPolls;
+        std::vector<DatarefId> firstPolls;
+        std::vector<DatarefId> changedPolls;
+        // Monitors added to a slot that already held a live value, with the
+        // id of their callback; update() hands them that value once.
+        std::vector<std::pair<DatarefId, uint64_t>> initialDeliveries;
+        bool pollPlansDirty;
+        std::chrono::steady_clock::time_point lastPollTime;
+        DatarefPollStats pollStats;
+        void compilePollPlans();
+        template<typename T>
+        int pollBucket(std::vector<PollPlan<T>> &bucket, size_t begin, size_t end, int cycleNumber);
+        int pollTier(PollTier &tier, double elapsedSeconds, int cycleNumber);
+        void refreshOnDemand(DatarefId id);
+        std::vector<DatarefGroup> groups;
+        std::vector<DatarefGroupId> freeGroups;
+        void markChanged(DatarefId id);
+        std::atomic<bool> snapshotsEnabled;
+        std::mutex snapshotMutex; // Only held to copy or swap the pointer below
+        std::shared_ptr<const DatarefSnapshot> snapshot;
+        std::shared_ptr<const DatarefSnapshot> publishedSnapshot; // The main thread's copy, read without the lock
+        std::vector<DatarefId> snapshotPending;
+        void publishSnapshot(int cycleNumber);
+        std::mutex pendingWritesMutex;
+        std::vector<PendingWrite> pendingWrites;
+        std::vector<PendingWrite> writeBatch;
+        void applyPendingWrites();
         std::thread::id mainThreadId;
         std::mutex taskQueueMutex;
         std::vector<std::function<void()>> taskQueue;
@@ -65,8 +303,20 @@ class Dataref {
     public:
         static Dataref *getInstance();
 
+        DatarefId intern(const char *ref);
+
+        template<typename T>
+        void monitorExistingDataref(const char *ref,
+            DatarefMonitorChangedCallback<T> callback,
+            void *owner = nullptr,
+            DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME,
+            DatarefFilter filter = {});
         template<typename T>
-        void monitorExistingDataref(const char *ref, DatarefMonitorChangedCallback<T> callback, void *owner = nullptr);
+        void monitorExistingDataref(DatarefId id,
+            DatarefMonitorChangedCallback<T> callback,
+            void *owner = nullptr,
+            DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME,
+            DatarefFilter filter = {});
         template<typename T>
         void createDataref(
             const char *ref, T *value, bool writable = false, DatarefShouldChangeCallback<T> changeCallback = nullptr);
@@ -78,19 +328,116 @@ class Dataref {
         int _commandCallback(XPLMCommandRef inCommand, XPLMCommandPhase inPhase, void *inRefcon);
 
         void update();
+        // Answers are cached until clearExistenceCache(); AircraftIdentity
+        // clears them whenever the set of registered datarefs may change.
         bool exists(const char *ref);
+        void clearExistenceCache();
+        // Hands every monitor the current value, bypassing change filters.
         void executeChangedCallbacksForDataref(const char *ref);
+        void executeChangedCallbacksForDataref(DatarefId id);
         int getCachedLastUpdate(const char *ref);
+        int getCachedLastUpdate(DatarefId id);
+        // The poll rate only applies when this call starts caching the ref.
+        template<typename T>
+        T getCached(const char *ref, DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME);
+        template<typename T>
+        T getCached(DatarefId id, DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME);
+        // Non-copying views of cached arrays and strings. They stay valid until
+        // the next update() or the next call that resolves a new dataref.
+        template<typename T>
+        std::span<const T> getCachedArray(const char *ref, DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME);
         template<typename T>
-        T getCached(const char *ref);
+        std::span<const T> getCachedArray(DatarefId id, DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME);
+        std::string_view getCachedString(const char *ref, DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME);
+        std::string_view getCachedString(DatarefId id, DatarefPollRate pollRate = DatarefPollRate::EVERY_FRAME);
+        const DatarefPollStats &getPollStats();
+        DatarefGroupId createSubscriptionGroup(const std::vector<std::string> &refs);
+        void destroySubscriptionGroup(DatarefGroupId group);
+        uint64_t getGroupGeneration(DatarefGroupId group);
+        // Safe from any thread and never waits for the flight loop. The first
+        // call turns publishing on, so it returns null until the next update().
+        std::shared_ptr<const DatarefSnapshot> getSnapshot();
+        // Off the main thread, get() answers from the snapshot when the ref is
+        // polled every frame, so it is at most a frame old. Other refs get a
+        // blocking one-shot read on the main thread, which leaves them unpolled.
         template<typename T>
         T get(const char *ref);
+        // Off the main thread, set() is queued through setAsync().
         template<typename T>
         void set(const char *ref, T value, bool setCacheOnly = false);
+        // Queues a write from any thread; update() applies the batch in order.
+        template<typename T>
+        void setAsync(const char *ref, T value, bool setCacheOnly = false);
 
+        // Resolved handles are cached; commands never disappear once created.
+        XPLMCommandRef findCommand(const char *command);
         void executeCommand(const char *command, XPLMCommandPhase phase = -1);
 
         void clearCache();
 };
 
+// Owns a subscription group for a product's display refs. The group is
+// registered on first use and re-registered whenever the profile hands out a
+// different ref list; hasChanges() then costs one generation compare. Call
+// reset() when the profile is swapped, acknowledge() after redrawing.
+class DatarefSubscription {
+    private:
+        DatarefGroupId group = kInvalidDatarefGroupId;
+        const std::vector<std::string> *refs = nullptr;
+        uint64_t seenGeneration = 0;
+        bool forced = true;
+
+    public:
+        DatarefSubscription() = default;
+        ~DatarefSubscription();
+        DatarefSubscription(const DatarefSubscription &) = delete;
+        DatarefSubscription &operator=(const DatarefSubscription &) = delete;
+
+        bool hasChanges(const std::vector<std::string> &refs);
+        void acknowledge();
+        void reset();
+};
+
+// One row of a profile's display ref table: the ref's name and, if the
+// profile reads it while drawing, the field of its id struct that receives
+// the interned id. Refs that only trigger a redraw leave the field null.
+// The table is the single list: displayDatarefs() is displayRefNames() of it
+// and the ids are internDisplayRefs() of that result.
+template<typename Refs>
+struct DisplayRef {
+        const char *name;
+        DatarefId Refs::*id = nullptr;
+};
+
+// Names in table order. rename() maps each table name to the full ref name,
+// for profiles whose refs depend on the aircraft variant.
+template<typename Refs, size_t N, typename Rename>
+std::vector<std::string> displayRefNames(const DisplayRef<Refs> (&table)[N], Rename rename) {
+    std::vector<std::string> names;
+    names.reserve(N);
+    for (const DisplayRef<Refs> &ref : table) {
+        names.push_back(rename(ref.name));
+    }
+    return names;
+}
+
+template<typename Refs, size_t N>
+std::vector<std::string> displayRefNames(const DisplayRef<Refs> (&table)[N]) {
+    return displayRefNames(table, [](const char *name) {
+        return std::string(name);
+    });
+}
+
+// names must come from displayRefNames() of the same table.
+template<typename Refs, size_t N>
+Refs internDisplayRefs(const DisplayRef<Refs> (&table)[N], const std::vector<std::string> &names) {
+    Refs refs{};
+    for (size_t i = 0; i < N; ++i) {
+        if (table[i].id) {
+            refs.*(table[i].id) = Dataref::getInstance()->intern(names[i].c_str());
+        }
+    }
+    return refs;
+}
+
 #endif
@@ -0,0 +1,40 @@
+#include "profile-registry.h"
+
+#include "aircraft-identity.h"
+
+#include <algorithm>
+
+ProfileDetection *ProfileDetection::getInstance() {
+    static ProfileDetection instance;
+    return &instance;
+}
+
+bool ProfileDetection::isEligible(bool (*signature)()) {
+    uint64_t identityGeneration = AircraftIdentity::getInstance()->getGeneration();
+    if (identityGeneration != generation) {
+        results.clear();
+        generation = identityGeneration;
+    }
+
+    auto it = results.find(signature);
+    if (it != results.end()) {
+        stats.signatureCacheHits++;
+        return it->second;
+    }
+
+    stats.signatureEvaluations++;
+    bool eligible = signature();
+    results.emplace(signature, eligible);
+    return eligible;
+}
+
+void ProfileDetection::recordSelection(std::chrono::steady_clock::duration elapsed) {
+    int microseconds = static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    stats.selections++;
+    stats.lastSelectionMicroseconds = microseconds;
+    stats.worstSelectionMicroseconds = std::max(stats.worstSelectionMicroseconds, microseconds);
+}
+
+const ProfileSelectionStats &ProfileDetection::getStats() const {
+    return stats;
+}
@@ -0,0 +1,70 @@
+#ifndef PROFILE_REGISTRY_H
+#define PROFILE_REGISTRY_H
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+struct ProfileSelectionStats {
+        uint64_t selections;
+        uint64_t signatureEvaluations;
+        uint64_t signatureCacheHits;
+        int lastSelectionMicroseconds;
+        int worstSelectionMicroseconds;
+};
+
+// Shared eligibility results for every profile of every product. A profile's
+// IsEligible() signature is evaluated at most once per aircraft identity
+// generation (see AircraftIdentity), however many devices ask for it.
+class ProfileDetection {
+    private:
+        ProfileDetection() = default;
+
+        uint64_t generation = 0;
+        std::unordered_map<bool (*)(), bool> results;
+        ProfileSelectionStats stats = {};
+
+    public:
+        static ProfileDetection *getInstance();
+
+        bool isEligible(bool (*signature)());
+        void recordSelection(std::chrono::steady_clock::duration elapsed);
+        const ProfileSelectionStats &getStats() const;
+};
+
+// Compile-time list of the aircraft profiles a product supports. Each
+// profile brings its detection signature (static IsEligible()) and its
+// factory (a constructor taking the product); the position in the list is
+// its priority, the first eligible profile wins.
+//
+//     using FMCProfiles = ProfileRegistry<ProductFMC, FMCAircraftProfile, TolissFMCProfile, ZiboFMCProfile>;
+//     profile = FMCProfiles::create(this);
+template<typename Product, typename BaseProfile, typename... Profiles>
+class ProfileRegistry {
+    private:
+        template<typename Profile>
+        static BaseProfile *construct(Product *product) {
+            return new Profile(product);
+        }
+
+    public:
+        using Factory = BaseProfile *(*)(Product *);
+
+        static Factory find() {
+            ProfileDetection *detection = ProfileDetection::getInstance();
+            auto start = std::chrono::steady_clock::now();
+
+            Factory factory = nullptr;
+            (void) ((detection->isEligible(&Profiles::IsEligible) ? (factory = &construct<Profiles>, true) : false) || ...);
+
+            detection->recordSelection(std::chrono::steady_clock::now() - start);
+            return factory;
+        }
+
+        static BaseProfile *create(Product *product) {
+            Factory factory = find();
+            return factory ? factory(product) : nullptr;
+        }
+};
+
+#endif
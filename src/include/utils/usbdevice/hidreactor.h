@@ -0,0 +1,96 @@
+#ifndef HIDREACTOR_H
+#define HIDREACTOR_H
+
+#if LIN
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+// epoll event loop serving the Linux hidraw devices and the udev monitor.
+// A small fixed pool of reactors is shared by every device, so the thread
+// count no longer grows with the number of connected devices; each
+// registration goes to the least loaded reactor.
+//
+// Each reactor runs two threads. The event thread dispatches epoll events,
+// which in practice means reads. hidraw writes block for a USB frame
+// regardless of O_NONBLOCK and always poll writable, so they run on the
+// reactor's writer thread instead, which takes one packet from each device
+// that requested a write in turn. At most PoolSize * 2 threads serve every
+// device; a device stuck in write() holds up the others on its reactor.
+//
+// Handlers and writers run without the handler lock, so add(), remove() and
+// load() on the main thread never wait behind them. remove() waits only for
+// its own fd; once it returns neither callback is running or will run again.
+class HIDReactor {
+    public:
+        using Handler = std::function<void(uint32_t events)>;
+        // Writes one packet; returns whether more are waiting.
+        using Writer = std::function<bool()>;
+
+        static constexpr size_t PoolSize = 4;
+
+        // Reactor for a new registration, started on first use.
+        static HIDReactor *leastLoaded();
+        // Stops and joins every reactor. Everything must be removed first.
+        static void stopAll();
+
+        bool add(int fd, uint32_t events, Handler handler, Writer writer = nullptr);
+        // Queues fd for a turn on the writer thread; a no-op while it already
+        // has one. Safe from any thread.
+        void requestWrite(int fd);
+        // Unregisters fd. From another thread this waits for its running
+        // handler and writer to return; from within its handler it only
+        // stops further events and writes.
+        void remove(int fd);
+
+    private:
+        struct Registration {
+                Handler handler;
+                Writer writer;
+                // Set while the event thread runs the handler. Guarded by
+                // handlersMutex, like the write flags.
+                bool inFlight = false;
+                // Set while the writer thread runs the writer.
+                bool writeInFlight = false;
+                // Set while fd is in writeReady.
+                bool writeQueued = false;
+        };
+
+        int epollFd = -1;
+        // eventfd in the epoll set; written to stop the loop.
+        int wakeFd = -1;
+        std::thread thread;
+        std::thread writerThread;
+        std::atomic<bool> running{false};
+        std::mutex handlersMutex;
+        // Signalled when a handler or writer returns, for remove() waiting
+        // on it.
+        std::condition_variable handlerDone;
+        std::condition_variable writeRequested;
+        std::unordered_map<int, std::shared_ptr<Registration>> handlers;
+        // fds waiting for a turn on the writer thread, in request order.
+        std::deque<int> writeReady;
+
+        static std::array<HIDReactor *, PoolSize> pool;
+        static std::mutex poolMutex;
+
+        HIDReactor();
+        ~HIDReactor();
+
+        bool start();
+        void stop();
+        void run();
+        void runWriter();
+        size_t load();
+};
+#endif
+
+#endif
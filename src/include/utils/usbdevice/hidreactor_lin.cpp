@@ -0,0 +1,265 @@
+#if LIN
+#include "hidreactor.h"
+
+#include "config.h"
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace {
+    constexpr int kMaxEvents = 32;
+}
+
+std::array<HIDReactor *, HIDReactor::PoolSize> HIDReactor::pool = {};
+std::mutex HIDReactor::poolMutex;
+
+HIDReactor::HIDReactor() {}
+
+HIDReactor::~HIDReactor() {
+    stop();
+}
+
+HIDReactor *HIDReactor::leastLoaded() {
+    std::lock_guard<std::mutex> lock(poolMutex);
+
+    HIDReactor *best = nullptr;
+    size_t bestLoad = SIZE_MAX;
+    HIDReactor **freeSlot = nullptr;
+    for (HIDReactor *&reactor : pool) {
+        if (!reactor) {
+            freeSlot = freeSlot ? freeSlot : &reactor;
+            continue;
+        }
+
+        size_t reactorLoad = reactor->load();
+        if (reactorLoad < bestLoad) {
+            best = reactor;
+            bestLoad = reactorLoad;
+        }
+    }
+
+    // Spread over idle threads before doubling up on a busy one.
+    if (freeSlot && bestLoad > 0) {
+        auto *created = new HIDReactor();
+        if (created->start()) {
+            *freeSlot = created;
+            return created;
+        }
+        delete created;
+    }
+
+    return best;
+}
+
+void HIDReactor::stopAll() {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    for (HIDReactor *&reactor : pool) {
+        delete reactor;
+        reactor = nullptr;
+    }
+}
+
+bool HIDReactor::start() {
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        Logger::getInstance()->critical("Failed to create epoll instance: %d\n", errno);
+        return false;
+    }
+
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = wakeFd;
+    if (wakeFd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event) < 0) {
+        // Without the eventfd there is no way to wake the loop out of
+        // epoll_wait(), so stop() would hang in join().
+        Logger::getInstance()->critical("Failed to create reactor shutdown eventfd: %d\n", errno);
+        if (wakeFd >= 0) {
+            close(wakeFd);
+            wakeFd = -1;
+        }
+        close(epollFd);
+        epollFd = -1;
+        return false;
+    }
+
+    running = true;
+    thread = std::thread(&HIDReactor::run, this);
+    writerThread = std::thread(&HIDReactor::runWriter, this);
+    return true;
+}
+
+void HIDReactor::stop() {
+    if (running.exchange(false) && wakeFd >= 0) {
+        uint64_t one = 1;
+        (void) write(wakeFd, &one, sizeof(one));
+    }
+
+    {
+        // Under the lock so the writer cannot miss the wakeup between its
+        // predicate check and its wait.
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        writeRequested.notify_all();
+    }
+
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (writerThread.joinable()) {
+        writerThread.join();
+    }
+
+    if (wakeFd >= 0) {
+        close(wakeFd);
+        wakeFd = -1;
+    }
+    if (epollFd >= 0) {
+        close(epollFd);
+        epollFd = -1;
+    }
+}
+
+size_t HIDReactor::load() {
+    std::lock_guard<std::mutex> lock(handlersMutex);
+    return handlers.size();
+}
+
+bool HIDReactor::add(int fd, uint32_t events, Handler handler, Writer writer) {
+    std::lock_guard<std::mutex> lock(handlersMutex);
+    handlers[fd] = std::make_shared<Registration>(Registration{std::move(handler), std::move(writer)});
+
+    epoll_event event = {};
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        Logger::getInstance()->critical("Failed to add fd %d to the reactor: %d\n", fd, errno);
+        handlers.erase(fd);
+        return false;
+    }
+
+    return true;
+}
+
+void HIDReactor::requestWrite(int fd) {
+    {
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        auto it = handlers.find(fd);
+        if (it == handlers.end() || !it->second->writer || it->second->writeQueued) {
+            return;
+        }
+        it->second->writeQueued = true;
+        writeReady.push_back(fd);
+    }
+    writeRequested.notify_one();
+}
+
+void HIDReactor::remove(int fd) {
+    // A removed fd can still have events in the batch being dispatched; they
+    // find no handler and are skipped.
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+
+    std::unique_lock<std::mutex> lock(handlersMutex);
+    auto it = handlers.find(fd);
+    if (it == handlers.end()) {
+        return;
+    }
+
+    // Both loops hold their own reference, so a handler removing itself keeps
+    // running to completion. A queued write turn finds no registration and
+    // is skipped.
+    std::shared_ptr<Registration> registration = std::move(it->second);
+    handlers.erase(it);
+    bool onEventThread = std::this_thread::get_id() == thread.get_id();
+    bool onWriterThread = std::this_thread::get_id() == writerThread.get_id();
+    handlerDone.wait(lock, [&] {
+        return (onEventThread || !registration->inFlight) && (onWriterThread || !registration->writeInFlight);
+    });
+}
+
+void HIDReactor::run() {
+    epoll_event events[kMaxEvents];
+
+    while (running) {
+        int count = epoll_wait(epollFd, events, kMaxEvents, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Logger::getInstance()->critical("epoll_wait failed: %d\n", errno);
+            break;
+        }
+
+        for (int i = 0; i < count && running; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == wakeFd) {
+                continue;
+            }
+
+            std::shared_ptr<Registration> registration;
+            {
+                std::lock_guard<std::mutex> lock(handlersMutex);
+                auto it = handlers.find(fd);
+                if (it == handlers.end()) {
+                    continue;
+                }
+                registration = it->second;
+                registration->inFlight = true;
+            }
+
+            // Unlocked: a slow handler must not hold up add(), remove() or
+            // load() for the other fds.
+            registration->handler(events[i].events);
+
+            {
+                std::lock_guard<std::mutex> lock(handlersMutex);
+                registration->inFlight = false;
+            }
+            handlerDone.notify_all();
+        }
+    }
+
+    Logger::getInstance()->debug("Reactor thread exiting\n");
+}
+
+void HIDReactor::runWriter() {
+    std::unique_lock<std::mutex> lock(handlersMutex);
+
+    while (true) {
+        writeRequested.wait(lock, [this] {
+            return !writeReady.empty() || !running;
+        });
+        if (!running) {
+            break;
+        }
+
+        int fd = writeReady.front();
+        writeReady.pop_front();
+
+        auto it = handlers.find(fd);
+        if (it == handlers.end()) {
+            continue;
+        }
+        std::shared_ptr<Registration> registration = it->second;
+        registration->writeQueued = false;
+        registration->writeInFlight = true;
+
+        // One packet per turn, unlocked: hidraw write() blocks for a USB
+        // frame, and the devices sharing this writer take turns.
+        lock.unlock();
+        bool morePending = registration->writer();
+        lock.lock();
+
+        registration->writeInFlight = false;
+        it = handlers.find(fd);
+        if (morePending && !registration->writeQueued && it != handlers.end() && it->second == registration) {
+            registration->writeQueued = true;
+            writeReady.push_back(fd);
+        }
+        handlerDone.notify_all();
+    }
+
+    Logger::getInstance()->debug("Reactor writer thread exiting\n");
+}
+#endif
@@ -14,6 +14,7 @@ bool USBController::anyProfileReady() {
 
 void USBController::connectAllDevices() {
     AppState::getInstance()->executeAfter(0, this, [this]() {
+        loadAllProfiles();
         enumerateDevices();
     });
 }
@@ -30,3 +31,20 @@ void USBController::disconnectAllDevices() {
     }
     devices.clear();
 }
+
+void USBController::unloadAllProfiles() {
+    std::lock_guard<std::mutex> lock(devicesMutex);
+    for (auto ptr : devices) {
+        ptr->blackout();
+        ptr->unloadProfile();
+    }
+}
+
+void USBController::loadAllProfiles() {
+    std::lock_guard<std::mutex> lock(devicesMutex);
+    for (auto ptr : devices) {
+        if (ptr->connected) {
+            ptr->loadProfileForCurrentAircraft();
+        }
+    }
+}
@@ -39,8 +39,10 @@ class USBController {
         // monitor-thread reads racing flight-loop mutation on Windows/Linux.
         std::mutex devicesMutex;
 
-#if IBM || LIN
+#if IBM
         std::thread monitorThread;
+#elif LIN
+        HIDReactor *monitorReactor = nullptr;
 #endif
 #if IBM
         std::mutex monitorMutex;
@@ -68,7 +70,9 @@ class USBController {
 #elif LIN
         static void DeviceAddedCallback(void *context, struct udev_device *device);
         static void DeviceRemovedCallback(void *context, struct udev_device *device);
-        void monitorDevices();
+        void receiveDeviceEvent();
+        void scheduleStaleDeviceSweep();
+        void recycleStaleDevices();
         USBDevice *createDeviceFromPath(const std::string &devicePath);
         bool deviceExistsAtPath(const std::string &devicePath);
         void addDeviceFromPath(const std::string &devicePath);
@@ -84,6 +88,11 @@ class USBController {
         bool anyProfileReady();
         void connectAllDevices();
         void disconnectAllDevices();
+
+        // Aircraft switches keep every device connected and only swap the
+        // profiles; connectAllDevices() reloads them on the next frame.
+        void unloadAllProfiles();
+        void loadAllProfiles();
 };
 
 #endif
@@ -1,11 +1,10 @@
 #if LIN
 #include "appstate.h"
 #include "config.h"
+#include "hidreactor.h"
 #include "usbcontroller.h"
 #include "usbdevice.h"
 
-#include <atomic>
-#include <chrono>
 #include <cstring>
 #include <dirent.h>
 #include <errno.h>
@@ -13,15 +12,18 @@
 #include <iostream>
 #include <libudev.h>
 #include <linux/hidraw.h>
+#include <sys/epoll.h>
 #include <sys/ioctl.h>
-#include <sys/select.h>
 #include <sys/stat.h>
-#include <thread>
 #include <unistd.h>
 #include <XPLMUtilities.h>
 
 USBController *USBController::instance = nullptr;
-static std::atomic<bool> shouldStopMonitoring{false};
+
+namespace {
+    // Same cadence as the Windows hot-plug scan.
+    constexpr int kStaleDeviceSweepIntervalMilliseconds = 5000;
+}
 
 USBController::USBController() {
     struct udev *udev = udev_new();
@@ -40,10 +42,16 @@ USBController::USBController() {
     udev_monitor_filter_add_match_subsystem_devtype(hidManager, "hidraw", nullptr);
     udev_monitor_enable_receiving(hidManager);
 
-    shouldStopMonitoring = false;
-    monitorThread = std::thread([this]() {
-        monitorDevices();
-    });
+    // Hot-plug events share a reactor thread with the devices.
+    monitorReactor = HIDReactor::leastLoaded();
+    if (!monitorReactor || !monitorReactor->add(udev_monitor_get_fd(hidManager), EPOLLIN, [this](uint32_t) {
+            receiveDeviceEvent();
+        })) {
+        Logger::getInstance()->critical("Failed to watch for device hot-plug events\n");
+        monitorReactor = nullptr;
+    }
+
+    scheduleStaleDeviceSweep();
 }
 
 USBController::~USBController() {
@@ -58,17 +66,20 @@ USBController *USBController::getInstance() {
 }
 
 void USBController::destroy() {
-    shouldStopMonitoring = true;
+    AppState::getInstance()->cancelTasksForOwner(this);
 
-    // Join before touching any shared state or freeing udev resources
-    if (monitorThread.joinable()) {
-        monitorThread.join();
+    // Waits for a running hot-plug handler before touching any shared state
+    // or freeing udev resources
+    if (monitorReactor) {
+        monitorReactor->remove(udev_monitor_get_fd(hidManager));
+        monitorReactor = nullptr;
     }
 
     for (auto ptr : devices) {
         delete ptr;
     }
     devices.clear();
+    HIDReactor::stopAll();
 
     if (hidManager) {
         struct udev *udev = udev_monitor_get_udev(hidManager);
@@ -86,7 +97,9 @@ void USBController::forgetDevice(USBDevice *device) {
 }
 
 USBDevice *USBController::createDeviceFromPath(const std::string &devicePath) {
-    int fd = open(devicePath.c_str(), O_RDWR);
+    // Non-blocking for reads: the reactor drains them until EAGAIN. hidraw
+    // ignores the flag for writes, which block on the reactor writer.
+    int fd = open(devicePath.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
     if (fd < 0) {
         return nullptr;
     }
@@ -163,34 +176,60 @@ void USBController::enumerateDevices() {
     closedir(dir);
 }
 
-void USBController::monitorDevices() {
-    if (!AppState::getInstance()->pluginInitialized || shouldStopMonitoring) {
-        return;
+void USBController::scheduleStaleDeviceSweep() {
+    AppState::getInstance()->executeAfter(kStaleDeviceSweepIntervalMilliseconds, this, [this]() {
+        recycleStaleDevices();
+        scheduleStaleDeviceSweep();
+    });
+}
+
+void USBController::recycleStaleDevices() {
+    // A device flags itself disconnected when its writer stops draining (see
+    // USBDevice::reservePacket). udev sends no event for that, so close it
+    // here and reopen whatever is still plugged in, as the Windows scan does.
+    bool recycled = false;
+    {
+        std::lock_guard<std::mutex> lock(devicesMutex);
+        for (auto it = devices.begin(); it != devices.end();) {
+            USBDevice *dev = *it;
+            if (dev && dev->connected) {
+                ++it;
+                continue;
+            }
+
+            if (dev) {
+                Logger::getInstance()->info("Recycling disconnected device %s (vendorId: 0x%04X, productId: 0x%04X)\n",
+                    dev->productName.empty() ? "Unknown" : dev->productName.c_str(), dev->vendorId, dev->productId);
+                dev->disconnect();
+                delete dev;
+            }
+            it = devices.erase(it);
+            recycled = true;
+        }
     }
 
-    int fd = udev_monitor_get_fd(hidManager);
-    while (!shouldStopMonitoring) {
-        fd_set fds;
-        FD_ZERO(&fds);
-        FD_SET(fd, &fds);
+    if (recycled) {
+        enumerateDevices();
+    }
+}
 
-        struct timeval timeout = {1, 0};
-        int ret = select(fd + 1, &fds, nullptr, nullptr, &timeout);
+void USBController::receiveDeviceEvent() {
+    // Always receive so the readable fd is drained, even while the plugin is
+    // not initialized yet.
+    struct udev_device *device = udev_monitor_receive_device(hidManager);
+    if (!device) {
+        return;
+    }
 
-        if (ret > 0 && FD_ISSET(fd, &fds) && !shouldStopMonitoring) {
-            struct udev_device *device = udev_monitor_receive_device(hidManager);
-            if (device) {
-                const char *action = udev_device_get_action(device);
-                if (strcmp(action, "add") == 0) {
-                    DeviceAddedCallback(this, device);
-                } else if (strcmp(action, "remove") == 0) {
-                    DeviceRemovedCallback(this, device);
-                }
-                udev_device_unref(device);
-            }
+    const char *action = udev_device_get_action(device);
+    if (AppState::getInstance()->pluginInitialized && action) {
+        if (strcmp(action, "add") == 0) {
+            DeviceAddedCallback(this, device);
+        } else if (strcmp(action, "remove") == 0) {
+            DeviceRemovedCallback(this, device);
         }
     }
-    Logger::getInstance()->debug("Monitoring thread is exiting\n");
+    udev_device_unref(device);
 }
 
 void USBController::DeviceAddedCallback(void *context, struct udev_device *device) {
@@ -213,7 +252,7 @@ void USBController::DeviceRemovedCallback(void *context, struct udev_device *dev
     }
 
     // Disconnect and erase on the flight loop. Touching the devices vector or
-    // calling disconnect() from the udev monitor thread races the flight-loop
+    // calling disconnect() from the reactor thread races the flight-loop
     // tasks that mutate the same vector and delete the same objects.
     AppState::getInstance()->executeAfter(0, self, [self, devicePath = std::string(devicePath)]() {
         for (auto it = self->devices.begin(); it != self->devices.end();) {
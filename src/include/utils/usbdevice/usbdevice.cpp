@@ -15,11 +15,19 @@
 #include "product-ursa-minor-throttle.h"
 #include "xplane-bindings.h"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
 #include <XPLMUtilities.h>
 
 // The desktop app overrides this function to get notified of button presses
 __attribute__((weak)) void notifyButtonPressed(uint16_t buttonId, uint16_t productId) {}
 
+std::string USBDevice::trafficCaptureDirectory;
+
 USBDevice *USBDevice::Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName) {
     if (vendorId != WINCTRL_VENDOR_ID) {
         Logger::getInstance()->debug("Vendor ID mismatch: 0x%04X != 0x%04X\n", vendorId, WINCTRL_VENDOR_ID);
@@ -175,6 +183,14 @@ const char *USBDevice::activeProfileName() const {
     return "none";
 }
 
+void USBDevice::unloadProfile() {
+    profileReady = false;
+}
+
+void USBDevice::loadProfileForCurrentAircraft() {
+    // noop, expect override
+}
+
 void USBDevice::blackout() {
     // noop, expect override
 }
@@ -189,6 +205,13 @@ void USBDevice::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uin
     }
 }
 
+void USBDevice::didReceiveButtons(uint64_t buttons, uint64_t previous, uint16_t firstButton) {
+    for (uint64_t visit = buttons | previous; visit; visit &= visit - 1) {
+        int bit = std::countr_zero(visit);
+        didReceiveButton(firstButton + bit, (buttons >> bit) & 1);
+    }
+}
+
 bool USBDevice::isButtonHandledByXPlane(uint16_t hardwareButtonIndex) {
     bool handled = XPlaneBindings::getInstance()->isButtonBound(vendorId, productId, hardwareButtonIndex);
     if (handled) {
@@ -197,46 +220,151 @@ bool USBDevice::isButtonHandledByXPlane(uint16_t hardwareButtonIndex) {
     return handled;
 }
 
-void USBDevice::processOnMainThread(const InputEvent &event) {
+void USBDevice::update() {
+    processInput();
+}
+
+void USBDevice::setInputReportLayout(const InputReportLayout &layout) {
+    inputFilter.setLayout(layout);
+}
+
+void USBDevice::processOnMainThread(const uint8_t *report, int reportLength) {
     if (!connected) {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(eventQueueMutex);
-    eventQueue.push(event);
+    trafficCapture.record(CaptureDirection::INPUT, report, static_cast<size_t>(reportLength));
+    inputFilter.submit(report, static_cast<size_t>(reportLength));
 }
 
 void USBDevice::processQueuedEvents() {
-    std::lock_guard<std::mutex> lock(eventQueueMutex);
-    while (!eventQueue.empty()) {
-        InputEvent event = eventQueue.front();
-        eventQueue.pop();
+    inputFilter.drain([this](InputReport &report) {
+        didReceiveData(report.bytes[0], report.bytes.data(), report.length);
+    });
+}
+
+InputFilterStats USBDevice::getInputStats() const {
+    return inputFilter.getStats();
+}
+
+void USBDevice::commitPacket(WritePacket *packet) {
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    writeQueue.commit(packet);
+    writeQueueSize.store(writeQueue.size());
+    wakeWriter();
+}
 
-        didReceiveData(event.reportId, event.reportData.data(), event.reportLength);
+bool USBDevice::writeData(std::span<const uint8_t> data, WriteLane lane, uint32_t slotKey) {
+    if (data.empty()) {
+        return false;
     }
+
+    if (data.size() > kWritePacketSize) {
+        Logger::getInstance()->critical("Data size too large: %zu bytes\n", data.size());
+        return false;
+    }
+
+    WritePacket *packet = reservePacket(lane, slotKey);
+    if (!packet) {
+        return false;
+    }
+
+    std::copy(data.begin(), data.end(), packet->bytes.begin());
+    packet->length = static_cast<uint8_t>(data.size());
+    commitPacket(packet);
+    return true;
+}
+
+bool USBDevice::writeData(std::initializer_list<uint8_t> data, WriteLane lane, uint32_t slotKey) {
+    return writeData(std::span<const uint8_t>(data.begin(), data.size()), lane, slotKey);
+}
+
+bool USBDevice::writeData(std::span<const uint8_t> data, uint32_t slotKey) {
+    return writeData(data, WriteLane::INTERACTIVE, slotKey);
+}
+
+bool USBDevice::writeData(std::initializer_list<uint8_t> data, uint32_t slotKey) {
+    return writeData(std::span<const uint8_t>(data.begin(), data.size()), WriteLane::INTERACTIVE, slotKey);
 }
 
 size_t USBDevice::getWriteQueueSize() {
     return writeQueueSize.load();
 }
 
-int USBDevice::getDisplayUpdateFrameInterval(int minWaitFrames) {
-    size_t queueSize = writeQueueSize.load();
-
-    int interval;
-    if (queueSize < 50) {
-        interval = 2;
-    } else if (queueSize < 250) {
-        interval = 4;
-    } else if (queueSize < 500) {
-        interval = 8;
-    } else if (queueSize < 1000) {
-        interval = 16;
-    } else if (queueSize < 2000) {
-        interval = 32;
-    } else {
-        interval = 100;
+size_t USBDevice::getWriteQueueSize(WriteLane lane) {
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    return writeQueue.size(lane);
+}
+
+std::array<WriteLaneStats, kWriteLaneCount> USBDevice::getWriteQueueStats() {
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    return writeQueue.getStats();
+}
+
+std::chrono::milliseconds USBDevice::getDisplayUpdateInterval(std::chrono::milliseconds minInterval) {
+    return displayPacer.interval(minInterval);
+}
+
+bool USBDevice::isDisplayUpdateDue(std::chrono::milliseconds minInterval) {
+    // Pace on the DISPLAY lane alone. BULK uploads wait behind redraws and
+    // LED packets are no part of one, so neither is a display backlog.
+    size_t displayDepth;
+    uint64_t displayCommitted;
+    {
+        std::lock_guard<std::mutex> lock(writeQueueMutex);
+        displayDepth = writeQueue.size(WriteLane::DISPLAY);
+        displayCommitted = writeQueue.committed(WriteLane::DISPLAY);
+    }
+    return displayPacer.isUpdateDue(displayDepth, displayCommitted, minInterval);
+}
+
+DisplayPacingStats USBDevice::getDisplayPacingStats() const {
+    return displayPacer.getStats();
+}
+
+bool USBDevice::startTrafficCapture() {
+    if (trafficCaptureDirectory.empty()) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(trafficCaptureDirectory, error);
+    if (error) {
+        Logger::getInstance()->critical("Failed to create HID capture directory %s: %s\n", trafficCaptureDirectory.c_str(), error.message().c_str());
+        return false;
     }
 
-    return std::max(interval, minWaitFrames);
+    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm localTime;
+#if IBM
+    localtime_s(&localTime, &now);
+#else
+    localtime_r(&now, &localTime);
+#endif
+
+    char timeBuffer[16];
+    strftime(timeBuffer, sizeof(timeBuffer), "%Y%m%d-%H%M%S", &localTime);
+    // Identical devices (e.g. two of the same joystick) share the product
+    // ID and start in the same second; number the later ones rather
+    // than truncating the first one's file. Captures start on the main thread
+    // only, so nothing races between the check and the open.
+    std::filesystem::path path;
+    for (int copy = 1;; ++copy) {
+        char fileName[40];
+        if (copy == 1) {
+            snprintf(fileName, sizeof(fileName), "%04X-%s.hidcap", productId, timeBuffer);
+        } else {
+            snprintf(fileName, sizeof(fileName), "%04X-%s-%d.hidcap", productId, timeBuffer, copy);
+        }
+        path = std::filesystem::path(trafficCaptureDirectory) / fileName;
+        if (!std::filesystem::exists(path, error)) {
+            break;
+        }
+    }
+
+    return trafficCapture.start(path.string(), vendorId, productId, productName);
+}
+
+void USBDevice::stopTrafficCapture() {
+    trafficCapture.stop();
 }
@@ -2,12 +2,20 @@
 #define USBDEVICE_H
 
 #include "config.h"
+#include "usbdisplaypacer.h"
+#include "usbinputfilter.h"
+#include "usbtrafficcapture.h"
+#include "usbwritequeue.h"
 
+#include <array>
 #include <atomic>
+#include <bitset>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <initializer_list>
 #include <mutex>
-#include <queue>
+#include <span>
 #include <string>
 #include <thread>
 #include <typeinfo>
@@ -24,29 +32,40 @@ typedef HANDLE HIDDeviceHandle;
 #elif LIN
 #include <linux/hidraw.h>
 typedef int HIDDeviceHandle;
+class HIDReactor;
 #endif
 
-struct InputEvent {
-        int reportId;
-        std::vector<uint8_t> reportData;
-        int reportLength;
-};
+// Hardware button indices a product tracks pressed state for.
+constexpr size_t kMaxHardwareButtons = 256;
+using ButtonStates = std::bitset<kMaxHardwareButtons>;
 
 class USBDevice {
     private:
         uint8_t *inputBuffer = nullptr;
-        std::queue<InputEvent> eventQueue;
-        std::mutex eventQueueMutex;
+        USBInputFilter inputFilter;
 
-        std::queue<std::vector<uint8_t>> writeQueue;
+        USBWriteQueue writeQueue;
         std::mutex writeQueueMutex;
-        std::condition_variable writeQueueCV;
-        std::thread writeThread;
         std::atomic<bool> writeThreadRunning{false};
         std::atomic<size_t> writeQueueSize{0};
+        USBDisplayPacer displayPacer;
+        USBTrafficCapture trafficCapture;
+#if APL
+        // Set while reservePacket() fails on a full queue, so the overflow is
+        // logged once instead of for every dropped packet.
+        bool writeQueueFull = false;
+#endif
 
         void processQueuedEvents();
+        // Tells the writer that commitPacket() queued a packet. Called with
+        // writeQueueMutex held.
+        void wakeWriter();
+
+#if APL || IBM
+        std::condition_variable writeQueueCV;
+        std::thread writeThread;
         void writeThreadLoop();
+#endif
 
 #if APL
         IOHIDQueueRef hidQueue = nullptr;
@@ -68,8 +87,13 @@ class USBDevice {
         std::string devicePath;
         static void InputReportCallback(void *context, DWORD bytesRead, uint8_t *report);
 #elif LIN
-        std::thread inputThread;
-        int inputPipe[2] = {-1, -1};
+        // Shared reactor serving this device's reads on its event thread and
+        // its writes on its writer thread.
+        HIDReactor *reactor = nullptr;
+        void handleReactorEvents(uint32_t events);
+        // Writes the next queued packet on the reactor's writer thread;
+        // returns whether more are waiting.
+        bool writeNextPacket();
         static void InputReportCallback(void *context, int bytesRead, uint8_t *report);
 #endif
 
@@ -101,11 +125,27 @@ class USBDevice {
 
         virtual const char *classIdentifier();
         virtual const char *activeProfileName() const;
+        // Aircraft switches keep the device open and only swap its profile.
+        // unloadProfile() drops the active profile (blacking out is up to the
+        // caller); loadProfileForCurrentAircraft() selects a new one unless a
+        // profile is still loaded.
+        virtual void unloadProfile();
+        virtual void loadProfileForCurrentAircraft();
         virtual bool connect();
         void disconnect();
         virtual void update();
+        // Drains pending input reports. update() does this too; AppState calls
+        // it on its own in frames between device ticks so input is handled
+        // immediately regardless of the tick rate.
+        void processInput();
         virtual void didReceiveData(int reportId, uint8_t *report, int reportLength);
         virtual void didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uint8_t count = 1);
+        // Decodes one little-endian word of a report's button bitfield, bit 0
+        // being hardware button firstButton. Calls didReceiveButton() in index
+        // order for every bit set in buttons or previous: the edges, plus the
+        // buttons held through the report, which keep getting CommandContinue.
+        // Bits clear in both are skipped.
+        void didReceiveButtons(uint64_t buttons, uint64_t previous, uint16_t firstButton = 0);
         // True when the user assigned this button in X-Plane's joystick
         // settings (globally or in the active aircraft's control profile).
         // X-Plane fires that binding itself, so product didReceiveButton
@@ -117,11 +157,52 @@ class USBDevice {
         virtual void blackout();
         virtual void forceStateSync();
 
-        void processOnMainThread(const InputEvent &event);
-
-        bool writeData(std::vector<uint8_t> data);
+        // Declares which part of the input reports didReceiveData() reads, so
+        // the input thread can drop and merge the rest. Call before connect().
+        void setInputReportLayout(const InputReportLayout &layout);
+        // Input thread only: hands a report to processQueuedEvents() on the
+        // main thread, through the input filter.
+        void processOnMainThread(const uint8_t *report, int reportLength);
+        InputFilterStats getInputStats() const;
+
+        // Zero-copy write path: reservePacket() returns a zeroed slot of the
+        // device's write queue (nullptr when the device is gone or the queue
+        // is full), the caller encodes the report into it, sets its length
+        // and hands it to commitPacket(), which queues it on the lane and
+        // slot key given at reservation. Pass a slot key (see
+        // USBWriteQueue::SlotKey) for state packets where only the newest
+        // value matters; a still-pending packet for the same key is replaced.
+        WritePacket *reservePacket(WriteLane lane = WriteLane::DISPLAY, uint32_t slotKey = USBWriteQueue::NoSlot);
+        void commitPacket(WritePacket *packet);
+
+        // Copies a packet of at most kWritePacketSize bytes into a reserved
+        // slot and commits it.
+        bool writeData(std::span<const uint8_t> data, WriteLane lane = WriteLane::DISPLAY, uint32_t slotKey = USBWriteQueue::NoSlot);
+        bool writeData(std::initializer_list<uint8_t> data, WriteLane lane = WriteLane::DISPLAY, uint32_t slotKey = USBWriteQueue::NoSlot);
+        // Slot-keyed state packet on the INTERACTIVE lane.
+        bool writeData(std::span<const uint8_t> data, uint32_t slotKey);
+        bool writeData(std::initializer_list<uint8_t> data, uint32_t slotKey);
         size_t getWriteQueueSize();
-        int getDisplayUpdateFrameInterval(int minWaitFrames = 0);
+        size_t getWriteQueueSize(WriteLane lane);
+        std::array<WriteLaneStats, kWriteLaneCount> getWriteQueueStats();
+        // Current redraw interval chosen by the display pacer, at least
+        // minInterval.
+        std::chrono::milliseconds getDisplayUpdateInterval(std::chrono::milliseconds minInterval = std::chrono::milliseconds(0));
+        // True (and restarts the interval) when the display pacer allows a
+        // redraw now; see USBDisplayPacer.
+        bool isDisplayUpdateDue(std::chrono::milliseconds minInterval = std::chrono::milliseconds(0));
+        DisplayPacingStats getDisplayPacingStats() const;
+
+        // Directory HID traffic captures go to, empty while capturing is
+        // off. Devices constructed while it is set capture from their first
+        // report. Main thread only.
+        static std::string trafficCaptureDirectory;
+        // Starts capturing this device's reports to a new file in
+        // trafficCaptureDirectory, named after the product ID and the time.
+        // macOS reads button elements instead of reports, so its captures
+        // hold the output only.
+        bool startTrafficCapture();
+        void stopTrafficCapture();
 
         static USBDevice *Device(HIDDeviceHandle hidDevice, uint16_t vendorId, uint16_t productId, std::string vendorName, std::string productName);
 };
@@ -1,23 +1,24 @@
 #if LIN
 #include "appstate.h"
 #include "config.h"
+#include "hidreactor.h"
 #include "usbdevice.h"
 
-#include <atomic>
 #include <chrono>
 #include <cstring>
 #include <errno.h>
-#include <fcntl.h>
-#include <iostream>
 #include <linux/hidraw.h>
-#include <sys/ioctl.h>
-#include <sys/select.h>
+#include <sys/epoll.h>
 #include <thread>
 #include <unistd.h>
 #include <XPLMUtilities.h>
 
 USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName) :
-    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), connected(false) {}
+    hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), connected(false) {
+    if (!trafficCaptureDirectory.empty()) {
+        startTrafficCapture();
+    }
+}
 
 USBDevice::~USBDevice() {
     // Device destructor calls cancelTasksForOwner as a fallback in case a
@@ -27,69 +28,67 @@ USBDevice::~USBDevice() {
 }
 
 bool USBDevice::connect() {
-    static const size_t kInputReportSize = 65;
     if (inputBuffer) {
         delete[] inputBuffer;
         inputBuffer = nullptr;
     }
     inputBuffer = new uint8_t[kInputReportSize];
 
-    if (pipe(inputPipe) < 0) {
-        // Without the self-pipe there is no way to wake the input thread out
-        // of select(), so disconnect() would hang in join(). Fail the connect.
-        Logger::getInstance()->critical("Failed to create shutdown pipe: %d\n", errno);
-        inputPipe[0] = inputPipe[1] = -1;
+    reactor = HIDReactor::leastLoaded();
+    if (!reactor) {
+        Logger::getInstance()->critical("No reactor available for %s\n", productName.c_str());
         return false;
     }
 
     connected = true;
-    inputThread = std::thread([this]() {
-        uint8_t buffer[65];
-        while (connected && hidDevice >= 0) {
-            fd_set fds;
-            FD_ZERO(&fds);
-            FD_SET(hidDevice, &fds);
-            int maxFd = hidDevice + 1;
-            if (inputPipe[0] >= 0) {
-                FD_SET(inputPipe[0], &fds);
-                if (inputPipe[0] + 1 > maxFd) {
-                    maxFd = inputPipe[0] + 1;
-                }
-            }
+    writeThreadRunning = true;
+    if (!reactor->add(
+            hidDevice, EPOLLIN, [this](uint32_t events) {
+                handleReactorEvents(events);
+            },
+            [this]() {
+                return writeNextPacket();
+            })) {
+        connected = false;
+        writeThreadRunning = false;
+        reactor = nullptr;
+        return false;
+    }
 
-            int ret = select(maxFd, &fds, nullptr, nullptr, nullptr);
-            if (ret < 0) {
-                if (errno == EINTR) {
-                    continue;
-                }
-                Logger::getInstance()->critical("Select failed: %d\n", errno);
-                break;
-            }
+    return true;
+}
 
-            if (inputPipe[0] >= 0 && FD_ISSET(inputPipe[0], &fds)) {
-                break; // shutdown signal
-            }
+void USBDevice::handleReactorEvents(uint32_t events) {
+    if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+        return;
+    }
 
-            if (FD_ISSET(hidDevice, &fds)) {
-                ssize_t bytesRead = read(hidDevice, buffer, sizeof(buffer));
-                if (bytesRead > 0 && connected) {
-                    InputReportCallback(this, (int) bytesRead, buffer);
-                } else if (bytesRead < 0) {
-                    Logger::getInstance()->critical("Read failed with error: %d\n", errno);
-                    break;
-                } else {
-                    break; // EOF — device disconnected
-                }
+    // Drain every report that is ready; reads honour O_NONBLOCK.
+    while (true) {
+        ssize_t bytesRead = read(hidDevice, inputBuffer, kInputReportSize);
+        if (bytesRead > 0) {
+            if (connected) {
+                InputReportCallback(this, (int) bytesRead, inputBuffer);
             }
+            continue;
         }
 
-        Logger::getInstance()->debug("Input thread exiting\n");
-    });
-
-    writeThreadRunning = true;
-    writeThread = std::thread(&USBDevice::writeThreadLoop, this);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
 
-    return true;
+        // EOF or a read error: the device is gone. Stop polling it so a
+        // hung-up fd does not spin the reactor; the udev remove event
+        // recycles the device.
+        if (bytesRead < 0) {
+            Logger::getInstance()->critical("Read failed with error: %d\n", errno);
+        }
+        reactor->remove(hidDevice);
+        return;
+    }
 }
 
 void USBDevice::InputReportCallback(void *context, int bytesRead, uint8_t *report) {
@@ -98,20 +97,10 @@ void USBDevice::InputReportCallback(void *context, int bytesRead, uint8_t *repor
         return;
     }
 
-    try {
-        InputEvent event;
-        event.reportId = report[0];
-        event.reportData.assign(report, report + bytesRead);
-        event.reportLength = bytesRead;
-
-        self->processOnMainThread(event);
-    } catch (const std::system_error &e) {
-        // Silently ignore mutex errors that occur during shutdown
-        return;
-    }
+    self->processOnMainThread(report, bytesRead);
 }
 
-void USBDevice::update() {
+void USBDevice::processInput() {
     if (!connected) {
         return;
     }
@@ -120,39 +109,30 @@ void USBDevice::update() {
 }
 
 void USBDevice::disconnect() {
-    // Wake the input thread via the self-pipe so it exits its select() block
-    if (inputPipe[1] >= 0) {
-        uint8_t c = 0;
-        (void) write(inputPipe[1], &c, 1);
-    }
-
-    // Drain before clearing connected: the write thread gates each send on
+    // Drain before clearing connected: the reactor's writer gates each send on
     // connected, so clearing it first discards the queued blackout packets
     // instead of sending them. Bound the drain so a wedged write cannot hang
-    // shutdown; on the deadline the thread stops and discards the rest.
+    // shutdown; on the deadline the rest is discarded. A device already
+    // flagged disconnected sends nothing more, so there is nothing to wait for.
     auto drainDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
-    while (writeQueueSize.load() > 0 && writeThreadRunning &&
+    while (connected && writeQueueSize.load() > 0 && writeThreadRunning &&
            std::chrono::steady_clock::now() < drainDeadline) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
     connected = false;
     writeThreadRunning = false;
-    writeQueueCV.notify_all();
-    if (writeThread.joinable()) {
-        writeThread.join();
-    }
 
-    if (inputThread.joinable()) {
-        inputThread.join();
+    // Waits for a running handler or write, so nothing touches the device
+    // afterwards.
+    if (reactor) {
+        reactor->remove(hidDevice);
+        reactor = nullptr;
     }
 
-    if (inputPipe[0] >= 0) {
-        close(inputPipe[0]);
-        inputPipe[0] = -1;
-    }
-    if (inputPipe[1] >= 0) {
-        close(inputPipe[1]);
-        inputPipe[1] = -1;
+    {
+        std::lock_guard<std::mutex> lock(writeQueueMutex);
+        writeQueue.clear();
+        writeQueueSize.store(0);
     }
 
     if (hidDevice >= 0) {
@@ -169,51 +149,62 @@ void USBDevice::disconnect() {
 }
 
 void USBDevice::forceStateSync() {
-    // noop, code does not use partial data
+    // Products reset their button state before calling this; the input filter
+    // would otherwise hold back reports until a button changes.
+    inputFilter.requestResync();
 }
 
-bool USBDevice::writeData(std::vector<uint8_t> data) {
-    if (hidDevice < 0 || !connected || data.empty()) {
-        return false;
+WritePacket *USBDevice::reservePacket(WriteLane lane, uint32_t slotKey) {
+    if (hidDevice < 0 || !connected) {
+        return nullptr;
     }
 
-    {
-        std::lock_guard<std::mutex> lock(writeQueueMutex);
-        writeQueue.push(std::move(data));
-        writeQueueSize.store(writeQueue.size());
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    WritePacket *packet = writeQueue.reserve(lane, slotKey);
+    if (!packet) {
+        // Every slot is queued or in flight, so the device stopped draining.
+        // Let USBController's stale-device sweep recycle it, as the Windows
+        // writer does, rather than drop packets from an ordered stream.
+        Logger::getInstance()->critical("Write queue overflow for %s (vendorId: 0x%04X, productId: 0x%04X): %zu packets queued, recycling device\n",
+            productName.empty() ? "Unknown" : productName.c_str(), vendorId, productId, writeQueue.size());
+        connected = false;
     }
-    writeQueueCV.notify_one();
 
-    return true;
+    return packet;
 }
 
-void USBDevice::writeThreadLoop() {
-    while (writeThreadRunning) {
-        std::vector<uint8_t> data;
-
-        {
-            std::unique_lock<std::mutex> lock(writeQueueMutex);
-            writeQueueCV.wait(lock, [this] {
-                return !writeQueue.empty() || !writeThreadRunning;
-            });
-
-            if (!writeThreadRunning) {
-                break;
-            }
+void USBDevice::wakeWriter() {
+    if (reactor) {
+        reactor->requestWrite(hidDevice);
+    }
+}
 
-            if (!writeQueue.empty()) {
-                data = std::move(writeQueue.front());
-                writeQueue.pop();
-                writeQueueSize.store(writeQueue.size());
-            }
+bool USBDevice::writeNextPacket() {
+    WritePacket *packet = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(writeQueueMutex);
+        packet = writeQueue.pop();
+        if (!packet) {
+            return false;
         }
+        writeQueueSize.store(writeQueue.size());
+    }
 
-        if (!data.empty() && hidDevice >= 0 && connected) {
-            ssize_t bytesWritten = write(hidDevice, data.data(), data.size());
-            if (bytesWritten != (ssize_t) data.size()) {
-                Logger::getInstance()->critical("Raw write failed: %s (wrote %zd of %zu bytes)\n", strerror(errno), bytesWritten, data.size());
-            }
+    // hidraw ignores O_NONBLOCK for writes, so this blocks until the device
+    // takes the report; the reactor runs it on its writer thread for that.
+    if (connected && hidDevice >= 0) {
+        auto writeStart = std::chrono::steady_clock::now();
+        ssize_t bytesWritten = write(hidDevice, packet->bytes.data(), packet->length);
+        if (bytesWritten == (ssize_t) packet->length) {
+            displayPacer.recordWrite(writeStart, std::chrono::steady_clock::now());
+            trafficCapture.record(CaptureDirection::OUTPUT, packet->bytes.data(), packet->length);
+        } else {
+            Logger::getInstance()->critical("Raw write failed: %s (wrote %zd of %u bytes)\n", strerror(errno), bytesWritten, packet->length);
         }
     }
+
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    writeQueue.release(packet);
+    return !writeQueue.empty();
 }
 #endif
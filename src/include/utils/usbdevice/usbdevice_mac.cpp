@@ -15,6 +15,10 @@ USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aP
     if (hidDevice) {
         CFRetain(hidDevice);
     }
+
+    if (!trafficCaptureDirectory.empty()) {
+        startTrafficCapture();
+    }
 }
 
 USBDevice::~USBDevice() {
@@ -25,8 +29,6 @@ USBDevice::~USBDevice() {
 }
 
 bool USBDevice::connect() {
-    static const size_t kInputReportSize = 65;
-
     // Try to open the device - if it's already opened by the manager, this will return kIOReturnExclusiveAccess
     // or succeed if it wasn't opened yet. Either way, we'll have an open device.
     try {
@@ -70,7 +72,7 @@ bool USBDevice::connect() {
     return true;
 }
 
-void USBDevice::update() {
+void USBDevice::processInput() {
     if (!connected) {
         return;
     }
@@ -140,28 +142,35 @@ void USBDevice::forceStateSync() {
     CFRelease(elements);
 }
 
-bool USBDevice::writeData(std::vector<uint8_t> data) {
-    if (!hidDevice || !connected || data.empty()) {
-        return false;
+WritePacket *USBDevice::reservePacket(WriteLane lane, uint32_t slotKey) {
+    if (!hidDevice || !connected) {
+        return nullptr;
     }
 
-    {
-        std::lock_guard<std::mutex> lock(writeQueueMutex);
-        if (!connected || !writeThreadRunning) {
-            return false;
-        }
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    if (!connected || !writeThreadRunning) {
+        return nullptr;
+    }
 
-        writeQueue.push(std::move(data));
-        writeQueueSize.store(writeQueue.size());
+    // IOKit only rebuilds a device on hot-plug, so a full queue cannot be
+    // solved by recycling it here; drop packets until the writer catches up.
+    WritePacket *packet = writeQueue.reserve(lane, slotKey);
+    if (!packet && !writeQueueFull) {
+        Logger::getInstance()->critical("Write queue full for %s (vendorId: 0x%04X, productId: 0x%04X): dropping packets until it drains\n",
+            productName.empty() ? "Unknown" : productName.c_str(), vendorId, productId);
     }
-    writeQueueCV.notify_one();
+    writeQueueFull = packet == nullptr;
 
-    return true;
+    return packet;
+}
+
+void USBDevice::wakeWriter() {
+    writeQueueCV.notify_one();
 }
 
 void USBDevice::writeThreadLoop() {
     while (writeThreadRunning) {
-        std::vector<uint8_t> data;
+        WritePacket *packet = nullptr;
 
         {
             std::unique_lock<std::mutex> lock(writeQueueMutex);
@@ -170,21 +179,31 @@ void USBDevice::writeThreadLoop() {
             });
 
             if (!writeQueue.empty()) {
-                data = std::move(writeQueue.front());
-                writeQueue.pop();
+                packet = writeQueue.pop();
                 writeQueueSize.store(writeQueue.size());
             } else if (!writeThreadRunning) {
                 break;
             }
         }
 
-        if (!data.empty() && hidDevice) {
-            uint8_t reportID = data[0];
-            IOReturn kr = IOHIDDeviceSetReport(hidDevice, kIOHIDReportTypeOutput, reportID, data.data(), data.size());
-            if (kr != kIOReturnSuccess) {
+        if (!packet) {
+            continue;
+        }
+
+        if (hidDevice) {
+            uint8_t reportID = packet->bytes[0];
+            auto writeStart = std::chrono::steady_clock::now();
+            IOReturn kr = IOHIDDeviceSetReport(hidDevice, kIOHIDReportTypeOutput, reportID, packet->bytes.data(), packet->length);
+            if (kr == kIOReturnSuccess) {
+                displayPacer.recordWrite(writeStart, std::chrono::steady_clock::now());
+                trafficCapture.record(CaptureDirection::OUTPUT, packet->bytes.data(), packet->length);
+            } else {
                 Logger::getInstance()->debug("IOHIDDeviceSetReport failed: %d\n", kr);
             }
         }
+
+        std::lock_guard<std::mutex> lock(writeQueueMutex);
+        writeQueue.release(packet);
     }
 }
 
@@ -200,7 +219,7 @@ void USBDevice::handleHIDValue(IOHIDValueRef value) {
     }
 
     uint32_t hardwareButtonIndex = IOHIDElementGetUsage(element);
-    if (hardwareButtonIndex <= 0 || hardwareButtonIndex > UINT16_MAX) {
+    if (hardwareButtonIndex <= 0 || hardwareButtonIndex > kMaxHardwareButtons) {
         return;
     }
 
@@ -3,6 +3,7 @@
 #include "config.h"
 #include "usbdevice.h"
 
+#include <algorithm>
 #include <chrono>
 #include <hidsdi.h>
 #include <iostream>
@@ -23,16 +24,19 @@ std::string USBDevice::pendingDevicePath;
 // kWriteAttempts    - retries of the SAME packet in place before the device
 //                     is declared unhealthy. A retry only happens when we know
 //                     the packet was NOT delivered (see the stream invariant).
-// kMaxQueuedPackets - backlog ceiling; crossing it means the writer is stuck,
-//                     so the device is recycled rather than dropping packets.
+// The backlog ceiling is the write queue capacity: running out of slots means
+// the writer is stuck, so the device is recycled rather than dropping packets.
 static constexpr DWORD kWriteTimeoutMs = 500;
 static constexpr int kWriteAttempts = 3;
-static constexpr size_t kMaxQueuedPackets = 5000;
 
 USBDevice::USBDevice(HIDDeviceHandle aHidDevice, uint16_t aVendorId, uint16_t aProductId, std::string aVendorName, std::string aProductName) :
     hidDevice(aHidDevice), vendorId(aVendorId), productId(aProductId), vendorName(aVendorName), productName(aProductName), connected(false) {
     devicePath = pendingDevicePath;
     pendingDevicePath.clear();
+
+    if (!trafficCaptureDirectory.empty()) {
+        startTrafficCapture();
+    }
 }
 
 USBDevice::~USBDevice() {
@@ -43,7 +47,6 @@ USBDevice::~USBDevice() {
 }
 
 bool USBDevice::connect() {
-    static const size_t kInputReportSize = 65;
     if (inputBuffer) {
         delete[] inputBuffer;
         inputBuffer = nullptr;
@@ -88,7 +91,7 @@ bool USBDevice::connect() {
         DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &selfHandle, 0, FALSE, DUPLICATE_SAME_ACCESS);
         inputThreadHandle = selfHandle;
 
-        uint8_t buffer[65];
+        uint8_t buffer[kInputReportSize];
         DWORD bytesRead;
         while (connected && hidDevice != INVALID_HANDLE_VALUE) {
             BOOL result = ReadFile(hidDevice, buffer, sizeof(buffer), &bytesRead, nullptr);
@@ -131,22 +134,10 @@ void USBDevice::InputReportCallback(void *context, DWORD bytesRead, uint8_t *rep
         return;
     }
 
-    try {
-        InputEvent event;
-        event.reportId = report[0];
-        event.reportData.assign(report, report + bytesRead);
-        event.reportLength = (int) bytesRead;
-
-        self->processOnMainThread(event);
-    } catch (const std::system_error &e) {
-        return;
-    } catch (...) {
-        Logger::getInstance()->critical("Unexpected exception in InputReportCallback\n");
-        return;
-    }
+    self->processOnMainThread(report, (int) bytesRead);
 }
 
-void USBDevice::update() {
+void USBDevice::processInput() {
     if (!connected) {
         return;
     }
@@ -214,39 +205,35 @@ void USBDevice::disconnect() {
 }
 
 void USBDevice::forceStateSync() {
-    // noop, code does not use partial data
+    // Products reset their button state before calling this; the input filter
+    // would otherwise hold back reports until a button changes.
+    inputFilter.requestResync();
 }
 
-bool USBDevice::writeData(std::vector<uint8_t> data) {
-    if (hidDevice == INVALID_HANDLE_VALUE || !connected || data.empty()) {
-        return false;
+WritePacket *USBDevice::reservePacket(WriteLane lane, uint32_t slotKey) {
+    if (hidDevice == INVALID_HANDLE_VALUE || !connected) {
+        return nullptr;
     }
 
-    if (data.size() > 1024) {
-        Logger::getInstance()->critical("Data size too large: %zu bytes\n", data.size());
-        return false;
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    WritePacket *packet = writeQueue.reserve(lane, slotKey);
+    if (!packet) {
+        // A backlog this large means the writer is stuck or the device
+        // stopped draining. Dropping individual packets would corrupt the
+        // ordered output stream (see the stream invariant), so the only
+        // correct recovery is a full recycle: flag the device unhealthy and
+        // let the reaper rebuild it. connected == false makes reservePacket
+        // return early above, so this logs at most once per wedge.
+        Logger::getInstance()->critical("Write queue overflow for %s (vendorId: 0x%04X, productId: 0x%04X): %zu packets queued, recycling device\n",
+            productName.empty() ? "Unknown" : productName.c_str(), vendorId, productId, writeQueue.size());
+        connected = false;
     }
 
-    {
-        std::lock_guard<std::mutex> lock(writeQueueMutex);
-        if (writeQueue.size() >= kMaxQueuedPackets) {
-            // A backlog this large means the writer is stuck or the device
-            // stopped draining. Dropping individual packets would corrupt the
-            // ordered output stream (see the stream invariant), so the only
-            // correct recovery is a full recycle: flag the device unhealthy and
-            // let the reaper rebuild it. connected == false makes writeData
-            // return early above, so this logs at most once per wedge.
-            Logger::getInstance()->critical("Write queue overflow for %s (vendorId: 0x%04X, productId: 0x%04X): %zu packets queued, recycling device\n",
-                productName.empty() ? "Unknown" : productName.c_str(), vendorId, productId, writeQueue.size());
-            connected = false;
-            return false;
-        }
-        writeQueue.push(std::move(data));
-        writeQueueSize.store(writeQueue.size());
-    }
-    writeQueueCV.notify_one();
+    return packet;
+}
 
-    return true;
+void USBDevice::wakeWriter() {
+    writeQueueCV.notify_one();
 }
 
 void USBDevice::writeThreadLoop() {
@@ -254,8 +241,11 @@ void USBDevice::writeThreadLoop() {
     // Closed on every exit path below.
     HANDLE writeEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
 
+    // Reports longer than a slot are padded in here; sized once per thread.
+    std::vector<uint8_t> paddedReport;
+
     while (writeThreadRunning) {
-        std::vector<uint8_t> data;
+        WritePacket *packet = nullptr;
 
         {
             std::unique_lock<std::mutex> lock(writeQueueMutex);
@@ -267,14 +257,17 @@ void USBDevice::writeThreadLoop() {
                 break;
             }
 
-            if (!writeQueue.empty()) {
-                data = std::move(writeQueue.front());
-                writeQueue.pop();
-                writeQueueSize.store(writeQueue.size());
-            }
+            packet = writeQueue.pop();
+            writeQueueSize.store(writeQueue.size());
         }
 
-        if (data.empty() || hidDevice == INVALID_HANDLE_VALUE || !connected) {
+        if (!packet) {
+            continue;
+        }
+
+        if (hidDevice == INVALID_HANDLE_VALUE || !connected) {
+            std::lock_guard<std::mutex> lock(writeQueueMutex);
+            writeQueue.release(packet);
             continue;
         }
 
@@ -292,13 +285,19 @@ void USBDevice::writeThreadLoop() {
             overlapped = false;
         }
 
-        std::vector<uint8_t> paddedData = data;
-        if (outputReportByteLength > 0 && paddedData.size() < outputReportByteLength) {
-            paddedData.resize(outputReportByteLength, 0);
+        // Slots are zero past their length, so reports up to the slot size
+        // are padded in place.
+        const uint8_t *reportData = packet->bytes.data();
+        DWORD reportLength = std::max<DWORD>(packet->length, outputReportByteLength);
+        if (reportLength > kWritePacketSize) {
+            paddedReport.assign(reportLength, 0);
+            std::copy_n(packet->bytes.begin(), packet->length, paddedReport.begin());
+            reportData = paddedReport.data();
         }
 
         bool unhealthy = false;
         DWORD lastError = 0;
+        auto writeStart = std::chrono::steady_clock::now();
 
         for (int attempt = 1; attempt <= kWriteAttempts; ++attempt) {
             DWORD bytesTransferred = 0;
@@ -309,7 +308,7 @@ void USBDevice::writeThreadLoop() {
                 ResetEvent(writeEvent);
                 OVERLAPPED ov = {};
                 ov.hEvent = writeEvent;
-                if (WriteFile(writeHandle, paddedData.data(), (DWORD) paddedData.size(), nullptr, &ov)) {
+                if (WriteFile(writeHandle, reportData, reportLength, nullptr, &ov)) {
                     delivered = true; // completed synchronously
                 } else {
                     DWORD error = GetLastError();
@@ -345,7 +344,7 @@ void USBDevice::writeThreadLoop() {
                 }
             } else {
                 DWORD bytesWritten = 0;
-                if (WriteFile(writeHandle, paddedData.data(), (DWORD) paddedData.size(), &bytesWritten, nullptr)) {
+                if (WriteFile(writeHandle, reportData, reportLength, &bytesWritten, nullptr)) {
                     delivered = true;
                 } else {
                     lastError = GetLastError();
@@ -383,8 +382,8 @@ void USBDevice::writeThreadLoop() {
                 std::lock_guard<std::mutex> lock(writeQueueMutex);
                 // +1 for the packet that just failed and was already dequeued.
                 discarded = writeQueue.size() + 1;
-                std::queue<std::vector<uint8_t>> empty;
-                std::swap(writeQueue, empty);
+                writeQueue.release(packet);
+                writeQueue.clear();
                 writeQueueSize.store(0);
             }
             connected = false;
@@ -402,14 +401,19 @@ void USBDevice::writeThreadLoop() {
                         return !writeThreadRunning || !writeQueue.empty();
                     });
                     if (!writeQueue.empty()) {
-                        std::queue<std::vector<uint8_t>> empty;
-                        std::swap(writeQueue, empty);
+                        writeQueue.clear();
                         writeQueueSize.store(0);
                     }
                 }
             }
             break;
         }
+
+        displayPacer.recordWrite(writeStart, std::chrono::steady_clock::now());
+        trafficCapture.record(CaptureDirection::OUTPUT, packet->bytes.data(), packet->length);
+
+        std::lock_guard<std::mutex> lock(writeQueueMutex);
+        writeQueue.release(packet);
     }
 
     if (writeEvent != nullptr) {
@@ -0,0 +1,100 @@
+#include "usbdisplaypacer.h"
+
+#include "config.h"
+
+#include <algorithm>
+
+namespace {
+    // Queue delay the pacer steers towards; its depth in packets follows the
+    // measured drain rate.
+    constexpr double kTargetQueueSeconds = 0.05;
+    // Target depth before the drain rate is known, and the smallest one: an
+    // FMC page alone is about this many packets.
+    constexpr size_t kDefaultTargetDepth = 50;
+    constexpr size_t kMinTargetDepth = 16;
+
+    // AIMD steps: added per redraw below target, multiplied in when above.
+    constexpr double kFramesPerSecondStep = 1.0;
+    constexpr double kBackoffFactor = 0.5;
+    // Slowest redraw rate, about one per 1.7 s.
+    constexpr double kMinFramesPerSecond = 0.6;
+
+    // A write starting within this of the previous one ending was queued
+    // behind it, so the gap between their completions is a drain rate sample.
+    constexpr auto kBacklogGap = std::chrono::milliseconds(1);
+
+    constexpr double kSmoothing = 0.05;
+
+    double smooth(double average, double sample) {
+        return average == 0.0 ? sample : average + kSmoothing * (sample - average);
+    }
+}
+
+USBDisplayPacer::USBDisplayPacer() :
+    framesPerSecond(1000.0 / DEVICE_TICK_INTERVAL_MILLISECONDS), targetDepth(kDefaultTargetDepth) {}
+
+void USBDisplayPacer::recordWrite(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    double write = std::chrono::duration<double>(end - start).count();
+    writeSeconds.store(smooth(writeSeconds.load(std::memory_order_relaxed), write), std::memory_order_relaxed);
+
+    // Idle gaps say nothing about capacity, so without a backlog the write
+    // itself is the sample.
+    bool backlogged = start - lastWriteEnd < kBacklogGap;
+    double sample = backlogged ? std::chrono::duration<double>(end - lastWriteEnd).count() : write;
+    secondsPerPacket.store(smooth(secondsPerPacket.load(std::memory_order_relaxed), sample), std::memory_order_relaxed);
+
+    lastWriteEnd = end;
+}
+
+double USBDisplayPacer::maxFramesPerSecond(std::chrono::milliseconds minInterval) const {
+    double limit = 1000.0 / std::max<long long>(DEVICE_TICK_INTERVAL_MILLISECONDS, minInterval.count());
+
+    double perPacket = secondsPerPacket.load(std::memory_order_relaxed);
+    if (perPacket > 0.0 && packetsPerFrame > 0.0) {
+        limit = std::min(limit, 1.0 / (perPacket * packetsPerFrame));
+    }
+
+    return std::max(limit, kMinFramesPerSecond);
+}
+
+bool USBDisplayPacer::isUpdateDue(size_t queueDepth, uint64_t committedPackets, std::chrono::milliseconds minInterval) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastUpdate < interval(minInterval)) {
+        return false;
+    }
+
+    double perPacket = secondsPerPacket.load(std::memory_order_relaxed);
+    targetDepth = perPacket > 0.0 ? std::max(kMinTargetDepth, static_cast<size_t>(kTargetQueueSeconds / perPacket)) : kDefaultTargetDepth;
+
+    if (queueDepth > targetDepth) {
+        framesPerSecond = std::max(framesPerSecond * kBackoffFactor, kMinFramesPerSecond);
+        lastUpdate = now;
+        return false;
+    }
+
+    // The first redraw's count also holds whatever was queued at connect.
+    if (lastUpdate != std::chrono::steady_clock::time_point()) {
+        packetsPerFrame = smooth(packetsPerFrame, static_cast<double>(committedPackets - committedAtLastUpdate));
+    }
+    committedAtLastUpdate = committedPackets;
+
+    framesPerSecond = std::min(framesPerSecond + kFramesPerSecondStep, maxFramesPerSecond(minInterval));
+    lastUpdate = now;
+    return true;
+}
+
+std::chrono::milliseconds USBDisplayPacer::interval(std::chrono::milliseconds minInterval) const {
+    auto paced = std::chrono::milliseconds(static_cast<long long>(1000.0 / framesPerSecond));
+    return std::max(paced, minInterval);
+}
+
+DisplayPacingStats USBDisplayPacer::getStats() const {
+    double perPacket = secondsPerPacket.load(std::memory_order_relaxed);
+    return {
+        perPacket > 0.0 ? 1.0 / perPacket : 0.0,
+        writeSeconds.load(std::memory_order_relaxed) * 1000.0,
+        framesPerSecond,
+        packetsPerFrame,
+        targetDepth,
+    };
+}
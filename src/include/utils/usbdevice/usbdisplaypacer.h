@@ -0,0 +1,55 @@
+#ifndef USBDISPLAYPACER_H
+#define USBDISPLAYPACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+struct DisplayPacingStats {
+        double packetsPerSecond;         // Sustained drain rate, 0 until measured
+        double writeLatencyMilliseconds; // Time a single write takes
+        double framesPerSecond;          // Redraw rate the pacer currently allows
+        double packetsPerFrame;          // Packets queued per redraw
+        size_t targetDepth;              // DISPLAY lane depth the pacer steers towards
+};
+
+// Paces a device's display redraws to what the device drains. The write side
+// times every packet it sends; the main thread runs an AIMD controller on the
+// redraw rate. Each due redraw raises the rate a little while the DISPLAY lane
+// is within a target depth (a fixed delay's worth of packets at the measured
+// drain rate), and halves it and defers the redraw when the queue is deeper.
+// The rate never exceeds what the device can drain at the measured packets
+// per frame, nor the device tick rate.
+class USBDisplayPacer {
+    public:
+        USBDisplayPacer();
+
+        // Writer thread only: a packet was delivered between start and end.
+        void recordWrite(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+        // Main thread only. True (and restarts the interval) when a redraw
+        // may go out now. queueDepth is the current depth of the DISPLAY
+        // lane, committedPackets the number of packets queued on it since
+        // connect.
+        bool isUpdateDue(size_t queueDepth, uint64_t committedPackets, std::chrono::milliseconds minInterval);
+        std::chrono::milliseconds interval(std::chrono::milliseconds minInterval) const;
+
+        DisplayPacingStats getStats() const;
+
+    private:
+        // Written by the writer thread, read by the main thread.
+        std::atomic<double> secondsPerPacket{0.0};
+        std::atomic<double> writeSeconds{0.0};
+        std::chrono::steady_clock::time_point lastWriteEnd;
+
+        double framesPerSecond;
+        double packetsPerFrame = 0.0;
+        size_t targetDepth;
+        uint64_t committedAtLastUpdate = 0;
+        std::chrono::steady_clock::time_point lastUpdate;
+
+        double maxFramesPerSecond(std::chrono::milliseconds minInterval) const;
+};
+
+#endif
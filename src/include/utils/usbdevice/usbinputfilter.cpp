@@ -0,0 +1,70 @@
+#include "usbinputfilter.h"
+
+#include <algorithm>
+
+void USBInputFilter::setLayout(const InputReportLayout &newLayout) {
+    layout = newLayout;
+    layout.buttonOffset = std::min<uint8_t>(layout.buttonOffset, kInputReportSize);
+    layout.buttonLength = std::min<uint8_t>({layout.buttonLength, MaxButtonBytes, static_cast<uint8_t>(kInputReportSize - layout.buttonOffset)});
+    layoutDeclared = true;
+}
+
+void USBInputFilter::submit(const uint8_t *report, size_t length) {
+    received.fetch_add(1, std::memory_order_relaxed);
+
+    if (!layoutDeclared) {
+        ring.push(report, length);
+        return;
+    }
+
+    if (layout.buttonLength == 0 || length < std::max<size_t>(layout.minLength, layout.buttonOffset + layout.buttonLength) || report[0] != layout.reportId) {
+        ignored.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint8_t *buttons = report + layout.buttonOffset;
+    bool resync = resyncRequested.load(std::memory_order_relaxed) && resyncRequested.exchange(false, std::memory_order_relaxed);
+    if (!resync && std::equal(buttons, buttons + layout.buttonLength, lastButtons.begin())) {
+        unchanged.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (InputReport *staged = ring.retractStaged()) {
+        // The staged report carries the edges deliveredButtons -> lastButtons.
+        // Folding this report into it is only safe if none of those buttons
+        // flips back, or the product would miss a press or a release.
+        bool flipsBack = false;
+        for (size_t i = 0; i < layout.buttonLength; ++i) {
+            if ((deliveredButtons[i] ^ lastButtons[i]) & (lastButtons[i] ^ buttons[i])) {
+                flipsBack = true;
+                break;
+            }
+        }
+
+        if (flipsBack) {
+            ring.push(*staged);
+            deliveredButtons = lastButtons;
+        } else {
+            coalesced.fetch_add(1, std::memory_order_relaxed);
+        }
+    } else {
+        deliveredButtons = lastButtons;
+    }
+
+    ring.stage(report, length);
+    std::copy_n(buttons, layout.buttonLength, lastButtons.begin());
+}
+
+void USBInputFilter::requestResync() {
+    resyncRequested.store(true, std::memory_order_relaxed);
+}
+
+InputFilterStats USBInputFilter::getStats() const {
+    return {
+        received.load(std::memory_order_relaxed),
+        unchanged.load(std::memory_order_relaxed),
+        ignored.load(std::memory_order_relaxed),
+        coalesced.load(std::memory_order_relaxed),
+        ring.overflowCount(),
+    };
+}
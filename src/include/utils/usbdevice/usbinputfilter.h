@@ -0,0 +1,74 @@
+#ifndef USBINPUTFILTER_H
+#define USBINPUTFILTER_H
+
+#include "usbinputring.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Where a product's buttons sit in its input reports. Only reports with the
+// report ID and at least minLength bytes reach the product, and only when
+// the button bitfield changed. A zero buttonLength declares that the product
+// reads nothing from its input reports.
+struct InputReportLayout {
+        uint8_t reportId = 1;
+        uint8_t minLength = 0;
+        uint8_t buttonOffset = 1;
+        uint8_t buttonLength = 0;
+};
+
+struct InputFilterStats {
+        uint64_t received;  // Reports read from the device
+        uint64_t unchanged; // Dropped because the buttons did not change
+        uint64_t ignored;   // Dropped because the product does not read them
+        uint64_t coalesced; // Merged into a newer report before the main thread took it
+        uint64_t overflows; // Dropped because the main thread fell behind
+};
+
+// Input-thread side of a device's input path. Reports that only repeat the
+// button state never cross to the main thread, and changes arriving within
+// one frame are merged into the staged report of the USBInputRing as long as
+// no button would lose a press or release; otherwise the staged report is
+// pushed first so the product sees both edges. Without a declared layout
+// every report is passed on as is.
+class USBInputFilter {
+    public:
+        static constexpr size_t MaxButtonBytes = 16;
+
+        // Call before the device starts reading.
+        void setLayout(const InputReportLayout &layout);
+
+        // Input thread only.
+        void submit(const uint8_t *report, size_t length);
+        // Forwards the next report even if its buttons did not change, for
+        // products that just forgot their button state. Any thread.
+        void requestResync();
+
+        // Main thread only; see USBInputRing::drain().
+        template<typename Handler>
+        void drain(Handler &&handler) {
+            ring.drain(handler);
+        }
+
+        InputFilterStats getStats() const;
+
+    private:
+        USBInputRing ring;
+        InputReportLayout layout;
+        bool layoutDeclared = false;
+        std::atomic<bool> resyncRequested{false};
+
+        // Button state of the newest forwarded report, and of the one before
+        // it that the main thread is sure to see. Input thread only.
+        std::array<uint8_t, MaxButtonBytes> lastButtons = {};
+        std::array<uint8_t, MaxButtonBytes> deliveredButtons = {};
+
+        std::atomic<uint64_t> received{0};
+        std::atomic<uint64_t> unchanged{0};
+        std::atomic<uint64_t> ignored{0};
+        std::atomic<uint64_t> coalesced{0};
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "usbinputring.h"
+
+#include <algorithm>
+
+bool USBInputRing::push(const uint8_t *report, size_t length) {
+    size_t write = writeIndex.load(std::memory_order_relaxed);
+    if (write - readIndex.load(std::memory_order_acquire) == Capacity) {
+        overflows.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    InputReport &slot = slots[write % Capacity];
+    slot.length = static_cast<uint8_t>(std::min(length, kInputReportSize));
+    slot.sequence = nextSequence++;
+    std::copy_n(report, slot.length, slot.bytes.begin());
+
+    writeIndex.store(write + 1, std::memory_order_release);
+    return true;
+}
+
+bool USBInputRing::push(const InputReport &report) {
+    size_t write = writeIndex.load(std::memory_order_relaxed);
+    if (write - readIndex.load(std::memory_order_acquire) == Capacity) {
+        overflows.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    slots[write % Capacity] = report;
+
+    writeIndex.store(write + 1, std::memory_order_release);
+    return true;
+}
+
+void USBInputRing::stage(const uint8_t *report, size_t length) {
+    InputReport &staged = stagedReports[producerStaged];
+    staged.length = static_cast<uint8_t>(std::min(length, kInputReportSize));
+    staged.sequence = nextSequence++;
+    std::copy_n(report, staged.length, staged.bytes.begin());
+
+    uint8_t previous = sharedStaged.exchange(producerStaged | StagedFresh, std::memory_order_acq_rel);
+    producerStaged = previous & StagedIndexMask;
+}
+
+InputReport *USBInputRing::retractStaged() {
+    uint8_t previous = sharedStaged.exchange(producerStaged, std::memory_order_acq_rel);
+    producerStaged = previous & StagedIndexMask;
+    return (previous & StagedFresh) ? &stagedReports[producerStaged] : nullptr;
+}
+
+InputReport *USBInputRing::takeStaged() {
+    if (!(sharedStaged.load(std::memory_order_relaxed) & StagedFresh)) {
+        return nullptr;
+    }
+
+    uint8_t previous = sharedStaged.exchange(consumerStaged, std::memory_order_acq_rel);
+    consumerStaged = previous & StagedIndexMask;
+    return (previous & StagedFresh) ? &stagedReports[consumerStaged] : nullptr;
+}
+
+InputReport *USBInputRing::front() {
+    size_t read = readIndex.load(std::memory_order_relaxed);
+    if (read == writeIndex.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    return &slots[read % Capacity];
+}
+
+void USBInputRing::pop() {
+    readIndex.store(readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+size_t USBInputRing::size() const {
+    return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+}
+
+uint64_t USBInputRing::overflowCount() const {
+    return overflows.load(std::memory_order_relaxed);
+}
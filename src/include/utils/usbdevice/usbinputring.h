@@ -0,0 +1,96 @@
+#ifndef USBINPUTRING_H
+#define USBINPUTRING_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Largest HID input report a device sends, report ID included.
+constexpr size_t kInputReportSize = 65;
+
+struct InputReport {
+        std::array<uint8_t, kInputReportSize> bytes;
+        uint8_t length = 0;
+        // Arrival order across pushed and staged reports.
+        uint32_t sequence = 0;
+};
+
+// Incoming reports of a USBDevice on their way from the input thread to the
+// main thread: a bounded single-producer/single-consumer ring of fixed
+// report slots, so neither side locks or allocates. When the main thread
+// falls behind, new reports are dropped and counted instead of blocking the
+// input thread.
+//
+// Next to the ring sits one staged report (a triple buffer) that the input
+// thread can keep merging newer reports into until the main thread takes it;
+// see USBInputFilter.
+class USBInputRing {
+    public:
+        static constexpr size_t Capacity = 256;
+
+        // Input thread only. Reports longer than a slot are truncated.
+        bool push(const uint8_t *report, size_t length);
+        // Pushes a report taken back with retractStaged(), keeping its place
+        // in the order.
+        bool push(const InputReport &report);
+        // Replaces the staged report.
+        void stage(const uint8_t *report, size_t length);
+        // Takes the staged report back unless the main thread already has it;
+        // it then belongs to the input thread until the next stage().
+        InputReport *retractStaged();
+
+        // Main thread only. Hands every report to the handler in arrival
+        // order, the staged one last.
+        template<typename Handler>
+        void drain(Handler &&handler) {
+            InputReport *staged = takeStaged();
+            while (InputReport *report = front()) {
+                // Reports pushed after the staged one was taken wait for the
+                // next drain.
+                if (staged && static_cast<int32_t>(report->sequence - staged->sequence) > 0) {
+                    break;
+                }
+                handler(*report);
+                pop();
+            }
+
+            if (staged) {
+                handler(*staged);
+            }
+        }
+
+        size_t size() const;
+        uint64_t overflowCount() const;
+
+    private:
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        // Set in sharedStaged while it holds a report the main thread has not
+        // taken yet.
+        static constexpr uint8_t StagedFresh = 0x80;
+        static constexpr uint8_t StagedIndexMask = 0x03;
+
+        std::array<InputReport, Capacity> slots;
+        // Free-running counters; a slot index is the counter modulo Capacity.
+        // Each side owns one and only reads the other, on separate cache
+        // lines so they do not bounce between the two threads.
+        alignas(64) std::atomic<size_t> readIndex{0};
+        alignas(64) std::atomic<size_t> writeIndex{0};
+        std::atomic<uint64_t> overflows{0};
+
+        // Triple buffer: the input thread writes stagedReports[producerStaged],
+        // the main thread reads stagedReports[consumerStaged], and the two
+        // swap theirs with sharedStaged.
+        std::array<InputReport, 3> stagedReports;
+        alignas(64) std::atomic<uint8_t> sharedStaged{1};
+        uint8_t producerStaged = 0;
+        uint32_t nextSequence = 0;
+        alignas(64) uint8_t consumerStaged = 2;
+
+        InputReport *front();
+        void pop();
+        InputReport *takeStaged();
+};
+
+#endif
@@ -0,0 +1,156 @@
+#include "usbtrafficcapture.h"
+
+#include "config.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    constexpr char kCaptureMagic[8] = {'W', 'C', 'H', 'I', 'D', 'C', 'A', 'P'};
+    constexpr uint16_t kCaptureVersion = 1;
+
+    // Delta, direction and length in front of every report's bytes.
+    constexpr size_t kRecordHeaderSize = 6;
+
+    void putLittleEndian(uint8_t *out, uint64_t value, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            out[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+
+    uint64_t getLittleEndian(const uint8_t *in, size_t size) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; ++i) {
+            value |= static_cast<uint64_t>(in[i]) << (8 * i);
+        }
+        return value;
+    }
+}
+
+USBTrafficCapture::~USBTrafficCapture() {
+    stop();
+}
+
+bool USBTrafficCapture::start(const std::string &path, uint16_t vendorId, uint16_t productId, const std::string &productName) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file.is_open()) {
+        file.close();
+    }
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        Logger::getInstance()->critical("Failed to open HID capture file %s\n", path.c_str());
+        active = false;
+        return false;
+    }
+
+    uint16_t nameLength = static_cast<uint16_t>(std::min<size_t>(productName.size(), UINT16_MAX));
+    uint8_t header[sizeof(kCaptureMagic) + 8];
+    std::memcpy(header, kCaptureMagic, sizeof(kCaptureMagic));
+    putLittleEndian(header + 8, kCaptureVersion, 2);
+    putLittleEndian(header + 10, vendorId, 2);
+    putLittleEndian(header + 12, productId, 2);
+    putLittleEndian(header + 14, nameLength, 2);
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    file.write(productName.data(), nameLength);
+
+    firstRecord = true;
+    active = true;
+    Logger::getInstance()->info("Capturing HID traffic of %s to %s\n", productName.c_str(), path.c_str());
+    return true;
+}
+
+void USBTrafficCapture::stop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    active = false;
+    if (file.is_open()) {
+        file.close();
+    }
+}
+
+bool USBTrafficCapture::isActive() const {
+    return active.load(std::memory_order_relaxed);
+}
+
+void USBTrafficCapture::record(CaptureDirection direction, const uint8_t *bytes, size_t length) {
+    if (!active.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Timestamped under the lock so deltas never go negative between the
+    // input and writer threads.
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!file.is_open()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    uint64_t delta = firstRecord ? 0 : std::chrono::duration_cast<std::chrono::microseconds>(now - lastRecord).count();
+    lastRecord = now;
+    firstRecord = false;
+
+    // Reports are at most 65 bytes; the length field only has room for 255.
+    length = std::min<size_t>(length, UINT8_MAX);
+
+    uint8_t recordHeader[kRecordHeaderSize];
+    putLittleEndian(recordHeader, std::min<uint64_t>(delta, UINT32_MAX), 4);
+    recordHeader[4] = static_cast<uint8_t>(direction);
+    recordHeader[5] = static_cast<uint8_t>(length);
+    file.write(reinterpret_cast<const char *>(recordHeader), sizeof(recordHeader));
+    file.write(reinterpret_cast<const char *>(bytes), length);
+
+    if (!file) {
+        Logger::getInstance()->critical("Failed to write HID capture, stopping it\n");
+        file.close();
+        active = false;
+    }
+}
+
+bool USBTrafficCapture::load(const std::string &path, TrafficCapture &capture) {
+    std::ifstream input(path, std::ios::binary);
+    if (!input.is_open()) {
+        Logger::getInstance()->critical("Failed to open HID capture file %s\n", path.c_str());
+        return false;
+    }
+
+    uint8_t header[sizeof(kCaptureMagic) + 8];
+    if (!input.read(reinterpret_cast<char *>(header), sizeof(header)) || std::memcmp(header, kCaptureMagic, sizeof(kCaptureMagic)) != 0) {
+        Logger::getInstance()->critical("%s is not a HID capture\n", path.c_str());
+        return false;
+    }
+
+    uint16_t version = static_cast<uint16_t>(getLittleEndian(header + 8, 2));
+    if (version != kCaptureVersion) {
+        Logger::getInstance()->critical("Unsupported HID capture version %u in %s\n", version, path.c_str());
+        return false;
+    }
+
+    capture.vendorId = static_cast<uint16_t>(getLittleEndian(header + 10, 2));
+    capture.productId = static_cast<uint16_t>(getLittleEndian(header + 12, 2));
+    capture.productName.resize(getLittleEndian(header + 14, 2));
+    if (!input.read(capture.productName.data(), capture.productName.size())) {
+        Logger::getInstance()->critical("Truncated HID capture header in %s\n", path.c_str());
+        return false;
+    }
+
+    capture.reports.clear();
+    uint64_t timestamp = 0;
+    uint8_t recordHeader[kRecordHeaderSize];
+    while (input.read(reinterpret_cast<char *>(recordHeader), sizeof(recordHeader))) {
+        timestamp += getLittleEndian(recordHeader, 4);
+
+        CapturedReport report = {
+            .timestampMicroseconds = timestamp,
+            .direction = static_cast<CaptureDirection>(recordHeader[4]),
+            .bytes = std::vector<uint8_t>(recordHeader[5]),
+        };
+        if (!input.read(reinterpret_cast<char *>(report.bytes.data()), report.bytes.size())) {
+            // A capture cut short by a crash still replays up to here.
+            Logger::getInstance()->warn("Truncated HID capture %s after %zu reports\n", path.c_str(), capture.reports.size());
+            break;
+        }
+        capture.reports.push_back(std::move(report));
+    }
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#ifndef USBTRAFFICCAPTURE_H
+#define USBTRAFFICCAPTURE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class CaptureDirection : unsigned char {
+    INPUT,
+    OUTPUT
+};
+
+struct CapturedReport {
+        uint64_t timestampMicroseconds; // Since the first report of the capture
+        CaptureDirection direction;
+        std::vector<uint8_t> bytes;
+};
+
+struct TrafficCapture {
+        uint16_t vendorId;
+        uint16_t productId;
+        std::string productName;
+        std::vector<CapturedReport> reports;
+};
+
+// Records a device's HID traffic to a compact binary log, for replay with
+// src/hid-replay. The file starts with the "WCHIDCAP" magic, a format version
+// and the device's vendor ID, product ID and name; each report follows as the
+// microseconds since the previous one (u32), its direction, its length and
+// the raw bytes, integers little-endian.
+//
+// Input is recorded on the input thread as it is read, output on the writer
+// thread once the device took the packet, so the log holds the order the
+// device saw. record() is a single atomic load while no capture is running.
+class USBTrafficCapture {
+    private:
+        std::atomic<bool> active{false};
+        std::mutex mutex;
+        std::ofstream file;
+        std::chrono::steady_clock::time_point lastRecord;
+        bool firstRecord = true;
+
+    public:
+        ~USBTrafficCapture();
+
+        // Starts a new log at path, replacing a running capture.
+        bool start(const std::string &path, uint16_t vendorId, uint16_t productId, const std::string &productName);
+        void stop();
+        bool isActive() const;
+        void record(CaptureDirection direction, const uint8_t *bytes, size_t length);
+
+        // Reads a whole log written by start()/record().
+        static bool load(const std::string &path, TrafficCapture &capture);
+};
+
+#endif
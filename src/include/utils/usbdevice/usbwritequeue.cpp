@@ -0,0 +1,208 @@
+#include "usbwritequeue.h"
+
+#include <algorithm>
+
+namespace {
+    // How many packets a waiting lane lets higher lanes send before it gets
+    // one itself. Indexed by lane; INTERACTIVE is never passed over.
+    constexpr std::array<unsigned int, kWriteLaneCount> kStarvationLimit = {0, 4, 8};
+
+    // Weight of the newest sample in the smoothed latency.
+    constexpr double kLatencySmoothing = 0.1;
+
+    // Initial room for keyed packets per lane; grows (once) if a device has more.
+    constexpr size_t kPendingSlotsReserve = 64;
+}
+
+USBWriteQueue::USBWriteQueue(size_t capacity) :
+    packets(capacity), slots(capacity) {
+    for (size_t i = capacity; i-- > 0;) {
+        pushFree(static_cast<uint32_t>(i));
+    }
+
+    for (Lane &lane : lanes) {
+        lane.pendingSlots.reserve(kPendingSlotsReserve);
+    }
+}
+
+uint32_t USBWriteQueue::indexOf(const WritePacket *packet) const {
+    return static_cast<uint32_t>(packet - packets.data());
+}
+
+void USBWriteQueue::pushFree(uint32_t index) {
+    slots[index].next = freeHead;
+    freeHead = index;
+}
+
+WritePacket *USBWriteQueue::reserve(WriteLane lane, uint32_t slotKey) {
+    if (freeHead == NoIndex) {
+        return nullptr;
+    }
+
+    uint32_t index = freeHead;
+    SlotInfo &slot = slots[index];
+    freeHead = slot.next;
+    slot.next = NoIndex;
+    slot.lane = lane;
+    slot.slotKey = slotKey;
+
+    WritePacket &packet = packets[index];
+    packet.bytes.fill(0);
+    packet.length = 0;
+    return &packet;
+}
+
+void USBWriteQueue::commit(WritePacket *packet) {
+    uint32_t index = indexOf(packet);
+    SlotInfo &slot = slots[index];
+
+    if (packet->length == 0) {
+        pushFree(index);
+        return;
+    }
+
+    Lane &target = lanes[static_cast<size_t>(slot.lane)];
+
+    if (slot.slotKey != NoSlot) {
+        auto it = std::find_if(target.pendingSlots.begin(), target.pendingSlots.end(), [&](const PendingSlot &pending) {
+            return pending.slotKey == slot.slotKey;
+        });
+        if (it != target.pendingSlots.end()) {
+            packets[it->index] = *packet;
+            target.stats.superseded++;
+            pushFree(index);
+            return;
+        }
+
+        target.pendingSlots.push_back({slot.slotKey, index});
+    }
+
+    slot.queuedAt = std::chrono::steady_clock::now();
+    if (target.tail == NoIndex) {
+        target.head = index;
+    } else {
+        slots[target.tail].next = index;
+    }
+    target.tail = index;
+    target.size++;
+    target.stats.committed++;
+    totalSize++;
+}
+
+size_t USBWriteQueue::nextLane() const {
+    // A starved lane goes first, lowest priority first since it waited longest.
+    for (size_t i = kWriteLaneCount; i-- > 1;) {
+        if (lanes[i].size > 0 && lanes[i].passedOver >= kStarvationLimit[i]) {
+            return i;
+        }
+    }
+
+    for (size_t i = 0; i < kWriteLaneCount; ++i) {
+        if (lanes[i].size > 0) {
+            return i;
+        }
+    }
+
+    return kWriteLaneCount;
+}
+
+WritePacket *USBWriteQueue::pop() {
+    size_t laneIndex = nextLane();
+    if (laneIndex == kWriteLaneCount) {
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < kWriteLaneCount; ++i) {
+        if (i == laneIndex) {
+            lanes[i].passedOver = 0;
+        } else if (i > laneIndex && lanes[i].size > 0) {
+            lanes[i].passedOver++;
+        }
+    }
+
+    Lane &lane = lanes[laneIndex];
+    uint32_t index = lane.head;
+    SlotInfo &slot = slots[index];
+    lane.head = slot.next;
+    if (lane.head == NoIndex) {
+        lane.tail = NoIndex;
+    }
+    slot.next = NoIndex;
+    lane.size--;
+    totalSize--;
+
+    if (slot.slotKey != NoSlot) {
+        std::erase_if(lane.pendingSlots, [index](const PendingSlot &pending) {
+            return pending.index == index;
+        });
+    }
+
+    double latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - slot.queuedAt).count();
+    WriteLaneStats &stats = lane.stats;
+    stats.averageLatencyMilliseconds = stats.sent == 0 ? latency : stats.averageLatencyMilliseconds + kLatencySmoothing * (latency - stats.averageLatencyMilliseconds);
+    stats.worstLatencyMilliseconds = std::max(stats.worstLatencyMilliseconds, latency);
+    stats.sent++;
+
+    return &packets[index];
+}
+
+void USBWriteQueue::release(WritePacket *packet) {
+    pushFree(indexOf(packet));
+}
+
+void USBWriteQueue::clear() {
+    for (Lane &lane : lanes) {
+        for (uint32_t index = lane.head; index != NoIndex;) {
+            uint32_t next = slots[index].next;
+            pushFree(index);
+            index = next;
+        }
+        lane.head = NoIndex;
+        lane.tail = NoIndex;
+        lane.size = 0;
+        lane.pendingSlots.clear();
+        lane.passedOver = 0;
+    }
+    totalSize = 0;
+}
+
+bool USBWriteQueue::empty() const {
+    return totalSize == 0;
+}
+
+bool USBWriteQueue::full() const {
+    return freeHead == NoIndex;
+}
+
+size_t USBWriteQueue::capacity() const {
+    return packets.size();
+}
+
+size_t USBWriteQueue::size() const {
+    return totalSize;
+}
+
+size_t USBWriteQueue::size(WriteLane lane) const {
+    return lanes[static_cast<size_t>(lane)].size;
+}
+
+uint64_t USBWriteQueue::committed(WriteLane lane) const {
+    return lanes[static_cast<size_t>(lane)].stats.committed;
+}
+
+uint64_t USBWriteQueue::supersededCount() const {
+    uint64_t superseded = 0;
+    for (const Lane &lane : lanes) {
+        superseded += lane.stats.superseded;
+    }
+    return superseded;
+}
+
+std::array<WriteLaneStats, kWriteLaneCount> USBWriteQueue::getStats() const {
+    std::array<WriteLaneStats, kWriteLaneCount> result;
+    for (size_t i = 0; i < kWriteLaneCount; ++i) {
+        result[i] = lanes[i].stats;
+        result[i].depth = lanes[i].size;
+    }
+    return result;
+}
@@ -0,0 +1,139 @@
+#ifndef USBWRITEQUEUE_H
+#define USBWRITEQUEUE_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Priority lanes of the write thread, highest first. INTERACTIVE carries
+// direct feedback (LEDs, solenoids, 7-segment windows), DISPLAY carries
+// display frames and BULK carries transfers nobody is waiting on
+// (fonts, backgrounds). Order is only kept within a lane, so every packet of
+// a multi-packet stream (the FMC's 0xf0 configuration and font stream, a
+// segment display frame and its commit) must use the same lane.
+enum class WriteLane : unsigned char {
+    INTERACTIVE = 0,
+    DISPLAY,
+    BULK
+};
+
+constexpr size_t kWriteLaneCount = static_cast<size_t>(WriteLane::BULK) + 1;
+
+// Largest HID output report the plugin sends, report ID included.
+constexpr size_t kWritePacketSize = 64;
+
+// One slot of the write queue. Product code encodes straight into bytes and
+// sets length; bytes past length are zero.
+struct WritePacket {
+        std::array<uint8_t, kWritePacketSize> bytes;
+        uint8_t length = 0;
+};
+
+struct WriteLaneStats {
+        size_t depth = 0;
+        uint64_t sent = 0;
+        // Packets that entered the lane; superseded ones are not counted.
+        uint64_t committed = 0;
+        // Packets dropped because a newer one for the same slot replaced them.
+        uint64_t superseded = 0;
+        // Time from queueing to leaving the queue; the average is smoothed.
+        double averageLatencyMilliseconds = 0.0;
+        double worstLatencyMilliseconds = 0.0;
+};
+
+// Outgoing packet queue of a USBDevice, backed by a fixed pool of
+// WritePacket slots allocated once up front, so queueing a packet never
+// allocates. reserve() hands out a zeroed slot, the caller encodes into it and
+// commit() queues it; pop() hands the slot to the write thread, which sends
+// from it and gives it back with release().
+//
+// pop() serves the highest-priority lane that has packets, except that a lane
+// passed over too many times in a row gets the next packet, so bulk transfers
+// still make progress under a steady stream of LED updates.
+//
+// Packets without a slot key go out strictly in the order they were committed
+// within their lane. Packets with a slot key carry state where only the
+// newest value matters, such as an LED, a dimming channel or a solenoid:
+// while one is still pending, a newer packet for the same key overwrites it
+// in place instead of queueing behind it.
+// Not synchronized; USBDevice guards it with writeQueueMutex.
+class USBWriteQueue {
+    public:
+        static constexpr uint32_t NoSlot = 0;
+        static constexpr size_t DefaultCapacity = 5000;
+
+        // Slot key of a 0x49 "set value" packet: device identifier byte,
+        // target byte and LED/channel index, i.e. packet bytes 1, 2 and 7.
+        static constexpr uint32_t SlotKey(uint8_t identifier, uint8_t target, uint8_t channel) {
+            return 0x01000000u | (static_cast<uint32_t>(identifier) << 16) | (static_cast<uint32_t>(target) << 8) | channel;
+        }
+
+        explicit USBWriteQueue(size_t capacity = DefaultCapacity);
+
+        // Returns a zeroed slot owned by the caller until commit(), or nullptr
+        // when every slot is queued or in flight.
+        WritePacket *reserve(WriteLane lane = WriteLane::DISPLAY, uint32_t slotKey = NoSlot);
+        // Queues a reserved slot. A slot committed with length 0 is returned
+        // to the pool unsent.
+        void commit(WritePacket *packet);
+        // Next packet to send, or nullptr when empty. The slot stays valid
+        // until it is passed to release().
+        WritePacket *pop();
+        void release(WritePacket *packet);
+        // Drops every queued packet. Reserved and popped slots stay with
+        // their owners.
+        void clear();
+
+        bool empty() const;
+        bool full() const;
+        size_t capacity() const;
+        size_t size() const;
+        size_t size(WriteLane lane) const;
+        uint64_t committed(WriteLane lane) const;
+        uint64_t supersededCount() const;
+        std::array<WriteLaneStats, kWriteLaneCount> getStats() const;
+
+    private:
+        static constexpr uint32_t NoIndex = UINT32_MAX;
+
+        // Bookkeeping of a slot, kept apart from the packet bytes so the
+        // pool the write thread reads from stays dense.
+        struct SlotInfo {
+                uint32_t slotKey = NoSlot;
+                // Next slot in the lane or in the free list.
+                uint32_t next = NoIndex;
+                WriteLane lane = WriteLane::DISPLAY;
+                std::chrono::steady_clock::time_point queuedAt;
+        };
+
+        struct PendingSlot {
+                uint32_t slotKey;
+                uint32_t index;
+        };
+
+        struct Lane {
+                uint32_t head = NoIndex;
+                uint32_t tail = NoIndex;
+                size_t size = 0;
+                // Keyed packets still queued in this lane. Only a few dozen
+                // LEDs and channels exist per device, so a scan beats hashing.
+                std::vector<PendingSlot> pendingSlots;
+                // Packets sent from higher lanes while this one was waiting.
+                unsigned int passedOver = 0;
+                WriteLaneStats stats;
+        };
+
+        std::vector<WritePacket> packets;
+        std::vector<SlotInfo> slots;
+        uint32_t freeHead = NoIndex;
+        std::array<Lane, kWriteLaneCount> lanes;
+        size_t totalSize = 0;
+
+        uint32_t indexOf(const WritePacket *packet) const;
+        void pushFree(uint32_t index);
+        size_t nextLane() const;
+};
+
+#endif
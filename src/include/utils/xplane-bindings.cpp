@@ -22,14 +22,14 @@ void XPlaneBindings::reload() {
     loadSlotMapping();
 
     // Re-register on every reload: clearCache() on plane unload drops the
-    // cache entry that drives the per-frame poll for this ref. Unbind first
+    // cache entry that drives the poll for this ref. Unbind first
     // so repeated reloads don't stack duplicate callbacks.
     Dataref::getInstance()->unbind(kButtonAssignmentsRef);
     Dataref::getInstance()->monitorExistingDataref<std::vector<int>>(
         kButtonAssignmentsRef, [this](std::vector<int> assignments) {
             rebuildFromAssignments(assignments);
         },
-        this);
+        this, DatarefPollRate::HZ_1);
 
     rebuildFromAssignments(Dataref::getInstance()->get<std::vector<int>>(kButtonAssignmentsRef));
 }
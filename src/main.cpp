@@ -2,10 +2,12 @@
 #error This is made to be compiled against the XPLM420 SDK for XP12
 #endif
 
+#include "aircraft-identity.h"
 #include "appstate.h"
 #include "config.h"
 #include "dataref.h"
 #include "plugins-menu.h"
+#include "profile-registry.h"
 #include "usbcontroller.h"
 #include "xplane-bindings.h"
 
@@ -100,9 +102,30 @@ PLUGIN_API int XPluginStart(char *name, char *sig, char *desc) {
                     Logger::getInstance()->info("[%s.%03lld] Write queue sizes:\n", timeBuffer, nowMs.count());
                     for (auto &device : USBController::getInstance()->devices) {
                         Logger::getInstance()->info("[%s.%03lld] - %s (%s): %zu pending packets\n", timeBuffer, nowMs.count(), device->classIdentifier(), device->activeProfileName(), device->getWriteQueueSize());
+
+                        static constexpr const char *laneNames[kWriteLaneCount] = {"interactive", "display", "bulk"};
+                        auto laneStats = device->getWriteQueueStats();
+                        for (size_t lane = 0; lane < kWriteLaneCount; ++lane) {
+                            const WriteLaneStats &stats = laneStats[lane];
+                            Logger::getInstance()->info("[%s.%03lld]     %-11s %zu pending, %llu sent, %llu superseded, latency %.1f ms avg / %.1f ms worst\n", timeBuffer, nowMs.count(), laneNames[lane], stats.depth, (unsigned long long) stats.sent, (unsigned long long) stats.superseded, stats.averageLatencyMilliseconds, stats.worstLatencyMilliseconds);
+                        }
+                        DisplayPacingStats pacingStats = device->getDisplayPacingStats();
+                        Logger::getInstance()->info("[%s.%03lld]     display     %.0f packets/s drained, %.2f ms per write, %.1f redraws/s at %.1f packets each (target depth %zu)\n", timeBuffer, nowMs.count(), pacingStats.packetsPerSecond, pacingStats.writeLatencyMilliseconds, pacingStats.framesPerSecond, pacingStats.packetsPerFrame, pacingStats.targetDepth);
+                        InputFilterStats inputStats = device->getInputStats();
+                        Logger::getInstance()->info("[%s.%03lld]     input       %llu received, %llu unchanged, %llu ignored, %llu coalesced, %llu dropped on overflow\n", timeBuffer, nowMs.count(), (unsigned long long) inputStats.received, (unsigned long long) inputStats.unchanged, (unsigned long long) inputStats.ignored, (unsigned long long) inputStats.coalesced, (unsigned long long) inputStats.overflows);
                     }
                 }
 
+                const DatarefPollStats &pollStats = Dataref::getInstance()->getPollStats();
+                Logger::getInstance()->info("[%s.%03lld] Datarefs polled last frame: %d every frame, %d at 20 Hz, %d at 5 Hz, %d at 1 Hz (%d on demand, %d unresolved)\n", timeBuffer, nowMs.count(), pollStats.polledLastFrame[0], pollStats.polledLastFrame[1], pollStats.polledLastFrame[2], pollStats.polledLastFrame[3], pollStats.onDemandRefs, pollStats.unresolvedRefs);
+                Logger::getInstance()->info("[%s.%03lld] Dataref changes since start: %llu delivered, %llu suppressed by change filters\n", timeBuffer, nowMs.count(), (unsigned long long) pollStats.deliveredChanges, (unsigned long long) pollStats.suppressedChanges);
+
+                const FrameBudgetStats &frameStats = AppState::getInstance()->getFrameBudgetStats();
+                Logger::getInstance()->info("[%s.%03lld] Frame time: %d us last, %d us worst, %llu of %llu frames over the %d us budget (%llu deferred tasks run, %zu pending)\n", timeBuffer, nowMs.count(), frameStats.lastFrameMicroseconds, frameStats.worstFrameMicroseconds, (unsigned long long) frameStats.overrunFrames, (unsigned long long) frameStats.frames, frameStats.budgetMicroseconds, (unsigned long long) frameStats.budgetedTasksRun, frameStats.budgetedTasksPending);
+
+                const ProfileSelectionStats &profileStats = ProfileDetection::getInstance()->getStats();
+                Logger::getInstance()->info("[%s.%03lld] Profile selection: %llu runs, %d us last, %d us worst (%llu signatures evaluated, %llu served from cache)\n", timeBuffer, nowMs.count(), (unsigned long long) profileStats.selections, profileStats.lastSelectionMicroseconds, profileStats.worstSelectionMicroseconds, (unsigned long long) profileStats.signatureEvaluations, (unsigned long long) profileStats.signatureCacheHits);
+
                 AppState::getInstance()->executeAfter(5000, nullptr, *action);
             };
 
@@ -112,6 +135,27 @@ PLUGIN_API int XPluginStart(char *name, char *sig, char *desc) {
         }
     });
 
+    // Add "Capture HID traffic" menu item; see src/hid-replay for playback
+    PluginsMenu::getInstance()->addPersistentItem("Capture HID traffic", [](int itemIndex) {
+        bool captureEnabled = !PluginsMenu::getInstance()->isItemChecked(itemIndex);
+
+        PluginsMenu::getInstance()->setItemName(itemIndex, captureEnabled ? "Capturing HID traffic" : "Capture HID traffic");
+        PluginsMenu::getInstance()->setItemChecked(itemIndex, captureEnabled);
+        USBDevice::trafficCaptureDirectory = captureEnabled ? AppState::getInstance()->getPluginDirectory() + "/captures" : "";
+
+        for (auto &device : USBController::getInstance()->devices) {
+            if (captureEnabled) {
+                device->startTrafficCapture();
+            } else {
+                device->stopTrafficCapture();
+            }
+        }
+
+        if (!captureEnabled) {
+            Logger::getInstance()->info("HID traffic capture stopped.\n");
+        }
+    });
+
     Logger::getInstance()->info("Plugin started (version %s)\n", VERSION);
 
     return 1;
@@ -145,6 +189,7 @@ PLUGIN_API void XPluginReceiveMessage(XPLMPluginID from, long msg, void *params)
             }
 
             AppState::getInstance()->initialize();
+            AircraftIdentity::getInstance()->invalidate();
             XPlaneBindings::getInstance()->reload();
             USBController::getInstance()->connectAllDevices();
             break;
@@ -156,8 +201,10 @@ PLUGIN_API void XPluginReceiveMessage(XPLMPluginID from, long msg, void *params)
                 return;
             }
 
-            USBController::getInstance()->disconnectAllDevices();
-            PluginsMenu::getInstance()->clearAllItems();
+            // Devices stay connected across aircraft switches: only their
+            // profiles are dropped here and reloaded on PLANE_LOADED, so the
+            // init sequence and font uploads are not repeated.
+            USBController::getInstance()->unloadAllProfiles();
 
             // The profiles unbind their own monitors on destruction; this
             // drops the leftover display/getCached entries and stale handles
@@ -170,6 +217,14 @@ PLUGIN_API void XPluginReceiveMessage(XPLMPluginID from, long msg, void *params)
             break;
         }
 
+        case XPLM_MSG_PLUGIN_ENABLED:
+        case XPLM_MSG_DATAREFS_ADDED: {
+            // An aircraft plugin may have registered the datarefs a profile
+            // is matched on; products without a profile will try again.
+            AircraftIdentity::getInstance()->invalidate();
+            break;
+        }
+
         default:
             break;
     }
@@ -122,15 +122,20 @@ static void toggleLeds(StressFMC *fmc) {
 // ---------------------------------------------------------------------------
 static void clearFMCDisplay(StressFMC *fmc) {
     // Send 16 blank lines (mirrors ProductFMC::clearDisplay)
-    std::vector<uint8_t> blankLine;
-    blankLine.push_back(0xf2);
-    for (int i = 0; i < StressFMC::PageCharsPerLine; ++i) {
-        blankLine.push_back(0x42);
-        blankLine.push_back(0x00);
-        blankLine.push_back(' ');
-    }
     for (int i = 0; i < 16; ++i) {
-        fmc->writeData(blankLine);
+        WritePacket *packet = fmc->reservePacket();
+        if (!packet) {
+            break;
+        }
+
+        packet->bytes[0] = 0xf2;
+        for (size_t j = 1; j + 2 < kWritePacketSize; j += 3) {
+            packet->bytes[j] = 0x42;
+            packet->bytes[j + 1] = 0x00;
+            packet->bytes[j + 2] = ' ';
+        }
+        packet->length = kWritePacketSize;
+        fmc->commitPacket(packet);
     }
 
     clearScreen();
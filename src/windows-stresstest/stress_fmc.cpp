@@ -11,7 +11,8 @@
 //
 // The draw path mirrors ProductFMC::draw():
 //   For each character: push {0x42, 0x00, char} into a flat buffer, then send
-//   it in 63-byte chunks each prefixed with 0xf2 via writeData() (usbdevice_win.cpp).
+//   it in 63-byte chunks each prefixed with 0xf2, encoded straight into write
+//   queue slots via reservePacket()/commitPacket().
 
 #include "stress_fmc.h"
 
@@ -199,14 +200,16 @@ void StressFMC::drawScrollingText(int scrollOffset) {
     }
 
     // Send buffer in 63-byte chunks, each prefixed with 0xf2 (mirrors draw() in product-fmc.cpp)
-    while (!buf.empty()) {
-        size_t maxLength = std::min<size_t>(63, buf.size());
-        std::vector<uint8_t> usbBuf(buf.begin(), buf.begin() + maxLength);
-        usbBuf.insert(usbBuf.begin(), 0xf2);
-        if (maxLength < 63) {
-            usbBuf.insert(usbBuf.end(), 63 - maxLength, 0);
+    for (size_t offset = 0; offset < buf.size(); offset += kWritePacketSize - 1) {
+        WritePacket *packet = reservePacket();
+        if (!packet) {
+            return;
         }
-        writeData(usbBuf);
-        buf.erase(buf.begin(), buf.begin() + maxLength);
+
+        size_t chunkLength = std::min(kWritePacketSize - 1, buf.size() - offset);
+        packet->bytes[0] = 0xf2;
+        std::copy_n(buf.begin() + offset, chunkLength, packet->bytes.begin() + 1);
+        packet->length = kWritePacketSize;
+        commitPacket(packet);
     }
 }
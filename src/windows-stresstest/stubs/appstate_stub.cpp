@@ -1,7 +1,8 @@
 // Minimal AppState implementation for the standalone Windows stress test.
 // Replaces the full X-Plane-dependent appstate.cpp.
 // - pluginInitialized is always true
-// - executeAfter / executeAfterDebounced call the function immediately
+// - executeAfter / executeAfterDebounced / executeWithinFrameBudget call the
+//   function immediately
 //   (usbcontroller_win.cpp uses executeAfter(0, owner, lambda) to create devices)
 // - Everything else is a no-op / sensible default
 
@@ -49,12 +50,41 @@ void AppState::executeAfterDebounced(std::string /*taskName*/, int /*millisecond
     func();
 }
 
+void AppState::executeWithinFrameBudget(std::string /*taskName*/, FrameWorkPriority /*priority*/, void * /*owner*/, std::function<void()> func) {
+    func();
+}
+
 void AppState::cancelTasksForOwner(void * /*owner*/) {}
 
+void AppState::setFrameBudget(std::chrono::microseconds /*budget*/) {}
+
+const FrameBudgetStats &AppState::getFrameBudgetStats() {
+    static FrameBudgetStats stats = {};
+    return stats;
+}
+
 std::string AppState::readPreference(const std::string & /*key*/, const std::string &defaultValue) {
     return defaultValue;
 }
 
 void AppState::writePreference(const std::string & /*key*/, const std::string & /*value*/) {}
 
+bool AppState::readPreferenceBool(const std::string & /*key*/, bool defaultValue) {
+    return defaultValue;
+}
+
+int AppState::readPreferenceInt(const std::string & /*key*/, int defaultValue) {
+    return defaultValue;
+}
+
+float AppState::readPreferenceFloat(const std::string & /*key*/, float defaultValue) {
+    return defaultValue;
+}
+
+void AppState::writePreferenceBool(const std::string & /*key*/, bool /*value*/) {}
+
+void AppState::writePreferenceInt(const std::string & /*key*/, int /*value*/) {}
+
+void AppState::writePreferenceFloat(const std::string & /*key*/, float /*value*/) {}
+
 void AppState::update() {}
@@ -10,11 +10,18 @@
 #include "usbdevice.h"
 
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
 #include <mutex>
 
 // Button-press notification hook (weak symbol in the main project; normal here).
 void notifyButtonPressed(uint16_t /*buttonId*/, uint16_t /*productId*/) {}
 
+std::string USBDevice::trafficCaptureDirectory;
+
 // ---------------------------------------------------------------------------
 // Device factory — only MCDU product IDs are handled; all others are ignored.
 // ---------------------------------------------------------------------------
@@ -48,6 +55,12 @@ const char *USBDevice::activeProfileName() const {
     return "none";
 }
 
+void USBDevice::unloadProfile() {
+    profileReady = false;
+}
+
+void USBDevice::loadProfileForCurrentAircraft() {}
+
 void USBDevice::blackout() {}
 
 void USBDevice::didReceiveData(int /*reportId*/, uint8_t * /*report*/, int /*reportLength*/) {}
@@ -58,42 +71,143 @@ void USBDevice::didReceiveButton(uint16_t hardwareButtonIndex, bool pressed, uin
     }
 }
 
-void USBDevice::processOnMainThread(const InputEvent &event) {
+void USBDevice::didReceiveButtons(uint64_t buttons, uint64_t previous, uint16_t firstButton) {
+    for (uint64_t visit = buttons | previous; visit; visit &= visit - 1) {
+        int bit = std::countr_zero(visit);
+        didReceiveButton(firstButton + bit, (buttons >> bit) & 1);
+    }
+}
+
+void USBDevice::update() {
+    processInput();
+}
+
+void USBDevice::setInputReportLayout(const InputReportLayout &layout) {
+    inputFilter.setLayout(layout);
+}
+
+void USBDevice::processOnMainThread(const uint8_t *report, int reportLength) {
     if (!connected) {
         return;
     }
-    std::lock_guard<std::mutex> lock(eventQueueMutex);
-    eventQueue.push(event);
+
+    trafficCapture.record(CaptureDirection::INPUT, report, static_cast<size_t>(reportLength));
+    inputFilter.submit(report, static_cast<size_t>(reportLength));
 }
 
 void USBDevice::processQueuedEvents() {
-    std::lock_guard<std::mutex> lock(eventQueueMutex);
-    while (!eventQueue.empty()) {
-        InputEvent event = eventQueue.front();
-        eventQueue.pop();
-        didReceiveData(event.reportId, event.reportData.data(), event.reportLength);
+    inputFilter.drain([this](InputReport &report) {
+        didReceiveData(report.bytes[0], report.bytes.data(), report.length);
+    });
+}
+
+InputFilterStats USBDevice::getInputStats() const {
+    return inputFilter.getStats();
+}
+
+void USBDevice::commitPacket(WritePacket *packet) {
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    writeQueue.commit(packet);
+    writeQueueSize.store(writeQueue.size());
+    wakeWriter();
+}
+
+bool USBDevice::writeData(std::span<const uint8_t> data, WriteLane lane, uint32_t slotKey) {
+    if (data.empty()) {
+        return false;
     }
+
+    if (data.size() > kWritePacketSize) {
+        Logger::getInstance()->critical("Data size too large: %zu bytes\n", data.size());
+        return false;
+    }
+
+    WritePacket *packet = reservePacket(lane, slotKey);
+    if (!packet) {
+        return false;
+    }
+
+    std::copy(data.begin(), data.end(), packet->bytes.begin());
+    packet->length = static_cast<uint8_t>(data.size());
+    commitPacket(packet);
+    return true;
+}
+
+bool USBDevice::writeData(std::initializer_list<uint8_t> data, WriteLane lane, uint32_t slotKey) {
+    return writeData(std::span<const uint8_t>(data.begin(), data.size()), lane, slotKey);
+}
+
+bool USBDevice::writeData(std::span<const uint8_t> data, uint32_t slotKey) {
+    return writeData(data, WriteLane::INTERACTIVE, slotKey);
+}
+
+bool USBDevice::writeData(std::initializer_list<uint8_t> data, uint32_t slotKey) {
+    return writeData(std::span<const uint8_t>(data.begin(), data.size()), WriteLane::INTERACTIVE, slotKey);
 }
 
 size_t USBDevice::getWriteQueueSize() {
     return writeQueueSize.load();
 }
 
-int USBDevice::getDisplayUpdateFrameInterval(int minWaitFrames) {
-    size_t queueSize = writeQueueSize.load();
-    int interval;
-    if (queueSize < 50) {
-        interval = 2;
-    } else if (queueSize < 250) {
-        interval = 4;
-    } else if (queueSize < 500) {
-        interval = 8;
-    } else if (queueSize < 1000) {
-        interval = 16;
-    } else if (queueSize < 2000) {
-        interval = 32;
-    } else {
-        interval = 100;
+size_t USBDevice::getWriteQueueSize(WriteLane lane) {
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    return writeQueue.size(lane);
+}
+
+std::array<WriteLaneStats, kWriteLaneCount> USBDevice::getWriteQueueStats() {
+    std::lock_guard<std::mutex> lock(writeQueueMutex);
+    return writeQueue.getStats();
+}
+
+std::chrono::milliseconds USBDevice::getDisplayUpdateInterval(std::chrono::milliseconds minInterval) {
+    return displayPacer.interval(minInterval);
+}
+
+bool USBDevice::isDisplayUpdateDue(std::chrono::milliseconds minInterval) {
+    // Pace on the DISPLAY lane alone. BULK uploads wait behind redraws and
+    // LED packets are no part of one, so neither is a display backlog.
+    size_t displayDepth;
+    uint64_t displayCommitted;
+    {
+        std::lock_guard<std::mutex> lock(writeQueueMutex);
+        displayDepth = writeQueue.size(WriteLane::DISPLAY);
+        displayCommitted = writeQueue.committed(WriteLane::DISPLAY);
     }
-    return std::max(interval, minWaitFrames);
+    return displayPacer.isUpdateDue(displayDepth, displayCommitted, minInterval);
+}
+
+DisplayPacingStats USBDevice::getDisplayPacingStats() const {
+    return displayPacer.getStats();
+}
+
+bool USBDevice::startTrafficCapture() {
+    if (trafficCaptureDirectory.empty()) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(trafficCaptureDirectory, error);
+    if (error) {
+        Logger::getInstance()->critical("Failed to create HID capture directory %s: %s\n", trafficCaptureDirectory.c_str(), error.message().c_str());
+        return false;
+    }
+
+    auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm localTime;
+#if IBM
+    localtime_s(&localTime, &now);
+#else
+    localtime_r(&now, &localTime);
+#endif
+
+    char timeBuffer[16];
+    strftime(timeBuffer, sizeof(timeBuffer), "%Y%m%d-%H%M%S", &localTime);
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "%04X-%s.hidcap", productId, timeBuffer);
+
+    return trafficCapture.start((std::filesystem::path(trafficCaptureDirectory) / fileName).string(), vendorId, productId, productName);
+}
+
+void USBDevice::stopTrafficCapture() {
+    trafficCapture.stop();
 }